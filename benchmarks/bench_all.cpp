@@ -45,7 +45,8 @@ static void run_file(const std::string &exe_path, const std::string &lib_filter,
 
     bench::print_header("bench_all — " + filename);
     std::cout << "Size: " << (content.size() / 1024.0) << " KB"
-              << "  Iterations: " << N << "\n";
+              << "  Iterations: " << N
+              << "  Stage 1: " << beast::json::lazy::stage1_isa() << "\n";
     bench::print_table_header();
 
     std::vector<std::string> libs = {"beast::lazy", "simdjson",  "yyjson",
@@ -102,6 +103,14 @@ static void run_file(const std::string &exe_path, const std::string &lib_filter,
     }
 
     bench::Result{"beast::lazy", p_ns, s_ns, ok}.print();
+    // Phase 86: arena footprint behind the Mem column (right-sized tape).
+    const size_t tape_kb =
+        ctx.tape.capacity() * sizeof(beast::json::lazy::TapeNode) / 1024;
+    const size_t idx_kb =
+        ctx.idx.capacity * sizeof(beast::json::lazy::tape_off_t) / 1024;
+    std::cout << std::setw(15) << "" << " | Tape: " << ctx.tape.size()
+              << " nodes, " << tape_kb << " KB reserved"
+              << " | Stage 1 index: " << idx_kb << " KB\n";
   }
 
   // ── 1.5 simdjson ─────────────────────────────────────────────────────────
@@ -279,9 +288,29 @@ int main(int argc, char **argv) {
       }
     }
 
-    const std::vector<std::string> files = {"twitter.json", "canada.json",
-                                            "citm_catalog.json",
-                                            "gsoc-2018.json", "harsh.json"};
+    // Long-string payloads (> 64 KB base64-like blobs) exercise the
+    // Phase 84 long-length side table on parse and serialize.
+    if (lib_filter.empty()) {
+      std::ifstream ifs("long_strings.json");
+      if (!ifs.is_open()) {
+        std::ofstream ofs("long_strings.json");
+        std::string s = "[\n";
+        for (int i = 0; i < 64; ++i) {
+          s += "{\"id\": " + std::to_string(i) + ", \"blob\": \"";
+          for (int j = 0; j < 96 * 1024; ++j)
+            s += static_cast<char>('A' + (i * 7 + j) % 26);
+          s += "\"}";
+          if (i < 63)
+            s += ",\n";
+        }
+        s += "\n]";
+        ofs << s;
+      }
+    }
+
+    const std::vector<std::string> files = {
+        "twitter.json",   "canada.json", "citm_catalog.json",
+        "gsoc-2018.json", "harsh.json",  "long_strings.json"};
     size_t scale = quick_mode ? 20 : 1;
     for (const auto &f : files)
       run_file(argv[0], lib_filter, f, std::max<size_t>(1, N / scale),
@@ -0,0 +1,138 @@
+// benchmarks/bench_cursor.cpp
+// Phase 96: on-demand Cursor vs parse() + operator[] — field extraction.
+//
+// Three reads of twitter.json's shape, each done both ways:
+//   first    five fields of the first status (id, text, user.screen_name,
+//            user.followers_count, retweet_count): the Cursor stops early
+//   every    the same five fields from every status
+//   last     search_metadata.count, after all statuses: the Cursor skips
+// parse() builds the whole tape each time; the Cursor builds none and
+// scans only as far as the reads go.
+//
+// Usage:
+//   ./bench_cursor [file.json ...] [--iter N]   # default: twitter.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// The five fields of one status, folded into a checksum.
+template <typename V> static size_t status_fields(V st) {
+  size_t sum = static_cast<size_t>(st["id"].template as<int64_t>());
+  sum += st["text"].template as<std::string_view>().size();
+  auto user = st["user"];
+  sum += user["screen_name"].template as<std::string_view>().size();
+  sum += user["followers_count"].template as<int64_t>();
+  return sum + st["retweet_count"].template as<int64_t>();
+}
+
+static size_t first_tape(beast::Document &doc, const std::string &json) {
+  auto root = beast::parse(doc, json);
+  return status_fields(root["statuses"][0]);
+}
+
+static size_t first_cursor(beast::Cursor &cur, const std::string &json) {
+  auto root = cur.iterate(json);
+  for (auto st : root["statuses"].elements())
+    return status_fields(st);
+  return 0;
+}
+
+static size_t every_tape(beast::Document &doc, const std::string &json) {
+  auto root = beast::parse(doc, json);
+  size_t sum = 0;
+  for (auto st : root["statuses"].elements())
+    sum += status_fields(st);
+  return sum;
+}
+
+static size_t every_cursor(beast::Cursor &cur, const std::string &json) {
+  auto root = cur.iterate(json);
+  size_t sum = 0;
+  for (auto st : root["statuses"].elements())
+    sum += status_fields(st);
+  return sum;
+}
+
+static size_t last_tape(beast::Document &doc, const std::string &json) {
+  auto root = beast::parse(doc, json);
+  return root["search_metadata"]["count"].as<int64_t>();
+}
+
+static size_t last_cursor(beast::Cursor &cur, const std::string &json) {
+  auto root = cur.iterate(json);
+  return root["search_metadata"]["count"].as<int64_t>();
+}
+
+static double time_us(size_t N, size_t &check,
+                      const std::function<size_t()> &fn) {
+  check ^= fn(); // warm-up: size the tape / index
+  bench::Timer t;
+  t.start();
+  for (size_t i = 0; i < N; ++i)
+    check ^= fn();
+  return t.elapsed_ns() / N / 1000.0;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  bench::print_header("bench_cursor — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Iterations: " << N
+            << "  Stage 1: " << beast::json::lazy::stage1_isa() << "\n";
+
+  beast::Document doc;
+  beast::Cursor cur;
+  struct Row {
+    const char *name;
+    size_t (*tape)(beast::Document &, const std::string &);
+    size_t (*cursor)(beast::Cursor &, const std::string &);
+  };
+  for (const Row &r : {Row{"first", first_tape, first_cursor},
+                       Row{"every", every_tape, every_cursor},
+                       Row{"last", last_tape, last_cursor}}) {
+    size_t check_t = 0, check_c = 0;
+    try {
+      const double t_us =
+          time_us(N, check_t, [&] { return r.tape(doc, content); });
+      const double c_us =
+          time_us(N, check_c, [&] { return r.cursor(cur, content); });
+      std::cout << std::setw(6) << r.name << " | parse+[]: " << std::setw(9)
+                << t_us << " μs | cursor: " << std::setw(9) << c_us
+                << " μs (x" << (t_us / c_us) << ")"
+                << (check_t == check_c ? "" : "  [checksum mismatch]")
+                << "\n";
+    } catch (const std::exception &e) {
+      std::cout << std::setw(6) << r.name << " | skipped: " << e.what()
+                << "\n";
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 200;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"twitter.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
@@ -0,0 +1,98 @@
+// benchmarks/bench_errors.cpp
+// Phase 103: the exception-free API against throwing and catching.
+//
+// Rows (ns per call, min over the rounds):
+//   reject  parse() of a malformed message: try/catch vs parse(doc, json, ec)
+//   accept  the same message, well-formed: both entry points
+//   probe   reading a string as an int: as<int>() in try/catch (what
+//           try_as<int>() was) vs get<int>() vs try_as<int>() today
+//
+// Usage:
+//   ./bench_errors [--iter N]   # rounds of 10k calls, default 50
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static volatile int sink;
+
+static double min_ns(size_t rounds, const std::function<void()> &fn) {
+  constexpr int kCalls = 10000;
+  double best = 1e300;
+  for (size_t r = 0; r <= rounds; ++r) { // round 0 warms up
+    bench::Timer t;
+    t.start();
+    for (int i = 0; i < kCalls; ++i)
+      fn();
+    if (r)
+      best = std::min(best, t.elapsed_us() * 1000.0 / kCalls);
+  }
+  return best;
+}
+
+int main(int argc, char **argv) {
+  size_t rounds = 50;
+  for (int i = 1; i < argc; ++i)
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      rounds = static_cast<size_t>(std::atoi(argv[++i]));
+
+  const std::string good =
+      R"({"id":12345,"user":"someone","tags":["a","b","c"],)"
+      R"("geo":{"lat":37.5,"lon":127.0},"ok":true,"text":"hello world"})";
+  const std::string bad = good.substr(0, good.size() - 1); // unterminated
+
+  beast::Document doc;
+  beast::Value probe = beast::parse(doc, good)["user"];
+  beast::Document scratch;
+  struct Row {
+    const char *name;
+    std::function<void()> fn;
+  };
+  const std::vector<Row> rows = {
+      {"reject: throw",
+       [&] {
+         try {
+           beast::parse(scratch, bad);
+         } catch (const std::runtime_error &) {
+           sink = 1;
+         }
+       }},
+      {"reject: ec",
+       [&] {
+         beast::Error ec;
+         beast::parse(scratch, bad, ec);
+         sink = static_cast<int>(ec);
+       }},
+      {"accept: throw", [&] { beast::parse(scratch, good); }},
+      {"accept: ec",
+       [&] {
+         beast::Error ec;
+         beast::parse(scratch, good, ec);
+         sink = static_cast<int>(ec);
+       }},
+      {"probe: as+catch",
+       [&] {
+         try {
+           sink = probe.as<int>();
+         } catch (const std::runtime_error &) {
+           sink = -1;
+         }
+       }},
+      {"probe: get", [&] { sink = probe.get<int>().value_or(-1); }},
+      {"probe: try_as", [&] { sink = probe.try_as<int>().value_or(-1); }},
+  };
+
+  bench::print_header("bench_errors");
+  std::cout << "Message: " << good.size() << " bytes  Rounds: " << rounds
+            << " x 10000 calls\n";
+  for (const Row &r : rows)
+    std::cout << std::setw(16) << r.name << " | " << std::setw(9)
+              << min_ns(rounds, r.fn) << " ns\n";
+  return 0;
+}
@@ -0,0 +1,171 @@
+// benchmarks/bench_file_io.cpp
+// Phase 94: file input — beast::parse_file() (mmap) vs read() + parse().
+//
+// For each file, times:
+//   read()      open + read() into a padded heap buffer (load only)
+//   read+parse  the same, then beast::parse() over the buffer
+//   mmap        beast::parse_file(): map, madvise, parse
+//   mmap+pop    beast::parse_file(..., populate = true) (MAP_POPULATE)
+// Without file arguments, synthetic root arrays of records are written to
+// the temp directory at 1, 16, 128 and 1024 MB (--mb overrides the list;
+// the files are removed afterwards). By default the files stay in the page
+// cache between iterations (warm); --cold asks the kernel to drop their
+// cached pages before each run (posix_fadvise DONTNEED, Linux), so the
+// timings include the disk reads.
+//
+// Usage:
+//   ./bench_file_io [file.json ...] [--mb 1,16,...] [--iter N] [--cold]
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+static bool g_cold = false;
+
+static void drop_cache(const std::string &path) {
+#ifdef POSIX_FADV_DONTNEED
+  if (!g_cold)
+    return;
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+  }
+#else
+  (void)path;
+#endif
+}
+
+// read(): the whole file into a buffer with the parser's tail padding.
+static std::unique_ptr<char[]> read_padded(const std::string &path,
+                                           size_t &size) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open file: " + path);
+  struct stat st;
+  ::fstat(fd, &st);
+  size = static_cast<size_t>(st.st_size);
+  auto buf = std::make_unique<char[]>(size + 64);
+  for (size_t got = 0; got < size;) {
+    const ssize_t n = ::read(fd, buf.get() + got, size - got);
+    if (n <= 0) {
+      ::close(fd);
+      throw std::runtime_error("Failed to read file: " + path);
+    }
+    got += static_cast<size_t>(n);
+  }
+  ::close(fd);
+  return buf;
+}
+
+// ~mb MB array of records (same shape as bench_parallel's).
+static void write_synthetic(const std::string &path, size_t mb) {
+  std::FILE *f = std::fopen(path.c_str(), "wb");
+  if (!f)
+    throw std::runtime_error("Failed to create " + path);
+  std::string rec;
+  size_t written = 1;
+  std::fputc('[', f);
+  for (size_t i = 0; written < mb * 1024 * 1024; ++i) {
+    rec = (i ? ",\n" : "") + std::string("{\"id\":") + std::to_string(i) +
+          ",\"score\":" + std::to_string(static_cast<double>(i) * 0.37) +
+          ",\"name\":\"user \\\"" + std::to_string(i * 7919) +
+          "\\\"\",\"active\":" + (i % 3 ? "true" : "false") +
+          ",\"tags\":[\"x\",\"y\",null]}";
+    std::fwrite(rec.data(), 1, rec.size(), f);
+    written += rec.size();
+  }
+  std::fputc(']', f);
+  std::fclose(f);
+}
+
+template <typename Fn>
+static double time_ms(const std::string &path, size_t N, Fn &&fn) {
+  drop_cache(path);
+  fn(); // warm-up: size the tape and index
+  double total = 0.0;
+  for (size_t i = 0; i < N; ++i) {
+    drop_cache(path);
+    bench::Timer t;
+    t.start();
+    fn();
+    total += t.elapsed_ms();
+  }
+  return total / N;
+}
+
+static void run(const std::string &path, size_t N) {
+  size_t size = 0;
+  beast::Document doc;
+
+  const double read_ms = time_ms(path, N, [&] { read_padded(path, size); });
+  const double read_parse_ms = time_ms(path, N, [&] {
+    auto buf = read_padded(path, size);
+    beast::parse(doc, std::string_view(buf.get(), size));
+  });
+  const double mmap_ms =
+      time_ms(path, N, [&] { beast::parse_file(doc, path); });
+  const double pop_ms =
+      time_ms(path, N, [&] { beast::parse_file(doc, path, true); });
+
+  const double mb = size / (1024.0 * 1024.0);
+  std::cout << std::fixed << std::setprecision(2) << std::setw(9) << mb
+            << " MB | read(): " << std::setw(9) << read_ms
+            << " ms | read+parse: " << std::setw(9) << read_parse_ms
+            << " ms | mmap: " << std::setw(9) << mmap_ms << " ms (x"
+            << (read_parse_ms / mmap_ms) << ") | mmap+pop: " << std::setw(9)
+            << pop_ms << " ms (x" << (read_parse_ms / pop_ms) << ")\n";
+}
+
+int main(int argc, char **argv) {
+  size_t N = 5;
+  std::vector<size_t> sizes = {1, 16, 128, 1024};
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc) {
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--mb") == 0 && i + 1 < argc) {
+      sizes.clear();
+      for (const char *p = argv[++i]; *p;) {
+        char *end;
+        sizes.push_back(std::strtoull(p, &end, 10));
+        p = *end ? end + 1 : end;
+      }
+    } else if (std::strcmp(argv[i], "--cold") == 0) {
+      g_cold = true;
+    } else {
+      files.emplace_back(argv[i]);
+    }
+  }
+
+  bench::print_header("bench_file_io — parse_file (mmap) vs read()");
+  std::cout << "Iterations: " << N << "  Page cache: "
+            << (g_cold ? "dropped before each run" : "warm") << "\n";
+  for (const auto &f : files) {
+    try {
+      run(f, N);
+    } catch (const std::exception &e) {
+      std::cerr << "Skip " << f << ": " << e.what() << "\n";
+    }
+  }
+  if (!files.empty())
+    return 0;
+  const char *tmp = std::getenv("TMPDIR");
+  for (size_t mb : sizes) {
+    const std::string path = std::string(tmp ? tmp : "/tmp") +
+                             "/bench_file_io_" + std::to_string(mb) + ".json";
+    write_synthetic(path, mb);
+    run(path, N);
+    std::remove(path.c_str());
+  }
+  return 0;
+}
@@ -0,0 +1,150 @@
+// benchmarks/bench_float.cpp
+// Phase 98: parse_double() vs std::from_chars and strtod on the number
+// tokens of a file (canada.json: ~111k polygon coordinates).
+//
+// Each row converts every float token of the file once per iteration:
+//   parse_double   the in-tree Clinger / Eisel–Lemire / big-decimal parser
+//   from_chars     std::from_chars(double), where the library provides it
+//   strtod         the old fallback: copy to a NUL-terminated buffer first
+//   as<double>     Value::as<double>() on each tape node (parse_double)
+// Every result is checked bit-for-bit against strtod.
+//
+// Usage:
+//   ./bench_float [file.json ...] [--iter N]   # default: canada.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using beast::json::lazy::TapeNodeType;
+
+static double strtod_copy(std::string_view s) {
+  char buf[128];
+  const size_t n = std::min(s.size(), sizeof(buf) - 1);
+  std::memcpy(buf, s.data(), n);
+  buf[n] = '\0';
+  return std::strtod(buf, nullptr);
+}
+
+static double time_ns_per(size_t N, size_t count, double &check,
+                          const std::function<double()> &fn) {
+  check = fn(); // warm-up
+  bench::Timer t;
+  t.start();
+  for (size_t i = 0; i < N; ++i)
+    check = fn();
+  return t.elapsed_ns() / N / static_cast<double>(count);
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  beast::Document doc;
+  beast::parse(doc, content);
+  std::vector<uint32_t> nodes;
+  std::vector<std::string_view> toks;
+  for (uint32_t i = 0; i < doc.tape.size(); ++i) {
+    if (doc.tape[i].type() != TapeNodeType::NumberRaw)
+      continue;
+    nodes.push_back(i);
+    toks.emplace_back(content.data() + doc.tape[i].offset,
+                      doc.node_length(i));
+  }
+  if (toks.empty()) {
+    std::cerr << "Skip " << filename << ": no float tokens\n";
+    return;
+  }
+
+  size_t mismatches = 0;
+  for (std::string_view s : toks) {
+    double v = 0;
+    beast::json::lazy::parse_double(s.data(), s.data() + s.size(), v);
+    const double ref = strtod_copy(s);
+    mismatches += std::memcmp(&v, &ref, sizeof(v)) != 0;
+  }
+
+  bench::print_header("bench_float — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Floats: " << toks.size() << "  Iterations: " << N
+            << "  Mismatches vs strtod: " << mismatches << "\n";
+
+  struct Row {
+    const char *name;
+    std::function<double()> fn;
+  };
+  std::vector<Row> rows;
+  rows.push_back({"parse_double", [&] {
+                    double sum = 0;
+                    for (std::string_view s : toks) {
+                      double v = 0;
+                      beast::json::lazy::parse_double(
+                          s.data(), s.data() + s.size(), v);
+                      sum += v;
+                    }
+                    return sum;
+                  }});
+#if __cpp_lib_to_chars >= 201611L && !defined(__APPLE__)
+  rows.push_back({"from_chars", [&] {
+                    double sum = 0;
+                    for (std::string_view s : toks) {
+                      double v = 0;
+                      std::from_chars(s.data(), s.data() + s.size(), v);
+                      sum += v;
+                    }
+                    return sum;
+                  }});
+#endif
+  rows.push_back({"strtod", [&] {
+                    double sum = 0;
+                    for (std::string_view s : toks)
+                      sum += strtod_copy(s);
+                    return sum;
+                  }});
+  rows.push_back({"as<double>", [&] {
+                    double sum = 0;
+                    for (uint32_t i : nodes)
+                      sum += beast::Value(&doc, i).as<double>();
+                    return sum;
+                  }});
+
+  double base = 0;
+  for (const Row &r : rows) {
+    double check = 0;
+    const double ns = time_ns_per(N, toks.size(), check, r.fn);
+    if (base == 0)
+      base = ns;
+    std::cout << std::setw(12) << r.name << " | " << std::setw(7) << ns
+              << " ns/float | " << std::setw(7) << (1e3 / ns)
+              << " M floats/s | x" << (base / ns) << "  (sum " << check
+              << ")\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 20;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"canada.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
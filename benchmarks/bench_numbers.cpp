@@ -0,0 +1,104 @@
+// benchmarks/bench_numbers.cpp
+// Phase 97: parse-time number decoding (enable_number_decoding()) vs the
+// default text-at-access path.
+//
+// For each file, both ways:
+//   parse        parse() alone: the cost of decoding every number up front
+//   read xN      parse(), then as<double>() on every number N times
+// Decoding moves the text parse from each read into parse(): a loss when
+// numbers are never read, a wash at one read, a win on repeated reads.
+//
+// Usage:
+//   ./bench_numbers [file.json ...] [--iter N]
+//   # default: canada.json twitter.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using beast::json::lazy::TapeNodeType;
+
+// Tape indices of every number in the last parse of `doc`.
+static std::vector<uint32_t> number_nodes(const beast::Document &doc) {
+  std::vector<uint32_t> out;
+  for (uint32_t i = 0; i < doc.tape.size(); ++i) {
+    const TapeNodeType t = doc.tape[i].type();
+    if (t == TapeNodeType::Integer || t == TapeNodeType::NumberRaw)
+      out.push_back(i);
+  }
+  return out;
+}
+
+static double read_all(beast::Document &doc, const std::vector<uint32_t> &ix,
+                       int reads) {
+  double sum = 0;
+  for (int r = 0; r < reads; ++r)
+    for (uint32_t i : ix)
+      sum += beast::Value(&doc, i).as<double>();
+  return sum;
+}
+
+static double time_us(size_t N, double &check,
+                      const std::function<double()> &fn) {
+  check += fn(); // warm-up: size the tape and numbers_
+  bench::Timer t;
+  t.start();
+  for (size_t i = 0; i < N; ++i)
+    check += fn();
+  return t.elapsed_ns() / N / 1000.0;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  beast::Document plain, dec;
+  dec.enable_number_decoding();
+  beast::parse(plain, content);
+  const std::vector<uint32_t> ix = number_nodes(plain);
+
+  bench::print_header("bench_numbers — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Numbers: " << ix.size() << "  Iterations: " << N << "\n";
+
+  for (int reads : {0, 1, 4}) {
+    double check_p = 0, check_d = 0;
+    auto run = [&](beast::Document &doc) {
+      beast::parse(doc, content);
+      return read_all(doc, ix, reads);
+    };
+    const double p_us = time_us(N, check_p, [&] { return run(plain); });
+    const double d_us = time_us(N, check_d, [&] { return run(dec); });
+    std::cout << (reads ? "read x" + std::to_string(reads) : "parse  ")
+              << " | text: " << std::setw(9) << p_us
+              << " μs | decoded: " << std::setw(9) << d_us << " μs (x"
+              << (p_us / d_us) << ")"
+              << (check_p == check_d ? "" : "  [checksum mismatch]") << "\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 50;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"canada.json", "twitter.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
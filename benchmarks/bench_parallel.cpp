@@ -0,0 +1,148 @@
+// benchmarks/bench_parallel.cpp
+// Phase 89/90: multi-threaded Stage 1 + Stage 2 scaling, 1 → N threads.
+//
+// Times the Stage 1 structural scan alone (stage1_scan_parallel) and the
+// full parse (parse_parallel: parallel Stage 1, then Stage 2 split across
+// the root array's elements) at 1, 2, 4, ... hardware_concurrency()
+// threads, against sequential beast::parse(). Stage 2 is reported as the
+// difference. Without a file argument, a synthetic root array of records
+// (strings with escapes, numbers, literals) is generated — 2 GB by
+// default; expect ~3x that in peak RSS (source + index + tape).
+//
+// Usage:
+//   ./bench_parallel [file.json ...] [--mb N] [--iter N] [--threads N]
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lazy = beast::json::lazy;
+
+// ~mb MB array of records; string-heavy enough to exercise the in-string
+// carry at chunk boundaries.
+static std::string make_synthetic(size_t mb) {
+  std::string s = "[";
+  s.reserve(mb * 1024 * 1024 + 256);
+  for (size_t i = 0; s.size() < mb * 1024 * 1024; ++i) {
+    if (i)
+      s += ",\n";
+    s += "{\"id\":" + std::to_string(i) + ",\"score\":" +
+         std::to_string(static_cast<double>(i) * 0.37) +
+         ",\"name\":\"user \\\"" + std::to_string(i * 7919) +
+         "\\\" <a href=\\\"/u\\\">[profile]</a>\",\"active\":" +
+         (i % 3 ? "true" : "false") + ",\"tags\":[\"x\",\"y\",null]}";
+  }
+  s += "]";
+  return s;
+}
+
+static void run(const std::string &label, const std::string &content,
+                size_t N, unsigned max_threads) {
+  bench::print_header("bench_parallel — " + label);
+  std::cout << "Size: " << (content.size() / (1024.0 * 1024.0)) << " MB"
+            << "  Iterations: " << N
+            << "  Stage 1: " << lazy::stage1_isa()
+            << "  Hardware threads: " << std::thread::hardware_concurrency()
+            << "\n";
+
+  beast::Document doc;
+  beast::parse(doc, content); // warm-up: size the tape and index
+  bench::Timer t;
+  t.start();
+  for (size_t i = 0; i < N; ++i)
+    beast::parse(doc, content);
+  const double seq_ns = t.elapsed_ns() / N;
+  const double mbps = content.size() / (seq_ns / 1e9) / (1024.0 * 1024.0);
+  std::cout << "beast::parse (sequential): " << (seq_ns / 1e6) << " ms  ("
+            << mbps << " MB/s)\n";
+
+  // 1, 2, 4, ... and always max_threads itself.
+  std::vector<unsigned> counts;
+  for (unsigned th = 1; th < max_threads; th *= 2)
+    counts.push_back(th);
+  counts.push_back(max_threads);
+
+  double s1_base = 0.0, parse_base = 0.0;
+  for (unsigned th : counts) {
+    lazy::Stage1Index idx;
+    if (!lazy::stage1_scan_parallel(content, idx, th)) {
+      std::cout << "No Stage 1 kernel on this CPU: parse_parallel() falls "
+                   "back to beast::parse().\n";
+      return;
+    }
+    t.start();
+    for (size_t i = 0; i < N; ++i)
+      lazy::stage1_scan_parallel(content, idx, th);
+    const double s1_ns = t.elapsed_ns() / N;
+
+    // One thread: the same two phases run back to back (parse_parallel()
+    // itself defers to beast::parse() there), so the x-factors compare
+    // like with like.
+    auto two_phase = [&] {
+      if (th > 1) {
+        beast::parse_parallel(doc, content, th);
+        return;
+      }
+      lazy::stage1_scan_parallel(content, doc.idx, 1);
+      doc.tape.reserve(doc.idx.count + size_t{1});
+      if (!lazy::Parser(&doc).parse_staged(doc.idx))
+        std::cerr << "parse_staged failed\n";
+    };
+    two_phase();
+    t.start();
+    for (size_t i = 0; i < N; ++i)
+      two_phase();
+    const double p_ns = t.elapsed_ns() / N;
+
+    if (th == 1) {
+      s1_base = s1_ns;
+      parse_base = p_ns;
+    }
+    std::cout << std::setw(3) << th << " threads | Stage 1: " << std::setw(8)
+              << std::fixed << std::setprecision(2) << (s1_ns / 1e6)
+              << " ms (x" << (s1_base / s1_ns) << ") | Stage 2: " << std::setw(8)
+              << ((p_ns - s1_ns) / 1e6) << " ms (x"
+              << ((parse_base - s1_base) / (p_ns - s1_ns))
+              << ") | parse_parallel: " << std::setw(8) << (p_ns / 1e6)
+              << " ms (x" << (parse_base / p_ns) << ")\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 5;
+  size_t mb = 2048;
+  unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else if (std::strcmp(argv[i], "--mb") == 0 && i + 1 < argc)
+      mb = static_cast<size_t>(std::atoi(argv[++i]));
+    else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+      max_threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty()) {
+    run("synthetic " + std::to_string(mb) + " MB", make_synthetic(mb), N,
+        max_threads);
+    return 0;
+  }
+  for (const auto &f : files) {
+    std::string content;
+    try {
+      content = bench::read_file(f.c_str());
+    } catch (const std::exception &e) {
+      std::cerr << "Skip " << f << ": " << e.what() << "\n";
+      continue;
+    }
+    run(f, content, N, max_threads);
+  }
+  return 0;
+}
@@ -0,0 +1,93 @@
+// benchmarks/bench_skip.cpp
+// Subtree skip benchmark: O(1) tape end-links vs depth-counting walk.
+//
+// Built twice from this source:
+//   bench_skip       — default (BEAST_JSON_TAPE_LINKS=1)
+//   bench_skip_walk  — -DBEAST_JSON_TAPE_LINKS=0 (pre-Phase 80 walk)
+//
+// For every object in the document, looks up every key by name through
+// operator[] (each lookup skips all preceding sibling values), and calls
+// size() on every container. Both are dominated by skip_value_().
+//
+// Usage:
+//   ./bench_skip [file.json ...] [--iter N]   # default: twitter + citm
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if BEAST_JSON_TAPE_LINKS
+static constexpr const char *kMode = "links";
+#else
+static constexpr const char *kMode = "walk";
+#endif
+
+// Visits every container; returns a checksum so the work is not elided.
+static size_t touch_all(beast::Value v) {
+  size_t sum = 0;
+  if (v.is_object()) {
+    sum += v.size();
+    for (auto [k, child] : v.items())
+      sum += touch_all(v[k]) + (child.is_object() || child.is_array());
+  } else if (v.is_array()) {
+    sum += v.size();
+    for (auto e : v.elements())
+      sum += touch_all(e);
+  }
+  return sum;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  bench::print_header(std::string("bench_skip (") + kMode + ") — " +
+                      filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Iterations: " << N << "\n";
+
+  beast::Document doc;
+  auto root = beast::parse(doc, content);
+
+  bench::Timer pt;
+  pt.start();
+  for (size_t i = 0; i < N; ++i)
+    root = beast::parse(doc, content);
+  const double p_ns = pt.elapsed_ns() / N;
+
+  size_t check = touch_all(root);
+  bench::Timer lt;
+  lt.start();
+  for (size_t i = 0; i < N; ++i)
+    check ^= touch_all(root);
+  const double l_ns = lt.elapsed_ns() / N;
+
+  std::cout << "parse:  " << (p_ns / 1000.0) << " μs\n"
+            << "lookup: " << (l_ns / 1000.0) << " μs  (all keys + size())"
+            << "  [checksum " << check << "]\n";
+}
+
+int main(int argc, char **argv) {
+  size_t N = 200;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"twitter.json", "citm_catalog.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
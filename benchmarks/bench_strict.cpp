@@ -0,0 +1,103 @@
+// benchmarks/bench_strict.cpp
+// Phase 101: parse_strict() in one pass, against lenient parse().
+//
+// Rows per file (μs per document, min over the iterations):
+//   parse              beast::parse(), lenient (the baseline)
+//   parse_strict       the RFC 8259 grammar building the tape as it goes
+//   validate + parse   rfc8259::validate() then parse(): what parse_strict()
+//                      did before, reading the input twice
+//   validate           rfc8259::validate() alone
+//   parse<Relaxed>     Phase 104: comments, trailing commas, NaN / Infinity
+//   parse<Unique>      Phase 104: parse_strict() rejecting duplicate keys
+//
+// Usage:
+//   ./bench_strict [file.json ...] [--iter N]   # default: twitter.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Phase 104: duplicate-key tracking is the one policy with per-key work.
+struct Unique : beast::policy::Strict {
+  static constexpr auto duplicate_keys = beast::DuplicateKeys::Reject;
+};
+
+static double min_us(size_t N, const std::function<void()> &fn) {
+  fn(); // warm-up
+  double best = 1e300;
+  for (size_t i = 0; i < N; ++i) {
+    bench::Timer t;
+    t.start();
+    fn();
+    best = std::min(best, t.elapsed_us());
+  }
+  return best;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+    beast::rfc8259::validate(content);
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  bench::print_header("bench_strict — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Iterations: " << N << "\n";
+
+  beast::Document doc;
+  struct Row {
+    const char *name;
+    std::function<void()> fn;
+  };
+  const std::vector<Row> rows = {
+      {"parse", [&] { beast::parse(doc, content); }},
+      {"parse_strict", [&] { beast::parse_strict(doc, content); }},
+      {"validate + parse",
+       [&] {
+         beast::rfc8259::validate(content);
+         beast::parse(doc, content);
+       }},
+      {"validate", [&] { beast::rfc8259::validate(content); }},
+      {"parse<Relaxed>",
+       [&] { beast::parse<beast::policy::Relaxed>(doc, content); }},
+      {"parse<Unique>", [&] { beast::parse<Unique>(doc, content); }},
+  };
+
+  double base = 0;
+  for (const Row &r : rows) {
+    const double us = min_us(N, r.fn);
+    if (base == 0)
+      base = us;
+    std::cout << std::setw(16) << r.name << " | " << std::setw(9) << us
+              << " μs | " << std::setw(8) << (content.size() / us)
+              << " MB/s | " << std::showpos << std::setprecision(3)
+              << (us / base - 1) * 100 << std::noshowpos
+              << std::setprecision(6) << "% vs parse\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 100;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"twitter.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
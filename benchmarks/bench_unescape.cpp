@@ -0,0 +1,172 @@
+// benchmarks/bench_unescape.cpp
+// Phase 99: Value::as_unescaped() — decoded strings, cached per document.
+//
+// Two tables per file, over every string value and key of the document:
+//   kernel     unescape_string() vs a byte-at-a-time loop, on the raw
+//              content of every string that holds a backslash (MB/s)
+//   reads      parse() then N reads of every string:
+//                as<string_view>   the raw bytes, no decoding
+//                as_unescaped      zero-copy when escape-free; otherwise
+//                                  decoded on the first read, cached after
+//
+// Usage:
+//   ./bench_unescape [file.json ...] [--iter N]   # default: twitter.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using beast::json::lazy::TapeNodeType;
+
+// The loop a caller writes without the kernel: one byte per iteration.
+static size_t byte_loop(std::string_view s, char *out) {
+  char *w = out;
+  for (size_t i = 0; i < s.size(); ++i) {
+    if (s[i] != '\\') {
+      *w++ = s[i];
+      continue;
+    }
+    const char c = s[++i];
+    if (c != 'u') {
+      const char *esc = std::strchr("b\bf\fn\nr\rt\t", c);
+      *w++ = esc ? esc[1] : c; // \" \\ \/ stand for themselves
+      continue;
+    }
+    char hex[5] = {s[i + 1], s[i + 2], s[i + 3], s[i + 4], 0};
+    unsigned cp = static_cast<unsigned>(std::strtoul(hex, nullptr, 16));
+    i += 4;
+    if (cp >= 0xD800 && cp <= 0xDBFF && i + 6 < s.size()) {
+      char lo[5] = {s[i + 3], s[i + 4], s[i + 5], s[i + 6], 0};
+      cp = 0x10000 + ((cp - 0xD800) << 10) +
+           (static_cast<unsigned>(std::strtoul(lo, nullptr, 16)) - 0xDC00);
+      i += 6;
+    }
+    if (cp < 0x80) {
+      *w++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      *w++ = static_cast<char>(0xC0 | (cp >> 6));
+      *w++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      *w++ = static_cast<char>(0xE0 | (cp >> 12));
+      *w++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *w++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      *w++ = static_cast<char>(0xF0 | (cp >> 18));
+      *w++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      *w++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *w++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+  }
+  return static_cast<size_t>(w - out);
+}
+
+static double time_us(size_t N, size_t &check,
+                      const std::function<size_t()> &fn) {
+  check += fn(); // warm-up
+  bench::Timer t;
+  t.start();
+  for (size_t i = 0; i < N; ++i)
+    check += fn();
+  return t.elapsed_ns() / N / 1000.0;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+
+  beast::Document doc;
+  beast::parse(doc, content);
+  std::vector<uint32_t> nodes; // every StringRaw, keys included
+  std::vector<std::string_view> escaped;
+  size_t escaped_bytes = 0;
+  for (uint32_t i = 0; i < doc.tape.size(); ++i) {
+    if (doc.tape[i].type() != TapeNodeType::StringRaw)
+      continue;
+    nodes.push_back(i);
+    std::string_view s(content.data() + doc.tape[i].offset,
+                       doc.node_length(i));
+    if (s.find('\\') != std::string_view::npos) {
+      escaped.push_back(s);
+      escaped_bytes += s.size();
+    }
+  }
+
+  bench::print_header("bench_unescape — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Strings: " << nodes.size() << "  Escaped: " << escaped.size()
+            << " (" << escaped_bytes << " B)  Iterations: " << N << "\n";
+
+  if (!escaped.empty()) {
+    std::vector<char> buf(escaped_bytes + 64);
+    size_t check_k = 0, check_b = 0;
+    const double k_us = time_us(N, check_k, [&] {
+      size_t n = 0;
+      for (std::string_view s : escaped)
+        n += static_cast<size_t>(
+            beast::json::lazy::unescape_string(s.data(), s.data() + s.size(),
+                                               buf.data()) -
+            buf.data());
+      return n;
+    });
+    const double b_us = time_us(N, check_b, [&] {
+      size_t n = 0;
+      for (std::string_view s : escaped)
+        n += byte_loop(s, buf.data());
+      return n;
+    });
+    std::cout << "kernel     | unescape_string: " << std::setw(8)
+              << (escaped_bytes / k_us) << " MB/s | byte loop: "
+              << std::setw(8) << (escaped_bytes / b_us) << " MB/s (x"
+              << (b_us / k_us) << ")"
+              << (check_k == check_b ? "" : "  [length mismatch]") << "\n";
+  }
+
+  for (int reads : {1, 4}) {
+    size_t check_r = 0, check_u = 0;
+    const double r_us = time_us(N, check_r, [&] {
+      beast::parse(doc, content);
+      size_t n = 0;
+      for (int r = 0; r < reads; ++r)
+        for (uint32_t i : nodes)
+          n += beast::Value(&doc, i).as<std::string_view>().size();
+      return n;
+    });
+    const double u_us = time_us(N, check_u, [&] {
+      beast::parse(doc, content);
+      size_t n = 0;
+      for (int r = 0; r < reads; ++r)
+        for (uint32_t i : nodes)
+          n += beast::Value(&doc, i).as_unescaped().size();
+      return n;
+    });
+    std::cout << "parse+read x" << reads << " | as<string_view>: "
+              << std::setw(9) << r_us << " μs | as_unescaped: "
+              << std::setw(9) << u_us << " μs (x" << (r_us / u_us) << ")\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 100;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"twitter.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
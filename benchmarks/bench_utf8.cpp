@@ -0,0 +1,102 @@
+// benchmarks/bench_utf8.cpp
+// Phase 100: the cost of UTF-8 validation on top of parse().
+//
+// Rows per file (μs per document, min over the iterations):
+//   parse            beast::parse(), no validation (the default)
+//   parse+utf8       Document::enable_utf8_validation(): checked inside the
+//                    Stage 1 kernel, or by a separate pass without one
+//   validate_utf8    the standalone vectorized pass alone
+//   two passes       validate_utf8() then parse()
+//   rfc8259          rfc8259::validate(), the strict validator
+//
+// Usage:
+//   ./bench_utf8 [file.json ...] [--iter N]   # default: twitter.json
+
+#include "utils.hpp"
+#include <beast_json/beast_json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static volatile bool sink; // keeps validate_utf8() from being elided
+
+static double min_us(size_t N, const std::function<void()> &fn) {
+  fn(); // warm-up
+  double best = 1e300;
+  for (size_t i = 0; i < N; ++i) {
+    bench::Timer t;
+    t.start();
+    fn();
+    best = std::min(best, t.elapsed_us());
+  }
+  return best;
+}
+
+static void run_file(const std::string &filename, size_t N) {
+  std::string content;
+  try {
+    content = bench::read_file(filename.c_str());
+  } catch (const std::exception &e) {
+    std::cerr << "Skip " << filename << ": " << e.what() << "\n";
+    return;
+  }
+  if (!beast::validate_utf8(content)) {
+    std::cerr << "Skip " << filename << ": not valid UTF-8\n";
+    return;
+  }
+
+  bench::print_header("bench_utf8 — " + filename);
+  std::cout << "Size: " << (content.size() / 1024.0) << " KB"
+            << "  Stage 1: " << beast::json::lazy::stage1_isa()
+            << "  Iterations: " << N << "\n";
+
+  beast::Document plain, checked;
+  checked.enable_utf8_validation();
+  struct Row {
+    const char *name;
+    std::function<void()> fn;
+  };
+  const std::vector<Row> rows = {
+      {"parse", [&] { beast::parse(plain, content); }},
+      {"parse+utf8", [&] { beast::parse(checked, content); }},
+      {"validate_utf8", [&] { sink = beast::validate_utf8(content); }},
+      {"two passes",
+       [&] {
+         if (beast::validate_utf8(content))
+           beast::parse(plain, content);
+       }},
+      {"rfc8259", [&] { beast::rfc8259::validate(content); }},
+  };
+
+  double base = 0;
+  for (const Row &r : rows) {
+    const double us = min_us(N, r.fn);
+    if (base == 0)
+      base = us;
+    std::cout << std::setw(14) << r.name << " | " << std::setw(9) << us
+              << " μs | " << std::setw(8) << (content.size() / us)
+              << " MB/s | " << std::showpos << std::setprecision(3)
+              << (us / base - 1) * 100 << std::noshowpos
+              << std::setprecision(6) << "% vs parse\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t N = 100;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--iter") == 0 && i + 1 < argc)
+      N = static_cast<size_t>(std::atoi(argv[++i]));
+    else
+      files.emplace_back(argv[i]);
+  }
+  if (files.empty())
+    files = {"twitter.json"};
+  for (const auto &f : files)
+    run_file(f, N);
+  return 0;
+}
@@ -45,7 +45,13 @@ struct BJSONDocument_ {
 // ── Document lifecycle ────────────────────────────────────────────────────────
 
 BJSONDocument* bjson_doc_create() {
-  try { return new BJSONDocument_{}; }
+  try {
+    auto* d = new BJSONDocument_{};
+    // Index loops from Python (v[i] for i in range(len(v))) stay linear.
+    // A handle is used from one thread, so the lazy table is safe here.
+    d->doc.enable_elem_index();
+    return d;
+  }
   catch (...) { return nullptr; }
 }
 
@@ -158,7 +164,7 @@ BJSONValue* bjson_get_idx(BJSONDocument* doc,
                           const BJSONValue* val, size_t idx) {
   if (!doc || !val || !val->valid) return doc ? doc->invalid_val() : nullptr;
   try {
-    beast::Value child = val->val[static_cast<int>(idx)];
+    beast::Value child = val->val[idx];
     if (!child.is_valid()) return doc->invalid_val();
     return doc->alloc(child);
   } catch (...) { return doc->invalid_val(); }
@@ -47,7 +47,9 @@ typedef enum {
 
 /* ── Document lifecycle ─────────────────────────────────────────────────────── */
 
-/** Allocate a new document context. Returns NULL on OOM. */
+/** Allocate a new document context. Returns NULL on OOM.
+ *  Array indexing builds an element table on first far access, so
+ *  index loops are linear; use one document from one thread at a time. */
 BJSONDocument* bjson_doc_create(void);
 
 /** Free a document context and all associated memory. */
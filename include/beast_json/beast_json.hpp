@@ -37,6 +37,7 @@
 #include <bit>
 #include <bitset>
 #include <cassert>
+#include <cfloat>
 #include <charconv> // For from_chars in number parsing
 #include <climits>
 #include <cmath>
@@ -45,7 +46,9 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -55,6 +58,7 @@
 #include <ranges>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -66,6 +70,23 @@
 #include <variant>
 #include <vector>
 
+// Phase 94: parse_file() memory-maps its input on POSIX systems (define
+// BEAST_JSON_HAS_MMAP=0 to read it into a buffer instead).
+#ifndef BEAST_JSON_HAS_MMAP
+#if defined(__unix__) || defined(__APPLE__)
+#define BEAST_JSON_HAS_MMAP 1
+#else
+#define BEAST_JSON_HAS_MMAP 0
+#endif
+#endif
+#if BEAST_JSON_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+
 // ============================================================================
 // Zero-SIMD C++20 Architecture
 // ============================================================================
@@ -247,6 +268,66 @@ using Allocator = std::pmr::polymorphic_allocator<char>;
 #define BEAST_CLZ(x) std::countl_zero(static_cast<unsigned long long>(x))
 #define BEAST_CTZ(x) std::countr_zero(static_cast<unsigned long long>(x))
 
+// Phase 80: subtree end-links on ObjectStart/ArrayStart tape nodes.
+// When enabled (default), the parser back-patches the tape index of the
+// matching ObjectEnd/ArrayEnd into the open node's offset field, so
+// Value::skip_value_() is a single load instead of a depth-counting walk.
+// Define BEAST_JSON_TAPE_LINKS=0 to restore the walk (A/B benchmarking).
+#ifndef BEAST_JSON_TAPE_LINKS
+#define BEAST_JSON_TAPE_LINKS 1
+#endif
+
+// Phase 85: tape offset width policy.
+// Default: 32-bit source offsets / Stage 1 positions → 8-byte TapeNode,
+// inputs up to 4 GB. Define BEAST_JSON_TAPE64=1 for 64-bit offsets
+// (16-byte TapeNode) to parse larger inputs, e.g. mmap'd data dumps.
+// Tape indices stay 32-bit in both modes (≤ 4G tokens per document).
+// Like BEAST_JSON_TAPE_LINKS, it must be identical in every TU: the lazy
+// API lives in an inline namespace named after the mode, so a function
+// taking a DocumentView / Value built with one setting does not link
+// against callers built with the other (instead of an ODR violation).
+#ifndef BEAST_JSON_TAPE64
+#define BEAST_JSON_TAPE64 0
+#endif
+#if BEAST_JSON_TAPE64
+#define BEAST_JSON_TAPE_ABI tape64
+#else
+#define BEAST_JSON_TAPE_ABI tape32
+#endif
+
+// Phase 88: runtime ISA dispatch — the SIMD scanners only.
+// A baseline x86-64 build (no -mavx2 / -march=native) still compiles the
+// AVX-512 and AVX2 Stage 1 kernels via target attributes and picks one once,
+// by cpuid, on first parse. Such a binary runs everywhere and still takes the
+// two-phase path on AVX2 / AVX-512 hosts. Builds that already target AVX2+
+// select at compile time as before. Define BEAST_JSON_RUNTIME_DISPATCH=0 to
+// disable (baseline builds then always use single-pass parse()).
+// The UTF-8 check (Phase 100), the RFC 8259 block validator and the
+// strict parser's string scan (Phase 102) are dispatched the same way.
+// Nothing else is: skip_to_action() and scan_string_end() serve the
+// single-pass parser, which a dispatched build only runs on hosts without
+// AVX2 (the staged Stage 2 reads string ends from the index), and the
+// serializer has no per-ISA variants to pick from. There is no SSE4.2
+// tier.
+#ifndef BEAST_JSON_RUNTIME_DISPATCH
+#if defined(BEAST_ARCH_X86_64) && !BEAST_HAS_AVX2 && defined(__GNUC__)
+#define BEAST_JSON_RUNTIME_DISPATCH 1
+#else
+#define BEAST_JSON_RUNTIME_DISPATCH 0
+#endif
+#endif
+#if BEAST_JSON_RUNTIME_DISPATCH
+#include <immintrin.h>
+#define BEAST_TARGET_AVX512                                                    \
+  __attribute__((target("avx512f,avx512bw,avx2,bmi,bmi2,popcnt"))) inline
+#define BEAST_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt"))) inline
+#else
+// Only ever called through a Stage1Fn pointer: always_inline would fail to
+// build wherever the pointer folds to a constant without being inlined.
+#define BEAST_TARGET_AVX512 inline
+#define BEAST_TARGET_AVX2 inline
+#endif
+
 namespace beast {
 namespace json {
 namespace simd {
@@ -269,14 +350,29 @@ BEAST_INLINE uint64_t prefix_xor(uint64_t x) noexcept {
 namespace beast {
 namespace json {
 namespace lazy {
+inline namespace BEAST_JSON_TAPE_ABI { // Phase 85: see BEAST_JSON_TAPE64
+
+// Phase 85: byte offset into the source (see BEAST_JSON_TAPE64).
+#if BEAST_JSON_TAPE64
+using tape_off_t = uint64_t;
+#else
+using tape_off_t = uint32_t;
+#endif
 
 // ─────────────────────────────────────────────────────────────
 // TapeNode — 8 bytes (Phase D1 compaction)
 //
 // meta layout (uint32_t):
 //   bits 31-24 : TapeNodeType  (8 bits, values 0-10)
-//   bits 23-16 : flags         (8 bits, currently always 0)
-//   bits 15-0  : length        (16 bits, max 65535)
+//   bits 23-16 : flags         (bits 1-0 separator: 0=none 1=comma 2=colon;
+//                               bit 2 long length, Phase 84;
+//                               bit 3 number decoded, Phase 97)
+//   bits 15-0  : length        (16 bits, max 65535); for ObjectStart /
+//                ArrayStart: element count, saturated at 0xFFFF (Phase 83)
+//
+// offset: byte offset into source for scalars/keys. For ObjectStart and
+// ArrayStart (BEAST_JSON_TAPE_LINKS) it holds the tape index of the matching
+// close node instead — the '{' / '[' position is never read back.
 //
 // Dropped: next_sib (4 bytes) — was written but never read.
 // Halves store operations per push(): 5 → 2.
@@ -299,13 +395,14 @@ enum class TapeNodeType : uint8_t {
 
 struct TapeNode {
   uint32_t meta;   // bits 31-24: type | bits 23-16: flags | bits 15-0: length
-  uint32_t offset; // byte offset into source (max 4 GB)
-                   // = 8 bytes total
+  tape_off_t offset; // byte offset into source (max 4 GB unless TAPE64),
+                     // or close-node tape index for ObjectStart/ArrayStart
+                     // (Phase 80) = 8 bytes total (16 with TAPE64)
 
   TapeNode() = default;
 
   // Packed-meta constructor used by push()
-  TapeNode(TapeNodeType t, uint16_t l, uint32_t o)
+  TapeNode(TapeNodeType t, uint16_t l, tape_off_t o)
       : meta((static_cast<uint32_t>(t) << 24) | static_cast<uint32_t>(l)),
         offset(o) {}
 
@@ -313,12 +410,37 @@ struct TapeNode {
   BEAST_INLINE TapeNodeType type() const noexcept {
     return static_cast<TapeNodeType>((meta >> 24) & 0xFFu);
   }
-  BEAST_INLINE uint8_t flags() const noexcept { return (meta >> 16) & 0xFFu; }
+  // The separator bits only (0=none 1=comma 2=colon): the other flag bits
+  // have their own accessors, is_long() and is_decoded().
+  BEAST_INLINE uint8_t flags() const noexcept {
+    return (meta >> 16) & kSepMask;
+  }
   BEAST_INLINE uint16_t length() const noexcept {
     return static_cast<uint16_t>(meta & 0xFFFFu);
   }
+
+  // Phase 83: ObjectStart/ArrayStart length = element count (keys for
+  // objects). kCountSaturated means ">= 65535 — count by walking".
+  static constexpr uint16_t kCountSaturated = 0xFFFFu;
+
+  // Phase 84: flags bits 1-0 are the separator; flags bit 2 marks a
+  // StringRaw/number token longer than 0xFFFF bytes. Its length bits read
+  // 0xFFFF and the full length lives in DocumentView::long_lens_.
+  static constexpr uint32_t kSepMask = 0x3u;
+  static constexpr uint32_t kLongLenFlag = 1u << 18;
+  BEAST_INLINE bool is_long() const noexcept {
+    return (meta & kLongLenFlag) != 0;
+  }
+
+  // Phase 97: flags bit 3 marks an Integer/NumberRaw whose value was decoded
+  // at parse time into DocumentView::numbers_ (enable_number_decoding()).
+  static constexpr uint32_t kDecodedFlag = 1u << 19;
+  BEAST_INLINE bool is_decoded() const noexcept {
+    return (meta & kDecodedFlag) != 0;
+  }
 };
-static_assert(sizeof(TapeNode) == 8, "TapeNode must be exactly 8 bytes");
+static_assert(sizeof(TapeNode) == (BEAST_JSON_TAPE64 ? 16 : 8),
+              "TapeNode must be exactly 8 bytes (16 with BEAST_JSON_TAPE64)");
 
 // ─────────────────────────────────────────────────────────────
 // TapeArena — Beast Flat Arena (Phase B)
@@ -350,10 +472,31 @@ struct TapeArena {
 
   BEAST_INLINE void reset() noexcept { head = base; }
 
+  // Phase 86: grow in place, keeping the nodes written so far. Capacity at
+  // least doubles, so a parse that outgrows its estimate pays amortised
+  // O(1) per node; glibc realloc of large blocks is an mremap, not a copy.
+  BEAST_NOINLINE void grow(size_t min_cap) {
+    const size_t used = size();
+    size_t n = capacity() * 2;
+    if (n < min_cap)
+      n = min_cap;
+    auto *nb =
+        static_cast<TapeNode *>(std::realloc(base, n * sizeof(TapeNode)));
+    if (!nb)
+      throw std::bad_alloc();
+    base = nb;
+    head = nb + used;
+    cap = nb + n;
+  }
+
   BEAST_INLINE size_t size() const noexcept {
     return static_cast<size_t>(head - base);
   }
 
+  BEAST_INLINE size_t capacity() const noexcept {
+    return static_cast<size_t>(cap - base);
+  }
+
   BEAST_INLINE TapeNode &operator[](size_t i) noexcept { return base[i]; }
   BEAST_INLINE const TapeNode &operator[](size_t i) const noexcept {
     return base[i];
@@ -366,9 +509,9 @@ struct TapeArena {
 // ─────────────────────────────────────────────────────────────
 
 struct Stage1Index {
-  uint32_t *positions = nullptr;
-  uint32_t count = 0;
-  uint32_t capacity = 0;
+  tape_off_t *positions = nullptr;
+  tape_off_t count = 0; // at most one entry per source byte (Phase 85)
+  size_t capacity = 0;
 
   Stage1Index() = default;
   ~Stage1Index() { std::free(positions); }
@@ -383,18 +526,217 @@ struct Stage1Index {
   }
 
   void reserve(size_t n) {
-    if (positions && capacity >= static_cast<uint32_t>(n))
+    if (positions && capacity >= n)
       return;
     std::free(positions);
-    positions = static_cast<uint32_t *>(std::malloc(n * sizeof(uint32_t)));
+    positions =
+        static_cast<tape_off_t *>(std::malloc(n * sizeof(tape_off_t)));
     if (!positions)
       throw std::bad_alloc();
-    capacity = static_cast<uint32_t>(n);
+    capacity = n;
+  }
+
+  // Phase 86: the scanners start from an estimate and grow between 64-byte
+  // blocks (each block adds at most 64 entries). Keeps existing entries.
+  BEAST_NOINLINE void grow(size_t min_cap) {
+    size_t n = capacity * 2;
+    if (n < min_cap)
+      n = min_cap;
+    auto *np = static_cast<tape_off_t *>(
+        std::realloc(positions, n * sizeof(tape_off_t)));
+    if (!np)
+      throw std::bad_alloc();
+    positions = np;
+    capacity = n;
   }
 
   void reset() noexcept { count = 0; }
 };
 
+// Phase 89: scanner state at the first byte of a Stage 1 range. The default
+// is the start of a document; parse_parallel() derives it per chunk.
+struct Stage1Carry {
+  uint64_t in_string = 0;             // all-1: range starts inside a string
+  bool escaped = false;               // first byte is backslash-escaped
+  uint64_t prev_ws_like = 1ULL << 63; // bit 63: preceding byte ws/symbol
+  // Phase 100: UTF-8 state of the *_utf8 kernels; the others leave it 0.
+  uint32_t utf8_prev = 0;  // last 3 bytes before the range (utf8_tail_())
+  bool utf8_error = false; // an invalid sequence so far (sticky)
+};
+
+// ─────────────────────────────────────────────────────────────
+// Phase 95: PaddedString — input for parse_padded()
+//
+// parse_padded() drops the end-of-input checks and scalar tail loops from
+// the scanners (see Parser::can_load_()). It needs kPadding readable zero
+// bytes after the last input byte; a PaddedString owns such a buffer.
+// Move-only: a copy of a large message should be explicit.
+// ─────────────────────────────────────────────────────────────
+inline constexpr size_t kPadding = 64;
+
+class PaddedString {
+public:
+  PaddedString() = default;
+  /// Copies `s` into a new padded buffer.
+  explicit PaddedString(std::string_view s) : PaddedString(s.size()) {
+    if (!s.empty())
+      std::memcpy(buf_.get(), s.data(), s.size());
+  }
+  /// `n` zero bytes, to fill in place through data() (e.g. with read()).
+  explicit PaddedString(size_t n)
+      : buf_(std::make_unique<char[]>(n + kPadding)), size_(n) {}
+
+  char *data() noexcept { return buf_.get(); }
+  const char *data() const noexcept { return buf_.get(); }
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  std::string_view view() const noexcept { return {buf_.get(), size_}; }
+  operator std::string_view() const noexcept { return view(); }
+
+private:
+  std::unique_ptr<char[]> buf_; // size_ bytes + kPadding zeros
+  size_t size_ = 0;
+};
+
+// ─────────────────────────────────────────────────────────────
+// Phase 94: MappedFile — read-only file input for parse_file()
+//
+// The file is mapped read-only (POSIX mmap) and advised for one sequential
+// pass; populate pre-faults every page in the mmap() call (MAP_POPULATE,
+// Linux) instead of taking a fault per page during the parse. Like a
+// PaddedString, the view is followed by kPadding zero bytes: when the
+// file's last page has less slack than that, an anonymous zero page is
+// mapped right behind it. Elsewhere (and for empty files) the bytes are
+// read into an owned, padded buffer. Move-only; the view stays valid when
+// a MappedFile is moved.
+// ─────────────────────────────────────────────────────────────
+
+class MappedFile {
+public:
+  MappedFile() = default;
+
+  /// @throws std::runtime_error if the file cannot be opened or read.
+  explicit MappedFile(const char *path, bool populate = false) {
+#if BEAST_JSON_HAS_MMAP
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      throw std::runtime_error(std::string("Failed to open file: ") + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+      ::close(fd);
+      throw std::runtime_error(std::string("Failed to read file: ") + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ != 0 && map_(fd, populate)) {
+      ::close(fd); // the mapping keeps its own reference
+      return;
+    }
+    ::close(fd);
+#else
+    (void)populate;
+#endif
+    read_(path);
+  }
+
+  MappedFile(MappedFile &&o) noexcept
+      : map_base_(std::exchange(o.map_base_, nullptr)),
+        map_len_(std::exchange(o.map_len_, 0)), buf_(std::move(o.buf_)),
+        size_(std::exchange(o.size_, 0)) {}
+  MappedFile &operator=(MappedFile &&o) noexcept {
+    if (this != &o) {
+      release_();
+      map_base_ = std::exchange(o.map_base_, nullptr);
+      map_len_ = std::exchange(o.map_len_, 0);
+      buf_ = std::move(o.buf_);
+      size_ = std::exchange(o.size_, 0);
+    }
+    return *this;
+  }
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile() { release_(); }
+
+  /// The file's bytes, followed by at least kPadding zero bytes.
+  std::string_view view() const noexcept {
+    const char *p = map_base_ ? static_cast<const char *>(map_base_)
+                              : buf_.get();
+    return {p ? p : "", size_};
+  }
+  /// True while the file was mapped rather than read into a buffer.
+  bool mapped() const noexcept { return map_base_ != nullptr; }
+
+private:
+#if BEAST_JSON_HAS_MMAP
+  bool map_(int fd, bool populate) {
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t file_len = (size_ + page - 1) / page * page;
+    const bool pad = file_len - size_ < kPadding;
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (populate)
+      flags |= MAP_POPULATE;
+#else
+    (void)populate;
+#endif
+    void *base;
+    if (pad) {
+      // Reserve file + one zero page, then map the file over the front.
+      map_len_ = file_len + page;
+      base = ::mmap(nullptr, map_len_, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1, 0);
+      if (base == MAP_FAILED)
+        return false;
+      if (::mmap(base, file_len, PROT_READ, flags | MAP_FIXED, fd, 0) ==
+          MAP_FAILED) {
+        ::munmap(base, map_len_);
+        return false;
+      }
+    } else {
+      map_len_ = file_len;
+      base = ::mmap(nullptr, map_len_, PROT_READ, flags, fd, 0);
+      if (base == MAP_FAILED)
+        return false;
+    }
+    map_base_ = base;
+    ::madvise(base, file_len, MADV_SEQUENTIAL);
+    if (!populate)
+      ::madvise(base, file_len, MADV_WILLNEED); // start read-ahead now
+    return true;
+  }
+#endif
+
+  void read_(const char *path) {
+    std::FILE *f = std::fopen(path, "rb");
+    if (!f)
+      throw std::runtime_error(std::string("Failed to open file: ") + path);
+    std::string bytes;
+    char chunk[1 << 16];
+    for (size_t n; (n = std::fread(chunk, 1, sizeof(chunk), f)) != 0;)
+      bytes.append(chunk, n);
+    const bool failed = std::ferror(f) != 0;
+    std::fclose(f);
+    if (failed)
+      throw std::runtime_error(std::string("Failed to read file: ") + path);
+    size_ = bytes.size();
+    buf_ = std::make_unique<char[]>(size_ + kPadding); // zero-filled
+    std::memcpy(buf_.get(), bytes.data(), size_);
+  }
+
+  void release_() noexcept {
+#if BEAST_JSON_HAS_MMAP
+    if (map_base_)
+      ::munmap(map_base_, map_len_);
+#endif
+    map_base_ = nullptr;
+    map_len_ = 0;
+  }
+
+  void *map_base_ = nullptr;
+  size_t map_len_ = 0;
+  std::unique_ptr<char[]> buf_; // read_() fallback: bytes + padding
+  size_t size_ = 0;
+};
+
 // ─────────────────────────────────────────────────────────────
 // DocumentView
 // ─────────────────────────────────────────────────────────────
@@ -408,6 +750,34 @@ struct MutationEntry {
                     // empty for Null/BooleanTrue/BooleanFalse
 };
 
+// Phase 99: bump allocator for decoded strings (Value::as_unescaped()).
+// Chunks double in size and are never moved, so views into them stay valid
+// until reset(), which rewinds to the first chunk but keeps the memory for
+// the next parse.
+struct StringArena {
+  static constexpr size_t kFirstChunk = 4096;
+  std::vector<std::pair<std::unique_ptr<char[]>, size_t>> chunks;
+  size_t cur = 0;  // chunk being filled
+  size_t used = 0; // bytes taken from chunks[cur]
+
+  char *alloc(size_t n) {
+    for (; cur < chunks.size(); ++cur, used = 0) {
+      if (chunks[cur].second - used >= n) {
+        char *p = chunks[cur].first.get() + used;
+        used += n;
+        return p;
+      }
+    }
+    const size_t sz =
+        std::max(n, kFirstChunk << std::min<size_t>(chunks.size(), 12));
+    chunks.emplace_back(std::unique_ptr<char[]>(new char[sz]), sz);
+    cur = chunks.size() - 1;
+    used = n;
+    return chunks.back().first.get();
+  }
+  void reset() noexcept { cur = used = 0; }
+};
+
 // ─────────────────────────────────────────────────────────────
 // DocumentView
 // ─────────────────────────────────────────────────────────────
@@ -443,6 +813,122 @@ public:
   std::unordered_map<uint32_t, std::vector<std::pair<std::string, std::string>>>
       additions_;
 
+  // Phase 81: lazy per-object key index — opt-in via enable_key_index().
+  // key_index_min_ == 0 disables it (default). Otherwise, the first key
+  // lookup that scans past key_index_min_ keys of an object builds a hash
+  // index for that object, keyed by its ObjectStart tape index. Each entry
+  // maps a raw key (view into source) to its FIRST key tape index, so
+  // duplicate keys resolve exactly like the linear scan. Cleared by
+  // parse_reuse(). Building mutates the document: not safe for concurrent
+  // readers of one DocumentView.
+  size_t key_index_min_ = 0;
+  std::unordered_map<uint32_t, std::unordered_map<std::string_view, uint32_t>>
+      key_index_;
+
+  /// @brief Enables hashed key lookup on objects with at least `min_keys`
+  /// keys. The index for each object is built on first qualifying lookup.
+  void enable_key_index(size_t min_keys = 32) noexcept {
+    key_index_min_ = min_keys ? min_keys : 1;
+  }
+  /// @brief Disables hashed key lookup and frees all built indices.
+  void disable_key_index() noexcept {
+    key_index_min_ = 0;
+    key_index_.clear();
+  }
+
+  // Phase 82: lazy per-array element table — opt-in via enable_elem_index().
+  // elem_index_min_ == 0 disables it (default). Otherwise,
+  // elem_index_[ArrayStart tape index] = tape indices of the live elements,
+  // in order. Built the first time operator[](i) is called with
+  // i >= elem_index_min_, or when size() has to count (after erase) at least
+  // elem_index_min_ elements; smaller arrays stay on the linear walk.
+  // Dropped for an array by erase(idx); cleared by parse_reuse(). Like
+  // key_index_, building mutates the document: not safe for concurrent
+  // readers of one DocumentView.
+  size_t elem_index_min_ = 0;
+  std::unordered_map<uint32_t, std::vector<uint32_t>> elem_index_;
+
+  /// @brief Enables O(1) array indexing for arrays with at least
+  /// `min_elems` elements. The table for each array is built on first
+  /// qualifying access.
+  void enable_elem_index(size_t min_elems = 16) noexcept {
+    elem_index_min_ = min_elems ? min_elems : 1;
+  }
+  /// @brief Disables array element tables and frees all built tables.
+  void disable_elem_index() noexcept {
+    elem_index_min_ = 0;
+    elem_index_.clear();
+  }
+
+  // Phase 84: (tape index, byte length) for every StringRaw/number token
+  // longer than 0xFFFF bytes, appended in tape order by the parser — sorted,
+  // so long_length() is a binary search. Empty for almost every document.
+  std::vector<std::pair<uint32_t, tape_off_t>> long_lens_;
+
+  // Phase 97: parse-time number decoding — opt-in via
+  // enable_number_decoding(). numbers_[i] holds the int64_t (Integer) or
+  // double (NumberRaw) bits of tape node i when the node carries
+  // TapeNode::kDecodedFlag; other slots are stale. Grown by the parser to
+  // the tape's capacity, so it is as long as the tape at worst, and kept
+  // across parse_reuse() like the tape itself.
+  bool decode_numbers_ = false;
+  std::vector<uint64_t> numbers_;
+
+  /// @brief Decodes every number while parsing, so that `as<int64_t>()` and
+  /// `as<double>()` load a stored value instead of parsing the text. Costs
+  /// parse time and 8 bytes per tape node; pays off when numbers are read
+  /// more than once. Takes effect from the next parse.
+  void enable_number_decoding() noexcept { decode_numbers_ = true; }
+  /// @brief Stops decoding numbers from the next parse on. Values of the
+  /// current parse stay readable until then.
+  void disable_number_decoding() noexcept { decode_numbers_ = false; }
+
+  // Phase 100: UTF-8 validation — opt-in via enable_utf8_validation().
+  // Runs inside the Stage 1 kernel where parse() has one, otherwise as a
+  // validate_utf8() pass before parsing.
+  bool validate_utf8_ = false;
+
+  /// @brief Makes parsing fail on input that is not well-formed UTF-8
+  /// (RFC 8259 §8.1); by default any bytes are accepted inside strings.
+  /// Costs a few percent of parse time. Takes effect from the next parse.
+  void enable_utf8_validation() noexcept { validate_utf8_ = true; }
+  /// @brief Accepts any bytes inside strings again from the next parse on.
+  void disable_utf8_validation() noexcept { validate_utf8_ = false; }
+
+  // Phase 99: strings decoded by Value::as_unescaped(), keyed by tape index,
+  // viewing into strings_. Only escaped strings land here: escape-free ones
+  // are read straight from the source and leave the document untouched.
+  // Cleared by parse_reuse(); like key_index_, filling it mutates the
+  // document — not safe for concurrent readers of one DocumentView.
+  std::unordered_map<uint32_t, std::string_view> unescaped_;
+  StringArena strings_;
+
+  // Decoded form of the escaped string `raw` at tape index i: from the
+  // cache, or unescaped into strings_ once. Defined after unescape_string().
+  std::string_view unescape_(uint32_t i, std::string_view raw);
+
+  // Phase 94: the input of the last parse_file(), which `source` views.
+  // Kept until the next parse_file() or the document's destruction.
+  MappedFile file_;
+
+  /// Full length of a TapeNode flagged kLongLenFlag.
+  size_t long_length(uint32_t i) const noexcept {
+    auto it = std::lower_bound(
+        long_lens_.begin(), long_lens_.end(), i,
+        [](const std::pair<uint32_t, tape_off_t> &e, uint32_t k) {
+          return e.first < k;
+        });
+    return (it != long_lens_.end() && it->first == i)
+               ? static_cast<size_t>(it->second)
+               : 0xFFFFu;
+  }
+
+  /// Byte length of a StringRaw/number token, long or short.
+  BEAST_INLINE size_t node_length(uint32_t i) const noexcept {
+    const TapeNode &nd = tape[i];
+    return BEAST_UNLIKELY(nd.is_long()) ? long_length(i) : nd.length();
+  }
+
   DocumentView() = default;
   explicit DocumentView(std::string_view json) : source(json) {}
 
@@ -457,6 +943,17 @@ public:
     idx.capacity = o.idx.capacity;
     o.idx.positions = nullptr;
     o.idx.count = o.idx.capacity = 0;
+    key_index_min_ = o.key_index_min_;
+    key_index_ = std::move(o.key_index_);
+    elem_index_min_ = o.elem_index_min_;
+    elem_index_ = std::move(o.elem_index_);
+    long_lens_ = std::move(o.long_lens_);
+    decode_numbers_ = o.decode_numbers_;
+    numbers_ = std::move(o.numbers_);
+    validate_utf8_ = o.validate_utf8_;
+    unescaped_ = std::move(o.unescaped_);
+    strings_ = std::move(o.strings_);
+    file_ = std::move(o.file_);
   }
   DocumentView &operator=(DocumentView &&o) noexcept {
     if (this != &o) {
@@ -473,6 +970,17 @@ public:
       o.idx.count = o.idx.capacity = 0;
       ref_count = 0;
       last_dump_size_ = o.last_dump_size_;
+      key_index_min_ = o.key_index_min_;
+      key_index_ = std::move(o.key_index_);
+      elem_index_min_ = o.elem_index_min_;
+      elem_index_ = std::move(o.elem_index_);
+      long_lens_ = std::move(o.long_lens_);
+      decode_numbers_ = o.decode_numbers_;
+      numbers_ = std::move(o.numbers_);
+      validate_utf8_ = o.validate_utf8_;
+      unescaped_ = std::move(o.unescaped_);
+      strings_ = std::move(o.strings_);
+      file_ = std::move(o.file_);
     }
     return *this;
   }
@@ -484,6 +992,1307 @@ public:
   size_t size() const { return source.size(); }
 };
 
+// ─────────────────────────────────────────────────────────────
+// Phase 98: Correctly rounded decimal → double
+//
+// parse_double() is what every double read goes through:
+// Value::as<double>(), parse-time decoding (Phase 97) and the Cursor. It
+// works on the token's [first, last) range, needs no null-terminated copy
+// and ignores the locale. There are three tiers:
+//   1. Clinger: up to 19 significant digits whose value and power of ten
+//      are both exact doubles. One multiply or divide, correctly rounded
+//      by the FPU. Most real-world numbers take this path.
+//   2. Eisel–Lemire: the normalised digits times a 128-bit truncated
+//      power of five. It is correctly rounded unless the product lies too
+//      close to a halfway point to decide, which is rare.
+//   3. Big decimal: the digits are shifted by powers of two in a
+//      768-digit buffer until the binary exponent is known (Wuffs' simple
+//      decimal conversion). Exact for any input.
+// The grammar is from_chars' general format: [-] digits [. digits]
+// [e [±] digits], plus "inf", "infinity" and "nan". Parsing stops at the
+// first byte that does not fit, and ptr points there. A finite input that
+// rounds to ±inf, or nonzero digits that round to ±0, give
+// errc::result_out_of_range and leave `value` unchanged, as from_chars
+// does.
+// ─────────────────────────────────────────────────────────────
+
+// 5^-342 … 5^308 as 128-bit (high, low) words, normalised so the top bit
+// is set. Positive powers are truncated; negative ones are 2^b / 5^-q
+// rounded up (Lemire, "Number Parsing at a Gigabyte per Second", 2021).
+inline constexpr int kPow5Min = -342;
+inline constexpr int kPow5Max = 308;
+inline constexpr uint64_t kPow5_128[2 * (kPow5Max - kPow5Min + 1)] = {
+    0xeef453d6923bd65a, 0x113faa2906a13b3f,
+    0x9558b4661b6565f8, 0x4ac7ca59a424c507,
+    0xbaaee17fa23ebf76, 0x5d79bcf00d2df649,
+    0xe95a99df8ace6f53, 0xf4d82c2c107973dc,
+    0x91d8a02bb6c10594, 0x79071b9b8a4be869,
+    0xb64ec836a47146f9, 0x9748e2826cdee284,
+    0xe3e27a444d8d98b7, 0xfd1b1b2308169b25,
+    0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7,
+    0xb208ef855c969f4f, 0xbdbd2d335e51a935,
+    0xde8b2b66b3bc4723, 0xad2c788035e61382,
+    0x8b16fb203055ac76, 0x4c3bcb5021afcc31,
+    0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d,
+    0xd953e8624b85dd78, 0xd71d6dad34a2af0d,
+    0x87d4713d6f33aa6b, 0x8672648c40e5ad68,
+    0xa9c98d8ccb009506, 0x680efdaf511f18c2,
+    0xd43bf0effdc0ba48, 0x0212bd1b2566def2,
+    0x84a57695fe98746d, 0x014bb630f7604b57,
+    0xa5ced43b7e3e9188, 0x419ea3bd35385e2d,
+    0xcf42894a5dce35ea, 0x52064cac828675b9,
+    0x818995ce7aa0e1b2, 0x7343efebd1940993,
+    0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8,
+    0xca66fa129f9b60a6, 0xd41a26e077774ef6,
+    0xfd00b897478238d0, 0x8920b098955522b4,
+    0x9e20735e8cb16382, 0x55b46e5f5d5535b0,
+    0xc5a890362fddbc62, 0xeb2189f734aa831d,
+    0xf712b443bbd52b7b, 0xa5e9ec7501d523e4,
+    0x9a6bb0aa55653b2d, 0x47b233c92125366e,
+    0xc1069cd4eabe89f8, 0x999ec0bb696e840a,
+    0xf148440a256e2c76, 0xc00670ea43ca250d,
+    0x96cd2a865764dbca, 0x380406926a5e5728,
+    0xbc807527ed3e12bc, 0xc605083704f5ecf2,
+    0xeba09271e88d976b, 0xf7864a44c633682e,
+    0x93445b8731587ea3, 0x7ab3ee6afbe0211d,
+    0xb8157268fdae9e4c, 0x5960ea05bad82964,
+    0xe61acf033d1a45df, 0x6fb92487298e33bd,
+    0x8fd0c16206306bab, 0xa5d3b6d479f8e056,
+    0xb3c4f1ba87bc8696, 0x8f48a4899877186c,
+    0xe0b62e2929aba83c, 0x331acdabfe94de87,
+    0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14,
+    0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9,
+    0xdb71e91432b1a24a, 0xc9e82cd9f69d6150,
+    0x892731ac9faf056e, 0xbe311c083a225cd2,
+    0xab70fe17c79ac6ca, 0x6dbd630a48aaf406,
+    0xd64d3d9db981787d, 0x092cbbccdad5b108,
+    0x85f0468293f0eb4e, 0x25bbf56008c58ea5,
+    0xa76c582338ed2621, 0xaf2af2b80af6f24e,
+    0xd1476e2c07286faa, 0x1af5af660db4aee1,
+    0x82cca4db847945ca, 0x50d98d9fc890ed4d,
+    0xa37fce126597973c, 0xe50ff107bab528a0,
+    0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8,
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a,
+    0x9faacf3df73609b1, 0x77b191618c54e9ac,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2417,
+    0xf97ae3d0d2446f25, 0x4b0573286b44ad1d,
+    0x9becce62836ac577, 0x4ee367f9430aec32,
+    0xc2e801fb244576d5, 0x229c41f793cda73f,
+    0xf3a20279ed56d48a, 0x6b43527578c1110f,
+    0x9845418c345644d6, 0x830a13896b78aaa9,
+    0xbe5691ef416bd60c, 0x23cc986bc656d553,
+    0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9,
+    0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff68,
+    0x91376c36d99995be, 0x23100809b9c21fa1,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78a,
+    0xe2e69915b3fff9f9, 0x16c90c8f323f516c,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e3,
+    0xb1442798f49ffb4a, 0x99cd11cfdf41779c,
+    0xdd95317f31c7fa1d, 0x40405643d711d583,
+    0x8a7d3eef7f1cfc52, 0x482835ea666b2572,
+    0xad1c8eab5ee43b66, 0xda3243650005eecf,
+    0xd863b256369d4a40, 0x90bed43e40076a82,
+    0x873e4f75e2224e68, 0x5a7744a6e804a291,
+    0xa90de3535aaae202, 0x711515d0a205cb36,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e03,
+    0x8412d9991ed58091, 0xe858790afe9486c2,
+    0xa5178fff668ae0b6, 0x626e974dbe39a872,
+    0xce5d73ff402d98e3, 0xfb0a3d212dc8128f,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b99,
+    0xa139029f6a239f72, 0x1c1fffc1ebc44e80,
+    0xc987434744ac874e, 0xa327ffb266b56220,
+    0xfbe9141915d7a922, 0x4bf1ff9f0062baa8,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9,
+    0xc4ce17b399107c22, 0xcb550fb4384d21d3,
+    0xf6019da07f549b2b, 0x7e2a53a146606a48,
+    0x99c102844f94e0fb, 0x2eda7444cbfc426d,
+    0xc0314325637a1939, 0xfa911155fefb5308,
+    0xf03d93eebc589f88, 0x793555ab7eba27ca,
+    0x96267c7535b763b5, 0x4bc1558b2f3458de,
+    0xbbb01b9283253ca2, 0x9eb1aaedfb016f16,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadc,
+    0x92a1958a7675175f, 0x0bfacd89ec191ec9,
+    0xb749faed14125d36, 0xcef980ec671f667b,
+    0xe51c79a85916f484, 0x82b7e12780e7401a,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810,
+    0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49a,
+    0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0,
+    0xaecc49914078536d, 0x58fae9f773886e18,
+    0xda7f5bf590966848, 0xaf39a475506a899e,
+    0x888f99797a5e012d, 0x6d8406c952429603,
+    0xaab37fd7d8f58178, 0xc8e5087ba6d33b83,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64,
+    0x855c3be0a17fcd26, 0x5cf2eea09a55067f,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e,
+    0xd0601d8efc57b08b, 0xf13b94daf124da26,
+    0x823c12795db6ce57, 0x76c53d08d6b70858,
+    0xa2cb1717b52481ed, 0x54768c4b0c64ca6e,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09,
+    0xfe5d54150b090b02, 0xd3f93b35435d7c4c,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf,
+    0xc6b8e9b0709f109a, 0x359ab6419ca1091b,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b62,
+    0x9b407691d7fc44f8, 0x79e0de63425dcf1d,
+    0xc21094364dfb5636, 0x985915fc12f542e4,
+    0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c42,
+    0xbd8430bd08277231, 0x50c6ff782a838353,
+    0xece53cec4a314ebd, 0xa4f8bf5635246428,
+    0x940f4613ae5ed136, 0x871b7795e136be99,
+    0xb913179899f68584, 0x28e2557b59846e3f,
+    0xe757dd7ec07426e5, 0x331aeada2fe589cf,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7621,
+    0xb4bca50b065abe63, 0x0fed077a756b53a9,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62894,
+    0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb3,
+    0xdca04777f541c567, 0xecf0d7a0fc5583a0,
+    0x89e42caaf9491b60, 0xf41686c49db57244,
+    0xac5d37d5b79b6239, 0x311c2875c522ced5,
+    0xd77485cb25823ac7, 0x7d633293366b828b,
+    0x86a8d39ef77164bc, 0xae5dff9c02033197,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfc,
+    0xd267caa862a12d66, 0xd072df63c324fd7b,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6d,
+    0xa46116538d0deb78, 0x52d9be85f074e608,
+    0xcd795be870516656, 0x67902e276c921f8b,
+    0x806bd9714632dff6, 0x00ba1cd8a3db53b6,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a4,
+    0xc8a883c0fdaf7df0, 0x6122cd128006b2cd,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f81,
+    0x9cc3a6eec6311a63, 0xcbe3303674053bb0,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9c,
+    0xf4f1b4d515acb93b, 0xee92fb5515482d44,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4a,
+    0xbf5cd54678eef0b6, 0xd262d45a78a0635d,
+    0xef340a98172aace4, 0x86fb897116c87c34,
+    0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0,
+    0xbae0a846d2195712, 0x8974836059cca109,
+    0xe998d258869facd7, 0x2bd1a438703fc94b,
+    0x91ff83775423cc06, 0x7b6306a34627ddcf,
+    0xb67f6455292cbf08, 0x1a3bc84c17b1d542,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93,
+    0x8e938662882af53e, 0x547eb47b7282ee9c,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa43,
+    0xdec681f9f4c31f31, 0x6405fa00e2ec94d4,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd04,
+    0xae0b158b4738705e, 0x9624ab50b148d445,
+    0xd98ddaee19068c76, 0x3badd624dd9b0957,
+    0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c,
+    0xd47487cc8470652b, 0x7647c3200069671f,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073,
+    0xa5fb0a17c777cf09, 0xf468107100525890,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb4,
+    0x81ac1fe293d599bf, 0xc6f14cd848405530,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7c,
+    0xca9cf1d206fdc03b, 0xa6d90811f0e4851c,
+    0xfd442e4688bd304a, 0x908f4a166d1da663,
+    0x9e4a9cec15763e2e, 0x9a598e4e043287fe,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fd,
+    0xf7549530e188c128, 0xd12bee59e68ef47c,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958ce,
+    0xc13a148e3032d6e7, 0xe36a52363c1faf01,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1,
+    0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e7,
+    0xebdf661791d60f56, 0x111b495b3464ad21,
+    0x936b9fcebb25c995, 0xcab10dd900beec34,
+    0xb84687c269ef3bfb, 0x3d5d514f40eea742,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5112,
+    0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab,
+    0xb3f4e093db73a093, 0x59ed216765690f56,
+    0xe0f218b8d25088b8, 0x306869c13ec3532c,
+    0x8c974f7383725573, 0x1e414218c73a13fb,
+    0xafbd2350644eeacf, 0xe5d1929ef90898fa,
+    0xdbac6c247d62a583, 0xdf45f746b74abf39,
+    0x894bc396ce5da772, 0x6b8bba8c328eb783,
+    0xab9eb47c81f5114f, 0x066ea92f3f326564,
+    0xd686619ba27255a2, 0xc80a537b0efefebd,
+    0x8613fd0145877585, 0xbd06742ce95f5f36,
+    0xa798fc4196e952e7, 0x2c48113823b73704,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c5,
+    0x82ef85133de648c4, 0x9a984d73dbe722fb,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba,
+    0xcc963fee10b7d1b3, 0x318df905079926a8,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7052,
+    0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0,
+    0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0,
+    0x9c1661a651213e2d, 0x06bea10ca65c084e,
+    0xc31bfa0fe5698db8, 0x486e494fcff30a62,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfa,
+    0x986ddb5c6b3a76b7, 0xf89629465a75e01c,
+    0xbe89523386091465, 0xf6bbb397f1135823,
+    0xee2ba6c0678b597f, 0x746aa07ded582e2c,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdc,
+    0xba121a4650e4ddeb, 0x92f34d62616ce413,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d17,
+    0x915e2486ef32cd60, 0x0ace1474dc1d122e,
+    0xb5b5ada8aaff80b8, 0x0d819992132456ba,
+    0xe3231912d5bf60e6, 0x10e1fff697ed6c69,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1,
+    0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde,
+    0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c6,
+    0xd89d64d57a607744, 0xe871c7bf077ba8b7,
+    0x87625f056c7c4a8b, 0x11471cd764ad4972,
+    0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf,
+    0xd389b47879823479, 0x4aff1d108d4ec2c3,
+    0x843610cb4bf160cb, 0xcedf722a585139ba,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658828,
+    0xce947a3da6a9273e, 0x733d226229feea32,
+    0x811ccc668829b887, 0x0806357d5a3f525f,
+    0xa163ff802a3426a8, 0xca07c2dcb0cf26f7,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b5,
+    0xfc2c3f3841f17c67, 0xbbac2078d443ace2,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0d,
+    0xc5029163f384a931, 0x0a9e795e65d4df11,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d5,
+    0x99ea0196163fa42e, 0x504bced1bf8e4e45,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6,
+    0xf07da27a82c37088, 0x5d767327bb4e5a4c,
+    0x964e858c91ba2655, 0x3a6a07f8d510f86f,
+    0xbbe226efb628afea, 0x890489f70a55368b,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e,
+    0x92c8ae6b464fc96f, 0x3b0b8bc90012929d,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173744,
+    0xe55990879ddcaabd, 0xcc420a6a101d0515,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232d,
+    0xb32df8e9f3546564, 0x47939822dc96abf9,
+    0xdff9772470297ebd, 0x59787e2b93bc56f7,
+    0x8bfbea76c619ef36, 0x57eb4edb3c55b65a,
+    0xaefae51477a06b03, 0xede622920b6b23f1,
+    0xdab99e59958885c4, 0xe95fab368e45eced,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb414,
+    0xaae103b5fcd2a881, 0xd652bdc29f26a119,
+    0xd59944a37c0752a2, 0x4be76d3346f0495f,
+    0x857fcae62d8493a5, 0x6f70a4400c562ddb,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952,
+    0xd097ad07a71f26b2, 0x7e2000a41346a7a7,
+    0x825ecc24c873782f, 0x8ed400668c0c28c8,
+    0xa2f67f2dfa90563b, 0x728900802f0f32fa,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9,
+    0xfea126b7d78186bc, 0xe2f610c84987bfa8,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9,
+    0xc6ede63fa05d3143, 0x91503d1c79720dbb,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912a,
+    0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba,
+    0xc24452da229b021b, 0xfbe85badce996168,
+    0xf2d56790ab41c2a2, 0xfae27299423fb9c3,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41a,
+    0xbdb6b8e905cb600f, 0x5400e987bbc1c920,
+    0xed246723473e3813, 0x290123e9aab23b68,
+    0x9436c0760c86e30b, 0xf9a0b6720aaf6521,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e69,
+    0xe7958cb87392c2c2, 0xb60b1d1230b20e04,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2,
+    0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b0,
+    0x8d590723948a535f, 0x579c487e5a38ad0e,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d851,
+    0xdcdb1b2798182244, 0xf8e431456cf88e65,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff,
+    0xac8b2d36eed2dac5, 0xe272467e3d222f3f,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb0f,
+    0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+    0xa87fea27a539e9a5, 0x3f2398d747b36224,
+    0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+    0x83a3eeeef9153e89, 0x1953cf68300424ac,
+    0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+    0xcdb02555653131b6, 0x3792f412cb06794d,
+    0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4,
+    0xc8de047564d20a8b, 0xf245825a5a445275,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56712,
+    0x9ced737bb6c4183d, 0x55464dd69685606b,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b886,
+    0xf53304714d9265df, 0xd53dd99f4b3066a8,
+    0x993fe2c6d07b7fab, 0xe546a8038efe4029,
+    0xbf8fdb78849a5f96, 0xde98520472bdd033,
+    0xef73d256a5c0f77c, 0x963e66858f6d4440,
+    0x95a8637627989aad, 0xdde7001379a44aa8,
+    0xbb127c53b17ec159, 0x5560c018580d5d52,
+    0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+    0x9226712162ab070d, 0xcab3961304ca70e8,
+    0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506a,
+    0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+    0xb267ed1940f1c61c, 0x55f038b237591ed3,
+    0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da015,
+    0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+    0xd9c7dced53c72255, 0x96e7bd358c904a21,
+    0x881cea14545c7575, 0x7e50d64177da2e54,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9e9,
+    0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113e,
+    0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+    0xcfb11ead453994ba, 0x67de18eda5814af2,
+    0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+    0xa2425ff75e14fc31, 0xa1258379a94d028d,
+    0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fc,
+    0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e,
+    0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543,
+    0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+    0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+    0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+    0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+    0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95,
+    0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+    0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+    0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+    0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+    0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9,
+    0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+    0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000,
+    0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000,
+    0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000,
+    0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000,
+    0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000,
+    0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000,
+    0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000,
+    0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000,
+    0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000,
+    0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000,
+    0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000,
+    0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000,
+    0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000,
+    0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000,
+    0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000,
+    0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000,
+    0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000,
+    0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000,
+    0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000,
+    0xbc143fa4e250eb31, 0x17d955a000000000,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000000,
+    0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+    0xb7abc627050305ad, 0xf14a3d9e40000000,
+    0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000000,
+    0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+    0xe0352f62a19e306e, 0xd50b2037ad200000,
+    0x8c213d9da502de45, 0x4526f422cc340000,
+    0xaf298d050e4395d6, 0x9670b12b7f410000,
+    0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac800,
+    0xab0e93b6efee0053, 0x8eea0d047a457a00,
+    0xd5d238a4abe98068, 0x72a4904598d6d880,
+    0x85a36366eb71f041, 0x47a6da2b7f864750,
+    0xa70c3c40a64e6c51, 0x999090b65f67d924,
+    0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a4,
+    0xa321f2d7226895c7, 0xaff72d52192b6a0d,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490,
+    0xfee50b7025c36a08, 0x02f236d04753d5b4,
+    0x9f4f2726179a2245, 0x01d762422c946590,
+    0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2,
+    0x9b934c3b330c8577, 0x63cc55f49f88eb2f,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb,
+    0xf316271c7fc3908a, 0x8bef464e3945ef7a,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ac,
+    0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd,
+    0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b44,
+    0xe7d34c64a9c85d44, 0x60dbbca87196b616,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd,
+    0xb51d13aea4a488dd, 0x6babab6398bdbe41,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd1,
+    0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcb,
+    0xdd15fe86affad912, 0x49ef0eb713f39ebe,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784337,
+    0xacb92ed9397bf996, 0x49c2c37f07965404,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be906,
+    0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0c,
+    0xd2d80db02aabd62b, 0xf50a3fa490c30190,
+    0x83c7088e1aab65db, 0x792667c6da79e0fa,
+    0xa4b8cab1a1563f52, 0x577001b891185938,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f86,
+    0x80b05e5ac60b6178, 0x544f8158315b05b4,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c721,
+    0xc913936dd571c84c, 0x03bc3a19cd1e38e9,
+    0xfb5878494ace3a5f, 0x04ab48a04065c723,
+    0x9d174b2dcec0e47b, 0x62eb0d64283f9c76,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8394,
+    0xf5746577930d6500, 0xca8f44ec7ee36479,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb,
+    0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e,
+    0x95d04aee3b80ece5, 0xbba1f1d158724a12,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc97,
+    0xea1575143cf97226, 0xf52d09d71a3293bd,
+    0x924d692ca61be758, 0x593c2626705f9c56,
+    0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956447,
+    0x8edf98b59a373fec, 0x4724bd4189bd5eac,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb657,
+    0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed,
+    0x8b865b215899f46c, 0xbd79e0d20082ee74,
+    0xae67f1e9aec07187, 0xecd8590680a3aa11,
+    0xda01ee641a708de9, 0xe80e6f4820cc9495,
+    0x884134fe908658b2, 0x3109058d147fdcdd,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd415,
+    0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb0,
+    0xa6539930bf6bff45, 0x84db8346b786151c,
+    0xcfe87f7cef46ff16, 0xe612641865679a63,
+    0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e,
+    0xa26da3999aef7749, 0xe3be5e330f38f09d,
+    0xcb090c8001ab551c, 0x5cadf5bfd3072cc5,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6,
+    0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa,
+    0xc646d63501a1511d, 0xb281e1fd541501b8,
+    0xf7d88bc24209a565, 0x1f225a7ca91a4226,
+    0x9ae757596946075f, 0x3375788de9b06958,
+    0xc1a12d2fc3978937, 0x0052d6b1641c83ae,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49a,
+    0x9745eb4d50ce6332, 0xf840b7ba963646e0,
+    0xbd176620a501fbff, 0xb650e5a93bc3d898,
+    0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe,
+    0x93ba47c980e98cdf, 0xc66f336c36b10137,
+    0xb8a8d9bbe123f017, 0xb80b0047445d4184,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e5,
+    0x9043ea1ac7e41392, 0x87c89837ad68db2f,
+    0xb454e4a179dd1877, 0x29babe4598c311fb,
+    0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660c,
+    0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f,
+    0xdc21a1171d42645d, 0x76707543f4fa1f73,
+    0x899504ae72497eba, 0x6a06494a791c53a8,
+    0xabfa45da0edbde69, 0x0487db9d17636892,
+    0xd6f8d7509292d603, 0x45a9d2845d3c42b6,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2,
+    0xa7f26836f282b732, 0x8e6cac7768d7141e,
+    0xd1ef0244af2364ff, 0x3207d795430cd926,
+    0x8335616aed761f1f, 0x7f44e6bd49e807b8,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6,
+    0xcd036837130890a1, 0x36dba887c37a8c0f,
+    0x802221226be55a64, 0xc2494954da2c9789,
+    0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc7,
+    0xfa42a8b73abbf48c, 0xcb772339ba1f17f9,
+    0x9c69a97284b578d7, 0xff2a760414536efb,
+    0xc38413cf25e2d70d, 0xfef5138519684aba,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d69,
+    0x98bf2f79d5993802, 0xef2f773ffbd97a61,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fa,
+    0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26183,
+    0xba756174393d88df, 0x94f971119aeef9e4,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85d,
+    0x91abb422ccb812ee, 0xac62e055c10ab33a,
+    0xb616a12b7fe617aa, 0x577b986b314d6009,
+    0xe39c49765fdf9d94, 0xed5a7e85fda0b80b,
+    0x8e41ade9fbebc27d, 0x14588f13be847307,
+    0xb1d219647ae6b31c, 0x596eb2d8ae258fc8,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb,
+    0x8aec23d680043bee, 0x25de7bb9480d5854,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6a,
+    0xd910f7ff28069da4, 0x1b2ba1518094da04,
+    0x87aa9aff79042286, 0x90fb44d2f05d0842,
+    0xa99541bf57452b28, 0x353a1607ac744a53,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce8,
+    0x847c9b5d7c2e09b7, 0x69956135febada11,
+    0xa59bc234db398c25, 0x43fab9837e699095,
+    0xcf02b2c21207ef2e, 0x94f967e45e03f4bb,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f5,
+    0xa1ba1ba79e1632dc, 0x6462d92a69731732,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcfe,
+    0xfcb2cb35e702af78, 0x5cda735244c3d43e,
+    0x9defbf01b061adab, 0x3a0888136afa64a7,
+    0xc56baec21c7a1916, 0x088aaa1845b8fdd0,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d45,
+    0x9a3c2087a63f6399, 0x36ac54e2f678864b,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd,
+    0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b325,
+    0xbc4665b596706114, 0x873d5d9f0dde1fee,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7ea,
+    0x9316ff75dd87cbd8, 0x09a7f12442d588f2,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f,
+    0xe5d3ef282a242e81, 0x8f1668c8a86da5fa,
+    0x8fa475791a569d10, 0xf96e017d694487bc,
+    0xb38d92d760ec4455, 0x37c981dcc395a9ac,
+    0xe070f78d3927556a, 0x85bbe253f47b1417,
+    0x8c469ab843b89562, 0x93956d7478ccec8e,
+    0xaf58416654a6babb, 0x387ac8d1970027b2,
+    0xdb2e51bfe9d0696a, 0x06997b05fcc0319e,
+    0x88fcf317f22241e2, 0x441fece3bdf81f03,
+    0xab3c2fddeeaad25a, 0xd527e81cad7626c3,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b074,
+    0x85c7056562757456, 0xf6872d5667844e49,
+    0xa738c6bebb12d16c, 0xb428f8ac016561db,
+    0xd106f86e69d785c7, 0xe13336d701beba52,
+    0x82a45b450226b39c, 0xecc0024661173473,
+    0xa34d721642b06084, 0x27f002d7f95d0190,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f4,
+    0xff290242c83396ce, 0x7e67047175a15271,
+    0x9f79a169bd203e41, 0x0f0062c6e984d386,
+    0xc75809c42c684dd1, 0x52c07b78a3e60868,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a82,
+    0x9bbcc7a142b17ccb, 0x88a66076400bb691,
+    0xc2abf989935ddbfe, 0x6acff893d00ea435,
+    0xf356f7ebf83552fe, 0x0583f6b8c4124d43,
+    0x98165af37b2153de, 0xc3727a337a8b704a,
+    0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c,
+    0xeda2ee1c7064130c, 0x1162def06f79df73,
+    0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173692,
+    0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a2,
+    0xb54d5e4a127f59c8, 0x2503beb6d00cab4b,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61d,
+    0x8da471a9de737e24, 0x5ceaecfed289e5d2,
+    0xb10d8e1456105dad, 0x7425a83e872c5f47,
+    0xdd50f1996b947518, 0xd12f124e28f77719,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f,
+    0xace73cbfdc0bfb7b, 0x636cc64d1001550b,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4e,
+    0x8714a775e3e95c78, 0x65acfaec34810a71,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0d,
+    0xd31045a8341ca07c, 0x1ede48111209a050,
+    0x83ea2b892091e44d, 0x934aed0aab460432,
+    0xa4e4b66b68b65d60, 0xf81da84d5617853f,
+    0xce1de40642e3f4b9, 0x36251260ab9d668e,
+    0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019,
+    0xa1075a24e4421730, 0xb24cf65b8612f81f,
+    0xc94930ae1d529cfc, 0xdee033f26797b627,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b1,
+    0x9d412e0806e88aa5, 0x8e1f289560ee864e,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2,
+    0xf5b5d7ec8acb58a2, 0xae10af696774b1db,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29,
+    0xbff610b0cc6edd3f, 0x17fd090a58d32af3,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b0,
+    0x95f83d0a1fb69cd9, 0x4abdaf101564f98e,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1,
+    0xea53df5fd18d5513, 0x84c86189216dc5ed,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4,
+    0xb7118682dbb66a77, 0x3fbc8c33221dc2a1,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334a,
+    0x8f05b1163ba6832d, 0x29cb4d87f2a7400e,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511012,
+    0xdf78e4b2bd342cf6, 0x914da9246b255416,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e,
+    0xae9672aba3d0c320, 0xa184ac2473b529b1,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e,
+    0x8865899617fb1871, 0x7e2fa67c7a658892,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab7,
+    0xd51ea6fa85785631, 0x552a74227f3ea565,
+    0x8533285c936b35de, 0xd53a88958f87275f,
+    0xa67ff273b8460356, 0x8a892abaf368f137,
+    0xd01fef10a657842c, 0x2d2b7569b0432d85,
+    0x8213f56a67f6b29b, 0x9c3b29620e29fc73,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b8f,
+    0xcb3f2f7642717713, 0x241c70a936219a73,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0110,
+    0x9ec95d1463e8a506, 0xf4363804324a40aa,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d5,
+    0xf81aa16fdc1b81da, 0xdd94b7868e94050a,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8326,
+    0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8cec,
+    0x976e41088617ca01, 0xd5be0503e085d813,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18,
+    0xec9c459d51852ba2, 0xddf8e7d60ed1219e,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b503,
+    0xb8da1662e7b00a17, 0x3d6a751f3b936243,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad4,
+    0x906a617d450187e2, 0x27fb2b80668b24c5,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf6,
+    0xe1a63853bbd26451, 0x5e7873f8a0396973,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e8,
+    0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fb,
+    0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d,
+    0xac2820d9623bf429, 0x546345fa9fbdcd44,
+    0xd732290fbacaf133, 0xa97c177947ad4095,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485d,
+    0xa81f301449ee8c70, 0x5c68f256bfff5a74,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3111,
+    0x83585d8fd9c25db7, 0xc831fd53c5ff7eab,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e55,
+    0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b3,
+    0xa0555e361951c366, 0xd7e105bcc332621f,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7,
+    0xfa856334878fc150, 0xb14f98f6f0feb951,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3,
+    0xc3b8358109e84f07, 0x0a862f80ec4700c8,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fa,
+    0x98e7e9cccfbd7dbd, 0x8038d51cb897789c,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c3,
+    0xeeea5d5004981478, 0x1858ccfce06cac74,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc8,
+    0xbaa718e68396cffd, 0xd30560258f54e6ba,
+    0xe950df20247c83fd, 0x47c6b82ef32a2069,
+    0x91d28b7416cdd27e, 0x4cdc331d57fa5441,
+    0xb6472e511c81471d, 0xe0133fe4adf8e952,
+    0xe3d8f9e563a198e5, 0x58180fddd97723a6,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648,
+};
+
+struct U128_ {
+  uint64_t lo, hi;
+};
+
+BEAST_INLINE U128_ mul_64x64_(uint64_t a, uint64_t b) noexcept {
+#ifdef __SIZEOF_INT128__
+  __extension__ const unsigned __int128 p =
+      static_cast<unsigned __int128>(a) * b;
+  return {static_cast<uint64_t>(p), static_cast<uint64_t>(p >> 64)};
+#else
+  const uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+  const uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+  const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+  const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+  return {(mid << 32) | (p00 & 0xFFFFFFFFu),
+          a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32)};
+#endif
+}
+
+// A double before packing: the 52 explicit mantissa bits and the biased
+// exponent (0x7FF = infinity). power2 < 0: undecided, use the big decimal.
+struct BinaryFp_ {
+  uint64_t mantissa;
+  int32_t power2;
+  bool operator==(const BinaryFp_ &) const = default;
+};
+inline constexpr int kMantBits = 52;
+inline constexpr int32_t kInfPower = 0x7FF;
+
+// Eisel–Lemire: w × 10^q for a nonzero 64-bit w.
+inline BinaryFp_ eisel_lemire_(int64_t q, uint64_t w) noexcept {
+  if (w == 0 || q < kPow5Min)
+    return {0, 0};
+  if (q > kPow5Max)
+    return {0, kInfPower};
+  const int lz = BEAST_CLZ(w);
+  w <<= lz;
+  const size_t ix = 2 * static_cast<size_t>(q - kPow5Min);
+  U128_ p = mul_64x64_(w, kPow5_128[ix]);
+  // Only the top 55 bits are kept. When the bits below them are all ones,
+  // the low word of 5^q may carry into them: add its product too.
+  constexpr uint64_t kBelow = ~uint64_t{0} >> (kMantBits + 3);
+  if ((p.hi & kBelow) == kBelow) {
+    const U128_ p2 = mul_64x64_(w, kPow5_128[ix + 1]);
+    p.lo += p2.hi;
+    if (p2.hi > p.lo)
+      ++p.hi;
+  }
+  // Outside q ∈ [-27, 55], 5^q is inexact and the carry is still unknown.
+  if (p.lo == ~uint64_t{0} && (q < -27 || q > 55))
+    return {0, -1};
+  const int upper = static_cast<int>(p.hi >> 63);
+  const int shift = upper + 64 - kMantBits - 3;
+  uint64_t m = p.hi >> shift;
+  // floor(q × log2(10)) + 63, plus the IEEE bias.
+  int32_t power2 = static_cast<int32_t>(((217706 * q) >> 16) + 63 + upper -
+                                        lz + 1023);
+  if (power2 <= 0) { // subnormal
+    if (-power2 + 1 >= 64)
+      return {0, 0};
+    m >>= -power2 + 1;
+    m += m & 1;
+    m >>= 1;
+    // Rounding up may reach the smallest normal.
+    return {m & ((uint64_t{1} << kMantBits) - 1),
+            m < (uint64_t{1} << kMantBits) ? 0 : 1};
+  }
+  // Exactly halfway (only possible for q ∈ [-4, 23]): round to even.
+  if (p.lo <= 1 && q >= -4 && q <= 23 && (m & 3) == 1 &&
+      (m << shift) == p.hi)
+    m &= ~uint64_t{1};
+  m += m & 1;
+  m >>= 1;
+  if (m >= (uint64_t{2} << kMantBits)) {
+    m = uint64_t{1} << kMantBits;
+    ++power2;
+  }
+  m &= ~(uint64_t{1} << kMantBits);
+  if (power2 >= kInfPower)
+    return {0, kInfPower};
+  return {m, power2};
+}
+
+// Big decimal: 0.d[0]d[1]… × 10^dp. Digits past kMaxDigits are dropped and
+// recorded in `truncated`, which only matters to break an exact tie.
+struct BigDecimal_ {
+  static constexpr uint32_t kMaxDigits = 768;
+  static constexpr int32_t kRange = 2047;
+  uint32_t n = 0;
+  int32_t dp = 0;
+  bool truncated = false;
+  uint8_t d[kMaxDigits];
+
+  void trim() noexcept {
+    while (n > 0 && d[n - 1] == 0)
+      --n;
+  }
+
+  // × 2^shift, shift ≤ 60: from the last digit back, at most 19 new ones.
+  void shift_left(uint32_t shift) noexcept {
+    if (n == 0)
+      return;
+    uint8_t out[kMaxDigits + 20];
+    uint32_t w = n + 20;
+    uint64_t acc = 0;
+    for (uint32_t r = n; r-- > 0;) {
+      acc += static_cast<uint64_t>(d[r]) << shift;
+      const uint64_t q = acc / 10;
+      out[--w] = static_cast<uint8_t>(acc - 10 * q);
+      acc = q;
+    }
+    for (; acc > 0; acc /= 10)
+      out[--w] = static_cast<uint8_t>(acc % 10);
+    const uint32_t len = n + 20 - w;
+    dp += static_cast<int32_t>(len - n);
+    n = std::min(len, kMaxDigits);
+    std::memcpy(d, out + w, n);
+    for (uint32_t i = n; i < len; ++i)
+      truncated |= out[w + i] != 0;
+    trim();
+  }
+
+  // ÷ 2^shift, shift ≤ 60.
+  void shift_right(uint32_t shift) noexcept {
+    uint32_t r = 0, w = 0;
+    uint64_t acc = 0;
+    while ((acc >> shift) == 0) {
+      if (r < n) {
+        acc = 10 * acc + d[r++];
+      } else if (acc == 0) {
+        return;
+      } else {
+        while ((acc >> shift) == 0) {
+          acc *= 10;
+          ++r;
+        }
+        break;
+      }
+    }
+    dp -= static_cast<int32_t>(r - 1);
+    if (dp < -kRange) { // zero
+      n = 0;
+      dp = 0;
+      truncated = false;
+      return;
+    }
+    const uint64_t mask = (uint64_t{1} << shift) - 1;
+    while (r < n) {
+      const uint8_t digit = static_cast<uint8_t>(acc >> shift);
+      acc = 10 * (acc & mask) + d[r++];
+      d[w++] = digit;
+    }
+    while (acc > 0) {
+      const uint8_t digit = static_cast<uint8_t>(acc >> shift);
+      acc = 10 * (acc & mask);
+      if (w < kMaxDigits)
+        d[w++] = digit;
+      else if (digit > 0)
+        truncated = true;
+    }
+    n = w;
+    trim();
+  }
+
+  // The integer part, rounded half to even.
+  uint64_t round() const noexcept {
+    if (n == 0 || dp < 0)
+      return 0;
+    if (dp > 18)
+      return ~uint64_t{0};
+    const uint32_t ip = static_cast<uint32_t>(dp);
+    uint64_t v = 0;
+    for (uint32_t i = 0; i < ip; ++i)
+      v = 10 * v + (i < n ? d[i] : 0);
+    bool up = false;
+    if (ip < n) {
+      up = d[ip] >= 5;
+      if (d[ip] == 5 && ip + 1 == n)
+        up = truncated || (ip > 0 && (d[ip - 1] & 1));
+    }
+    return v + up;
+  }
+
+  BinaryFp_ to_binary() noexcept {
+    if (n == 0 || dp < -324)
+      return {0, 0};
+    if (dp >= 310)
+      return {0, kInfPower};
+    // Bits of shift that keep 10^k in range, for k decimal places.
+    static constexpr uint8_t kShift[19] = {0,  3,  6,  9,  13, 16, 19,
+                                           23, 26, 29, 33, 36, 39, 43,
+                                           46, 49, 53, 56, 59};
+    constexpr uint32_t kMaxShift = 60;
+    int32_t exp2 = 0;
+    while (dp > 0) { // down to [0, 1)
+      const uint32_t k = static_cast<uint32_t>(dp);
+      const uint32_t s = k < 19 ? kShift[k] : kMaxShift;
+      shift_right(s);
+      if (dp < -kRange)
+        return {0, 0};
+      exp2 += static_cast<int32_t>(s);
+    }
+    while (dp <= 0) { // up to [1/2, 1)
+      uint32_t s;
+      if (dp == 0) {
+        if (d[0] >= 5)
+          break;
+        s = d[0] < 2 ? 2 : 1;
+      } else {
+        const uint32_t k = static_cast<uint32_t>(-dp);
+        s = k < 19 ? kShift[k] : kMaxShift;
+      }
+      shift_left(s);
+      if (dp > kRange)
+        return {0, kInfPower};
+      exp2 -= static_cast<int32_t>(s);
+    }
+    --exp2; // [1/2, 1) → [1, 2)
+    constexpr int32_t kMinExp = -1023;
+    while (kMinExp + 1 > exp2) { // subnormal: denormalise
+      const uint32_t s = std::min<uint32_t>(kMinExp + 1 - exp2, kMaxShift);
+      shift_right(s);
+      exp2 += static_cast<int32_t>(s);
+    }
+    if (exp2 - kMinExp >= kInfPower)
+      return {0, kInfPower};
+    shift_left(kMantBits + 1);
+    uint64_t m = round();
+    if (m >= (uint64_t{1} << (kMantBits + 1))) { // rounded up a binade
+      shift_right(1);
+      ++exp2;
+      m = round();
+      if (exp2 - kMinExp >= kInfPower)
+        return {0, kInfPower};
+    }
+    int32_t power2 = exp2 - kMinExp;
+    if (m < (uint64_t{1} << kMantBits))
+      --power2;
+    return {m & ((uint64_t{1} << kMantBits) - 1), power2};
+  }
+};
+
+// The digits [ib, ie) '.' [fb, fe), times 10^exp, through a BigDecimal_.
+BEAST_NOINLINE inline BinaryFp_ big_decimal_(const char *ib, const char *ie,
+                                             const char *fb, const char *fe,
+                                             int64_t exp) noexcept {
+  BigDecimal_ b;
+  int64_t total = 0, dp = 0;
+  auto digit = [&](char c) {
+    if (b.n < BigDecimal_::kMaxDigits)
+      b.d[b.n++] = static_cast<uint8_t>(c - '0');
+    else if (c != '0')
+      b.truncated = true;
+    ++total;
+  };
+  for (const char *p = ib; p < ie; ++p)
+    if (total || *p != '0')
+      digit(*p);
+  dp = total;
+  for (const char *p = fb; p < fe; ++p) {
+    if (total == 0 && *p == '0')
+      --dp; // leading zero after the point
+    else
+      digit(*p);
+  }
+  b.trim();
+  dp += exp;
+  constexpr int64_t kLim = BigDecimal_::kRange + 1;
+  b.dp = static_cast<int32_t>(std::clamp<int64_t>(dp, -kLim, kLim));
+  return b.to_binary();
+}
+
+// Exact powers of ten for Clinger's fast path.
+inline constexpr double kExactPow10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// SWAR-8 digit runs: true when all eight bytes of v are '0'-'9', and
+// their value (first byte most significant), as in Lemire (2021).
+BEAST_INLINE bool eight_digits_(uint64_t v) noexcept {
+  constexpr uint64_t kHi = 0xF0F0F0F0F0F0F0F0u;
+  return ((v & kHi) | (((v + 0x0606060606060606u) & kHi) >> 4)) ==
+         0x3333333333333333u;
+}
+BEAST_INLINE uint64_t eight_digits_value_(uint64_t v) noexcept {
+  v -= 0x3030303030303030u;
+  v = v * 10 + (v >> 8); // pairs
+  return ((v & 0x000000FF000000FFu) * (100 + (1000000ull << 32)) +
+          ((v >> 16) & 0x000000FF000000FFu) * (1 + (10000ull << 32))) >>
+         32;
+}
+
+// Digits from p to the first non-digit, appended to w (wrapping past 19).
+BEAST_INLINE const char *digit_run_(const char *p, const char *last,
+                                    uint64_t &w) noexcept {
+  while (last - p >= 8) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    if (!eight_digits_(v))
+      break;
+    w = w * 100000000u + eight_digits_value_(v);
+    p += 8;
+  }
+  while (p < last && static_cast<unsigned>(*p - '0') < 10u)
+    w = 10 * w + static_cast<uint64_t>(*p++ - '0');
+  return p;
+}
+
+// Case-insensitive match of the lowercase literal `lit` at p.
+inline bool match_lower_(const char *p, const char *last,
+                         std::string_view lit) noexcept {
+  if (static_cast<size_t>(last - p) < lit.size())
+    return false;
+  for (size_t i = 0; i < lit.size(); ++i)
+    if ((p[i] | 0x20) != lit[i])
+      return false;
+  return true;
+}
+
+/// @brief Parses a decimal floating-point number from [first, last),
+/// correctly rounded, like `std::from_chars(first, last, value)`.
+inline std::from_chars_result parse_double(const char *first,
+                                           const char *last,
+                                           double &value) noexcept {
+  const char *p = first;
+  const bool neg = p < last && *p == '-';
+  p += neg;
+  const double sign = neg ? -1.0 : 1.0;
+  auto is_digit = [](char c) { return static_cast<unsigned>(c - '0') < 10u; };
+
+  uint64_t w = 0;
+  const char *ib = p;
+  p = digit_run_(p, last, w);
+  const char *ie = p, *fb = p, *fe = p;
+  if (p < last && *p == '.') {
+    fb = ++p;
+    p = fe = digit_run_(p, last, w);
+  }
+  size_t ndigits = static_cast<size_t>((ie - ib) + (fe - fb));
+  if (ndigits == 0) {
+    p = ib;
+    if (match_lower_(p, last, "nan")) {
+      p += 3;
+      if (p < last && *p == '(') { // nan(n-char-sequence)
+        const char *q = p + 1;
+        while (q < last && (is_digit(*q) || *q == '_' ||
+                            static_cast<unsigned>((*q | 0x20) - 'a') < 26u))
+          ++q;
+        if (q < last && *q == ')')
+          p = q + 1;
+      }
+      value = std::copysign(std::numeric_limits<double>::quiet_NaN(), sign);
+      return {p, std::errc{}};
+    }
+    if (match_lower_(p, last, "inf")) {
+      p += match_lower_(p, last, "infinity") ? 8 : 3;
+      value = sign * std::numeric_limits<double>::infinity();
+      return {p, std::errc{}};
+    }
+    return {first, std::errc::invalid_argument};
+  }
+
+  int64_t exp = 0;
+  if (p < last && (*p == 'e' || *p == 'E')) {
+    const char *e = p + 1;
+    const bool eneg = e < last && *e == '-';
+    e += (e < last && (*e == '-' || *e == '+'));
+    if (e < last && is_digit(*e)) { // otherwise the 'e' is not ours
+      while (e < last && is_digit(*e)) {
+        if (exp < 0x10000000) // saturates far outside the double range
+          exp = 10 * exp + (*e - '0');
+        ++e;
+      }
+      exp = eneg ? -exp : exp;
+      p = e;
+    }
+  }
+  int64_t q = exp - (fe - fb);
+
+  // More than 19 significant digits: w has wrapped. Keep the first 19 and
+  // let Eisel–Lemire bracket the rest between w and w + 1.
+  bool many = false;
+  if (ndigits > 19) {
+    for (const char *s = ib; s < fe && (*s == '0' || *s == '.'); ++s)
+      ndigits -= *s == '0';
+    if (ndigits > 19) {
+      many = true;
+      constexpr uint64_t k19 = 1000000000000000000u; // 10^18
+      w = 0;
+      const char *s = ib;
+      while (w < k19 && s < ie)
+        w = 10 * w + static_cast<uint64_t>(*s++ - '0');
+      if (w >= k19) {
+        q = exp + (ie - s);
+      } else {
+        s = fb;
+        while (w < k19 && s < fe)
+          w = 10 * w + static_cast<uint64_t>(*s++ - '0');
+        q = exp - (s - fb);
+      }
+    }
+  }
+
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+  // Clinger: w and 10^|q| are exact, so one rounding.
+  if (!many && w <= (uint64_t{1} << 53) && q >= -22 && q <= 22 + 15) {
+    double d = static_cast<double>(w);
+    if (q < 0) {
+      value = sign * (d / kExactPow10[-q]);
+      return {p, std::errc{}};
+    }
+    if (q <= 22) {
+      value = sign * (d * kExactPow10[q]);
+      return {p, std::errc{}};
+    }
+    // 10^q = 10^(q-22) × 10^22: exact while w × 10^(q-22) stays ≤ 2^53.
+    const uint64_t pw = static_cast<uint64_t>(kExactPow10[q - 22]);
+    if (w <= (uint64_t{1} << 53) / pw) {
+      value = sign * (static_cast<double>(w * pw) * kExactPow10[22]);
+      return {p, std::errc{}};
+    }
+  }
+#endif
+  BinaryFp_ fp = eisel_lemire_(q, w);
+  if (many && fp.power2 >= 0 && !(fp == eisel_lemire_(q, w + 1)))
+    fp.power2 = -1;
+  if (fp.power2 < 0)
+    fp = big_decimal_(ib, ie, fb, fe, exp);
+  if (fp.power2 == kInfPower || (fp.power2 == 0 && fp.mantissa == 0 && w))
+    return {p, std::errc::result_out_of_range};
+  const uint64_t bits = fp.mantissa |
+                        (static_cast<uint64_t>(fp.power2) << kMantBits) |
+                        (static_cast<uint64_t>(neg) << 63);
+  std::memcpy(&value, &bits, sizeof(value));
+  return {p, std::errc{}};
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 99: JSON string unescaping
+//
+// unescape_string() decodes the content of a JSON string (the bytes
+// between the quotes) into `out` and returns the end of what it wrote, or
+// nullptr on a malformed escape: an unknown escape letter, a short or
+// non-hex \u sequence, or a surrogate that is not half of a
+// \uD8xx\uDCxx pair. Decoding never grows a string, so `out` needs room
+// for last - first bytes. Runs without a backslash are copied a vector at
+// a time: each block is stored whole, and the output pointer advances to
+// the first backslash in it, if any. A vector is only stored while at
+// least a vector of input remains, which keeps the stores inside that
+// room.
+// ─────────────────────────────────────────────────────────────
+
+// Value of one hex digit, or -1.
+BEAST_INLINE int hex_digit_(char c) noexcept {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  const char l = static_cast<char>(c | 0x20);
+  return l >= 'a' && l <= 'f' ? l - 'a' + 10 : -1;
+}
+
+// The four hex digits at p as a code unit, or -1.
+BEAST_INLINE int32_t hex4_(const char *p) noexcept {
+  const int a = hex_digit_(p[0]), b = hex_digit_(p[1]);
+  const int c = hex_digit_(p[2]), d = hex_digit_(p[3]);
+  if ((a | b | c | d) < 0)
+    return -1;
+  return (a << 12) | (b << 8) | (c << 4) | d;
+}
+
+// Copies [p, last) to out up to the first backslash. Returns the number of
+// bytes before it (last - p if there is none). May store, but not count,
+// bytes past the backslash.
+BEAST_INLINE size_t copy_to_backslash_(const char *p, const char *last,
+                                       char *out) noexcept {
+  const char *const start = p;
+#if BEAST_HAS_AVX2
+  const __m256i bs32 = _mm256_set1_epi8('\\');
+  while (last - p >= 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (p - start)), v);
+    const uint32_t m = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, bs32)));
+    if (m)
+      return static_cast<size_t>(p - start) + BEAST_CTZ(m);
+    p += 32;
+  }
+#endif
+#if defined(BEAST_ARCH_X86_64)
+  const __m128i bs16 = _mm_set1_epi8('\\');
+  while (last - p >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (p - start)), v);
+    const uint32_t m =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, bs16)));
+    if (m)
+      return static_cast<size_t>(p - start) + BEAST_CTZ(m);
+    p += 16;
+  }
+#elif BEAST_HAS_NEON
+  const uint8x16_t bs16 = vdupq_n_u8('\\');
+  while (last - p >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    vst1q_u8(reinterpret_cast<uint8_t *>(out + (p - start)), v);
+    // Narrow the byte mask to 4 bits per byte: one 64-bit word to scan.
+    const uint8x8_t nib = vshrn_n_u16(
+        vreinterpretq_u16_u8(vceqq_u8(v, bs16)), 4);
+    const uint64_t m = vget_lane_u64(vreinterpret_u64_u8(nib), 0);
+    if (m)
+      return static_cast<size_t>(p - start) + (BEAST_CTZ(m) >> 2);
+    p += 16;
+  }
+#else
+  constexpr uint64_t K = 0x0101010101010101ULL;
+  constexpr uint64_t H = 0x8080808080808080ULL;
+  while (last - p >= 8) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    std::memcpy(out + (p - start), &v, 8);
+    uint64_t hb = v ^ (K * static_cast<uint8_t>('\\'));
+    hb = (hb - K) & ~hb & H;
+    if (hb)
+      return static_cast<size_t>(p - start) + (BEAST_CTZ(hb) >> 3);
+    p += 8;
+  }
+#endif
+  for (; p < last && *p != '\\'; ++p)
+    out[p - start] = *p;
+  return static_cast<size_t>(p - start);
+}
+
+inline char *unescape_string(const char *first, const char *last,
+                             char *out) noexcept {
+  const char *p = first;
+  for (;;) {
+    const size_t run = copy_to_backslash_(p, last, out);
+    p += run;
+    out += run;
+    if (p == last)
+      return out;
+    if (last - p < 2)
+      return nullptr; // lone trailing backslash
+    const char c = p[1];
+    p += 2;
+    switch (c) {
+    case '"':
+    case '\\':
+    case '/':
+      *out++ = c;
+      continue;
+    case 'b':
+      *out++ = '\b';
+      continue;
+    case 'f':
+      *out++ = '\f';
+      continue;
+    case 'n':
+      *out++ = '\n';
+      continue;
+    case 'r':
+      *out++ = '\r';
+      continue;
+    case 't':
+      *out++ = '\t';
+      continue;
+    case 'u':
+      break;
+    default:
+      return nullptr;
+    }
+    if (last - p < 4)
+      return nullptr;
+    uint32_t cp = static_cast<uint32_t>(hex4_(p));
+    p += 4;
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+      // A high surrogate must be followed by an escaped low surrogate.
+      if (cp >= 0xDC00 || last - p < 6 || p[0] != '\\' || p[1] != 'u')
+        return nullptr;
+      const int32_t lo = hex4_(p + 2);
+      if (lo < 0xDC00 || lo > 0xDFFF)
+        return nullptr;
+      cp = 0x10000 + ((cp - 0xD800) << 10) +
+           (static_cast<uint32_t>(lo) - 0xDC00);
+      p += 6;
+    } else if (cp > 0xFFFF) {
+      return nullptr; // hex4_() failed
+    }
+    if (cp < 0x80) {
+      *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      *out++ = static_cast<char>(0xC0 | (cp >> 6));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      *out++ = static_cast<char>(0xE0 | (cp >> 12));
+      *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      *out++ = static_cast<char>(0xF0 | (cp >> 18));
+      *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+  }
+}
+
+inline std::string_view DocumentView::unescape_(uint32_t i,
+                                                std::string_view raw) {
+  auto it = unescaped_.find(i);
+  if (it != unescaped_.end())
+    return it->second;
+  char *out = strings_.alloc(raw.size());
+  char *end = unescape_string(raw.data(), raw.data() + raw.size(), out);
+  if (!end)
+    throw std::runtime_error("beast::Value::as_unescaped: invalid escape");
+  const std::string_view s(out, static_cast<size_t>(end - out));
+  unescaped_.emplace(i, s);
+  return s;
+}
+
 // ─────────────────────────────────────────────────────────────
 // C++20 Concepts — named constraints used throughout Value/SafeValue
 // ─────────────────────────────────────────────────────────────
@@ -516,6 +2325,87 @@ concept JsonScalarOnly =
     std::same_as<T, std::nullptr_t> || std::same_as<T, bool> ||
     JsonInteger<T> || JsonFloat<T>;
 
+// ─────────────────────────────────────────────────────────────
+// Phase 103: error codes — the exception-free API
+// ─────────────────────────────────────────────────────────────
+// parse(doc, json, ec) and Value::get<T>() report failures as an Error
+// instead of throwing. They are the implementation underneath: the
+// throwing parse() and as<T>() call them and throw on a non-None code,
+// so rejecting malformed input costs neither an unwind nor a message
+// string. std::bad_alloc still propagates.
+
+enum class Error : uint8_t {
+  None,
+  InvalidJson,   // malformed input (or invalid UTF-8, when validated)
+  InputTooLarge, // over 4 GB without BEAST_JSON_TAPE64
+  TapeTooLarge,  // over 4G tape nodes (BEAST_JSON_TAPE64)
+  MissingValue,  // an invalid Value{}: missing key, index out of range
+  TypeMismatch,  // e.g. get<int>() on a string
+  NumberError    // a number that does not parse or fit the requested type
+};
+
+/// The message the throwing API uses for `e`.
+inline const char *error_message(Error e) noexcept {
+  switch (e) {
+  case Error::None:
+    return "no error";
+  case Error::InvalidJson:
+    return "Invalid JSON";
+  case Error::InputTooLarge:
+    return "JSON input exceeds 4 GB: build with BEAST_JSON_TAPE64=1";
+  case Error::TapeTooLarge:
+    return "JSON document exceeds 4G tape nodes";
+  case Error::MissingValue:
+    return "value is missing or invalid";
+  case Error::TypeMismatch:
+    return "type mismatch";
+  case Error::NumberError:
+    return "number parse error";
+  }
+  return "unknown error";
+}
+
+// An int64_t read into the integral T of as<T>() / get<T>(): false when it
+// does not fit, reported as Error::NumberError rather than truncated.
+template <typename T> constexpr bool narrow_int_(int64_t v, T &out) noexcept {
+  if constexpr (std::is_signed_v<T>) {
+    if (v < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+        v > static_cast<int64_t>(std::numeric_limits<T>::max()))
+      return false;
+  } else {
+    if (v < 0 || static_cast<uint64_t>(v) > std::numeric_limits<T>::max())
+      return false;
+  }
+  out = static_cast<T>(v);
+  return true;
+}
+
+/// A T or an Error, after std::expected<T, Error> (C++23): test it, then
+/// read it with * or ->. value() is the one member that throws.
+template <typename T> class Result {
+public:
+  Result(T v) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : val_(std::move(v)) {}
+  Result(Error e) noexcept : err_(e) {}
+
+  bool has_value() const noexcept { return err_ == Error::None; }
+  explicit operator bool() const noexcept { return has_value(); }
+  Error error() const noexcept { return err_; }
+
+  const T &operator*() const noexcept { return val_; }
+  const T *operator->() const noexcept { return &val_; }
+  const T &value() const {
+    if (BEAST_UNLIKELY(err_ != Error::None))
+      throw std::runtime_error(error_message(err_));
+    return val_;
+  }
+  T value_or(T def) const { return has_value() ? val_ : std::move(def); }
+
+private:
+  T val_{};
+  Error err_ = Error::None;
+};
+
 // ─────────────────────────────────────────────────────────────
 // Forward declarations
 // ─────────────────────────────────────────────────────────────
@@ -650,6 +2540,7 @@ public:
 
   void set(std::string_view s) {
     doc_->mutations_[idx_] = {TapeNodeType::StringRaw, std::string(s)};
+    doc_->unescaped_.erase(idx_); // Phase 99: decoded from the old string
     doc_->last_dump_size_ = 0;
   }
   void set(const std::string &s) { set(std::string_view(s)); }
@@ -658,6 +2549,7 @@ public:
   // Erase a previously set() mutation, restoring the original parsed value.
   void unset() {
     doc_->mutations_.erase(idx_);
+    doc_->unescaped_.erase(idx_);
     doc_->last_dump_size_ = 0;
   }
 
@@ -716,15 +2608,23 @@ public:
   SafeValue get(int idx) const noexcept;
 
   // ── Internal: skip past the value at tape[idx], return next tape index ─────
-  // O(n) walk for nested objects/arrays; O(1) for scalar types.
+  // O(1) for every type when end-links are on (Phase 80); otherwise an O(n)
+  // walk for nested objects/arrays.
 
 private:
   uint32_t skip_value_(uint32_t idx) const noexcept {
     const uint32_t tsz = static_cast<uint32_t>(doc_->tape.size());
     if (BEAST_UNLIKELY(idx >= tsz))
       return idx;
-    const auto t = doc_->tape[idx].type();
+    const TapeNode &nd = doc_->tape[idx];
+    const auto t = nd.type();
     if (t == TapeNodeType::ObjectStart || t == TapeNodeType::ArrayStart) {
+#if BEAST_JSON_TAPE_LINKS
+      // Phase 80: open node's offset = matching close index. The bounds
+      // check keeps a truncated tape on the walk path below.
+      if (BEAST_LIKELY(nd.offset > idx && nd.offset < tsz))
+        return static_cast<uint32_t>(nd.offset) + 1;
+#endif
       int depth = 1;
       ++idx;
       while (depth > 0 && BEAST_LIKELY(idx < tsz)) {
@@ -765,25 +2665,8 @@ public:
   Value operator[](std::string_view key) const noexcept {
     if (!is_object())
       return {};
-    uint32_t i = idx_ + 1;
-    const size_t ntape = doc_->tape.size();
-    while (i < ntape) {
-      const auto t = doc_->tape[i].type();
-      if (t == TapeNodeType::ObjectEnd)
-        return {};
-      // Skip deleted keys transparently
-      if (BEAST_UNLIKELY(!doc_->deleted_.empty() && doc_->deleted_.count(i))) {
-        i = skip_value_(i + 1);
-        continue;
-      }
-      const TapeNode &kn = doc_->tape[i];
-      const char *kdata = doc_->source.data() + kn.offset;
-      const size_t klen = kn.length();
-      if (klen == key.size() && std::memcmp(kdata, key.data(), klen) == 0)
-        return Value(doc_, i + 1);
-      i = skip_value_(i + 1);
-    }
-    return {};
+    const uint32_t vi = find_key_(key);
+    return vi ? Value(doc_, vi) : Value{};
   }
 
   // int overload — prevents implicit conversion of int literals through
@@ -797,6 +2680,9 @@ public:
   Value operator[](size_t index) const noexcept {
     if (!is_array())
       return {};
+    // Phase 82: O(1) through the element table for far indices.
+    if (const std::vector<uint32_t> *tbl = elem_table_(index))
+      return index < tbl->size() ? Value(doc_, (*tbl)[index]) : Value{};
     uint32_t i = idx_ + 1;
     const size_t ntape = doc_->tape.size();
     size_t count = 0;
@@ -821,44 +2707,171 @@ public:
   std::optional<Value> find(std::string_view key) const noexcept {
     if (!is_object())
       return std::nullopt;
+    const uint32_t vi = find_key_(key);
+    if (!vi)
+      return std::nullopt;
+    return Value(doc_, vi);
+  }
+
+private:
+  // Phase 82: this array's element table, or nullptr → use the linear walk.
+  // Only consulted/built when the access reaches `reach` >= elem_index_min_:
+  // near indices are cheaper to walk than to hash.
+  const std::vector<uint32_t> *elem_table_(size_t reach) const noexcept {
+    const size_t min = doc_->elem_index_min_;
+    if (min == 0 || reach < min)
+      return nullptr;
+    auto it = doc_->elem_index_.find(idx_);
+    if (it != doc_->elem_index_.end())
+      return &it->second;
+    return build_elem_table_();
+  }
+
+  // One pass over the array (O(elements) with Phase 80 end-links), skipping
+  // deleted elements. Arrays below the threshold are not cached.
+  const std::vector<uint32_t> *build_elem_table_() const noexcept {
+    try {
+      std::vector<uint32_t> tbl;
+      uint32_t i = idx_ + 1;
+      const size_t ntape = doc_->tape.size();
+      while (i < ntape && doc_->tape[i].type() != TapeNodeType::ArrayEnd) {
+        if (doc_->deleted_.empty() || !doc_->deleted_.count(i))
+          tbl.push_back(i);
+        i = skip_value_(i);
+      }
+      if (tbl.size() < doc_->elem_index_min_)
+        return nullptr;
+      auto &slot = doc_->elem_index_[idx_];
+      slot = std::move(tbl);
+      return &slot;
+    } catch (...) {
+      return nullptr; // out of memory: stay on the linear walk
+    }
+  }
+
+  // Shared key lookup for operator[] / find(): returns the tape index of the
+  // value for the first live `key`, or 0 on miss (0 is always the root, never
+  // an object value). Deleted keys are skipped; additions_ hold serialized
+  // JSON rather than tape nodes and are not visible to lookup.
+  uint32_t find_key_(std::string_view key) const noexcept {
+    // Phase 81: hashed path once this object has been indexed.
+    if (BEAST_UNLIKELY(doc_->key_index_min_ != 0)) {
+      auto oit = doc_->key_index_.find(idx_);
+      if (oit != doc_->key_index_.end()) {
+        auto kit = oit->second.find(key);
+        if (kit == oit->second.end())
+          return 0;
+        if (BEAST_LIKELY(doc_->deleted_.empty() ||
+                         !doc_->deleted_.count(kit->second)))
+          return kit->second + 1;
+        // First occurrence erased — a later duplicate may still match.
+        return scan_key_(key, nullptr);
+      }
+      size_t nkeys = 0;
+      const uint32_t vi = scan_key_(key, &nkeys);
+      if (nkeys >= doc_->key_index_min_)
+        build_key_index_();
+      return vi;
+    }
+    return scan_key_(key, nullptr);
+  }
+
+  // Linear key scan. When `nkeys` is non-null, stores how many keys were
+  // compared before the hit/miss (drives the Phase 81 index threshold).
+  uint32_t scan_key_(std::string_view key, size_t *nkeys) const noexcept {
     uint32_t i = idx_ + 1;
     const size_t ntape = doc_->tape.size();
+    size_t n = 0;
+    uint32_t hit = 0;
     while (i < ntape) {
       const auto t = doc_->tape[i].type();
       if (t == TapeNodeType::ObjectEnd)
-        return std::nullopt;
+        break;
+      // Skip deleted keys transparently
       if (BEAST_UNLIKELY(!doc_->deleted_.empty() && doc_->deleted_.count(i))) {
         i = skip_value_(i + 1);
         continue;
       }
+      ++n;
       const TapeNode &kn = doc_->tape[i];
       const char *kdata = doc_->source.data() + kn.offset;
-      const size_t klen = kn.length();
-      if (klen == key.size() && std::memcmp(kdata, key.data(), klen) == 0)
-        return Value(doc_, i + 1);
+      const size_t klen = doc_->node_length(i);
+      if (klen == key.size() && std::memcmp(kdata, key.data(), klen) == 0) {
+        hit = i + 1;
+        break;
+      }
       i = skip_value_(i + 1);
     }
-    return std::nullopt;
+    if (nkeys)
+      *nkeys = n;
+    return hit;
+  }
+
+  // One pass over this object's keys (O(keys) with Phase 80 end-links).
+  // Deleted keys are indexed too; find_key_() re-checks deleted_ per hit.
+  void build_key_index_() const noexcept {
+    try {
+      auto &m = doc_->key_index_[idx_];
+      uint32_t i = idx_ + 1;
+      const size_t ntape = doc_->tape.size();
+      while (i < ntape && doc_->tape[i].type() != TapeNodeType::ObjectEnd) {
+        const TapeNode &kn = doc_->tape[i];
+        m.try_emplace(
+            std::string_view(doc_->source.data() + kn.offset,
+                             doc_->node_length(i)),
+            i);
+        i = skip_value_(i + 1);
+      }
+    } catch (...) {
+      // Out of memory: stay on the linear path for this object.
+      doc_->key_index_.erase(idx_);
+    }
   }
 
+public:
+
   // ── Size (respects deletions + additions) ──────────────────────────────────
 
   size_t size() const noexcept {
     if (!doc_)
       return 0;
-    const auto t = doc_->tape[idx_].type();
+    const TapeNode &nd = doc_->tape[idx_];
+    const auto t = nd.type();
     const size_t ntape = doc_->tape.size();
+    // Phase 83: parse-time element count, exact unless elements were erased
+    // or the count saturated.
+    if (BEAST_LIKELY(doc_->deleted_.empty() &&
+                     nd.length() != TapeNode::kCountSaturated) &&
+        (t == TapeNodeType::ArrayStart || t == TapeNodeType::ObjectStart)) {
+      size_t count = nd.length();
+      if (!doc_->additions_.empty()) {
+        auto ait = doc_->additions_.find(idx_);
+        if (ait != doc_->additions_.end())
+          count += ait->second.size();
+      }
+      return count;
+    }
     if (t == TapeNodeType::ArrayStart) {
-      uint32_t i = idx_ + 1;
       size_t count = 0;
-      while (i < ntape && doc_->tape[i].type() != TapeNodeType::ArrayEnd) {
-        if (BEAST_UNLIKELY(!doc_->deleted_.empty() &&
-                           doc_->deleted_.count(i))) {
-          i = skip_value_(i);
-        } else {
-          i = skip_value_(i);
-          ++count;
+      // Phase 82: O(1) once the element table exists.
+      auto eit = doc_->elem_index_.find(idx_);
+      if (eit != doc_->elem_index_.end()) {
+        count = eit->second.size();
+      } else {
+        uint32_t i = idx_ + 1;
+        while (i < ntape && doc_->tape[i].type() != TapeNodeType::ArrayEnd) {
+          if (BEAST_UNLIKELY(!doc_->deleted_.empty() &&
+                             doc_->deleted_.count(i))) {
+            i = skip_value_(i);
+          } else {
+            i = skip_value_(i);
+            ++count;
+          }
         }
+        // Large array: build the table so repeat size() / far indexing
+        // calls are O(1).
+        if (doc_->elem_index_min_ != 0 && count >= doc_->elem_index_min_)
+          (void)build_elem_table_();
       }
       if (!doc_->additions_.empty()) {
         auto ait = doc_->additions_.find(idx_);
@@ -896,17 +2909,56 @@ public:
   //
   // Beast unique pattern: as<T>() is the single canonical accessor.
   // Throws std::runtime_error on type mismatch.
-  // try_as<T>() is the non-throwing variant, returning std::optional<T>.
+  // try_as<T>() is the non-throwing variant, returning std::optional<T>;
+  // get<T>() returns a Result<T> that also says why (Phase 103).
   //
   // Supported types:
   //   bool, int64_t (+ all integral types via cast), double (+ float),
   //   std::string, std::string_view
 
   template <typename T> T as() const {
-    // Guard: invalid Value{} (missing key / out-of-range index) → throw.
-    // This makes try_as<T>() safe even on invalid Values (returns nullopt).
+    T out{};
+    if (const Error e = get_(out); BEAST_UNLIKELY(e != Error::None))
+      throw_as_<T>(e);
+    return out;
+  }
+
+  // try_as<T>(): non-throwing variant — returns std::nullopt on any error.
+  // Constrained to JsonReadable types; ill-formed for unsupported T.
+  // For std::string that includes failing to allocate the copy.
+  template <JsonReadable T> std::optional<T> try_as() const noexcept {
+    T out{};
+    if constexpr (std::is_same_v<T, std::string>) {
+      try {
+        if (get_(out) != Error::None)
+          return std::nullopt;
+      } catch (...) {
+        return std::nullopt;
+      }
+    } else if (get_(out) != Error::None) {
+      return std::nullopt;
+    }
+    return out;
+  }
+
+  // get<T>(): as<T>() with the error returned instead of thrown —
+  // MissingValue, TypeMismatch or NumberError. Phase 103.
+  template <JsonReadable T>
+  Result<T> get() const noexcept(!std::is_same_v<T, std::string>) {
+    T out{};
+    if (const Error e = get_(out); e != Error::None)
+      return e;
+    return out;
+  }
+
+private:
+  // Phase 103: the one implementation of as<T>() / try_as<T>() / get<T>().
+  // Only std::string can throw (allocation).
+  template <typename T>
+  Error get_(T &out) const noexcept(!std::is_same_v<T, std::string>) {
+    // An invalid Value{} (missing key / out-of-range index).
     if (!doc_)
-      throw std::runtime_error("beast::Value::as: value is missing or invalid");
+      return Error::MissingValue;
 
     // Check mutation overlay first — O(1) unordered_map lookup, only paid
     // when mutations_ is non-empty (guarded by BEAST_UNLIKELY branch).
@@ -915,115 +2967,152 @@ public:
       if (mit != doc_->mutations_.end()) {
         const MutationEntry &m = mit->second;
         if constexpr (std::is_same_v<T, bool>) {
-          if (m.type == TapeNodeType::BooleanTrue)
-            return true;
-          if (m.type == TapeNodeType::BooleanFalse)
-            return false;
-          throw std::runtime_error("beast::Value::as<bool>: not a boolean");
+          if (m.type != TapeNodeType::BooleanTrue &&
+              m.type != TapeNodeType::BooleanFalse)
+            return Error::TypeMismatch;
+          out = m.type == TapeNodeType::BooleanTrue;
         } else if constexpr (std::is_integral_v<T>) {
           if (m.type != TapeNodeType::Integer)
-            throw std::runtime_error(
-                "beast::Value::as<integral>: not an integer");
+            return Error::TypeMismatch;
           int64_t val = 0;
           std::from_chars(m.data.data(), m.data.data() + m.data.size(), val);
-          return static_cast<T>(val);
+          if (!narrow_int_(val, out))
+            return Error::NumberError;
         } else if constexpr (std::is_floating_point_v<T>) {
           if (m.type != TapeNodeType::Double && m.type != TapeNodeType::Integer)
-            throw std::runtime_error("beast::Value::as<float>: not a number");
+            return Error::TypeMismatch;
           double val = 0.0;
-          const char *beg = m.data.data();
-          [[maybe_unused]] const char *end = beg + m.data.size();
-#if __cpp_lib_to_chars >= 201611L && !defined(__APPLE__)
-          std::from_chars(beg, end, val);
-#else
-          char buf[64];
-          size_t len = m.data.size();
-          if (len >= sizeof(buf))
-            len = sizeof(buf) - 1;
-          std::memcpy(buf, beg, len);
-          buf[len] = '\0';
-          val = std::strtod(buf, nullptr);
-#endif
-          return static_cast<T>(val);
-        } else if constexpr (std::is_same_v<T, std::string_view>) {
-          if (m.type != TapeNodeType::StringRaw)
-            throw std::runtime_error(
-                "beast::Value::as<string_view>: not a string");
-          return std::string_view(m.data);
-        } else if constexpr (std::is_same_v<T, std::string>) {
+          parse_double(m.data.data(), m.data.data() + m.data.size(), val);
+          out = static_cast<T>(val);
+        } else if constexpr (std::is_same_v<T, std::string_view> ||
+                             std::is_same_v<T, std::string>) {
           if (m.type != TapeNodeType::StringRaw)
-            throw std::runtime_error("beast::Value::as<string>: not a string");
-          return m.data;
+            return Error::TypeMismatch;
+          out = T(m.data);
         }
+        return Error::None;
       }
     }
 
     // No mutation — read from tape (original fast path)
     if constexpr (std::is_same_v<T, bool>) {
       const auto t = doc_->tape[idx_].type();
-      if (t == TapeNodeType::BooleanTrue)
-        return true;
-      if (t == TapeNodeType::BooleanFalse)
-        return false;
-      throw std::runtime_error("beast::Value::as<bool>: not a boolean");
+      if (t != TapeNodeType::BooleanTrue && t != TapeNodeType::BooleanFalse)
+        return Error::TypeMismatch;
+      out = t == TapeNodeType::BooleanTrue;
     } else if constexpr (std::is_integral_v<T>) {
       const auto t = doc_->tape[idx_].type();
       if (t != TapeNodeType::Integer && t != TapeNodeType::NumberRaw)
-        throw std::runtime_error("beast::Value::as<integral>: not an integer");
+        return Error::TypeMismatch;
       const TapeNode &nd = doc_->tape[idx_];
       int64_t val = 0;
+      // Phase 97: decoded at parse time. NumberRaw keeps the text path
+      // below, which reads the integer prefix ("1.5" → 1).
+      if (t == TapeNodeType::Integer && nd.is_decoded()) {
+        if (!narrow_int_(static_cast<int64_t>(doc_->numbers_[idx_]), out))
+          return Error::NumberError;
+        return Error::None;
+      }
       const char *beg = doc_->source.data() + nd.offset;
-      const char *end = beg + nd.length();
+      const char *end = beg + doc_->node_length(idx_);
       auto [ptr, ec] = std::from_chars(beg, end, val);
-      if (ec != std::errc{})
-        throw std::runtime_error("beast::Value::as<integral>: parse error");
-      return static_cast<T>(val);
+      if (ec != std::errc{} || !narrow_int_(val, out))
+        return Error::NumberError;
     } else if constexpr (std::is_floating_point_v<T>) {
       const auto t = doc_->tape[idx_].type();
       if (t != TapeNodeType::Double && t != TapeNodeType::NumberRaw &&
           t != TapeNodeType::Integer)
-        throw std::runtime_error("beast::Value::as<float>: not a number");
+        return Error::TypeMismatch;
       const TapeNode &nd = doc_->tape[idx_];
       double val = 0.0;
+      if (nd.is_decoded()) { // Phase 97
+        const uint64_t bits = doc_->numbers_[idx_];
+        if (t == TapeNodeType::Integer) {
+          out = static_cast<T>(static_cast<int64_t>(bits));
+          return Error::None;
+        }
+        std::memcpy(&val, &bits, sizeof(val));
+        out = static_cast<T>(val);
+        return Error::None;
+      }
       const char *beg = doc_->source.data() + nd.offset;
-      [[maybe_unused]] const char *end = beg + nd.length();
-#if __cpp_lib_to_chars >= 201611L && !defined(__APPLE__)
-      auto [ptr, ec] = std::from_chars(beg, end, val);
-      if (ec != std::errc{})
-        throw std::runtime_error("beast::Value::as<float>: parse error");
-#else
-      char buf[64];
-      size_t len = nd.length();
-      if (len >= sizeof(buf))
-        len = sizeof(buf) - 1;
-      std::memcpy(buf, beg, len);
-      buf[len] = '\0';
-      char *endp = nullptr;
-      val = std::strtod(buf, &endp);
-      if (endp == buf)
-        throw std::runtime_error("beast::Value::as<float>: parse error");
-#endif
-      return static_cast<T>(val);
-    } else if constexpr (std::is_same_v<T, std::string_view>) {
+      const char *end = beg + doc_->node_length(idx_);
+      if (parse_double(beg, end, val).ec != std::errc{})
+        return Error::NumberError;
+      out = static_cast<T>(val);
+    } else if constexpr (std::is_same_v<T, std::string_view> ||
+                         std::is_same_v<T, std::string>) {
       if (doc_->tape[idx_].type() != TapeNodeType::StringRaw)
-        throw std::runtime_error("beast::Value::as<string_view>: not a string");
+        return Error::TypeMismatch;
       const TapeNode &nd = doc_->tape[idx_];
-      return std::string_view(doc_->source.data() + nd.offset, nd.length());
-    } else if constexpr (std::is_same_v<T, std::string>) {
-      return std::string(as<std::string_view>());
+      out = T(doc_->source.data() + nd.offset, doc_->node_length(idx_));
     } else {
       static_assert(sizeof(T) == 0, "beast::Value::as<T>: unsupported type");
     }
+    return Error::None;
   }
 
-  // try_as<T>(): non-throwing variant — returns std::nullopt on any error.
-  // Constrained to JsonReadable types; ill-formed for unsupported T.
-  template <JsonReadable T> std::optional<T> try_as() const noexcept {
-    try {
-      return as<T>();
-    } catch (...) {
-      return std::nullopt;
+  // as<T>()'s messages, built only once it has failed.
+  template <typename T> [[noreturn]] static void throw_as_(Error e) {
+    if (e == Error::MissingValue)
+      throw std::runtime_error("beast::Value::as: value is missing or invalid");
+    if constexpr (std::is_same_v<T, bool>)
+      throw std::runtime_error("beast::Value::as<bool>: not a boolean");
+    else if constexpr (std::is_integral_v<T>)
+      throw std::runtime_error(e == Error::NumberError
+                                   ? "beast::Value::as<integral>: parse error"
+                                   : "beast::Value::as<integral>: not an "
+                                     "integer");
+    else if constexpr (std::is_floating_point_v<T>)
+      throw std::runtime_error(e == Error::NumberError
+                                   ? "beast::Value::as<float>: parse error"
+                                   : "beast::Value::as<float>: not a number");
+    else
+      throw std::runtime_error("beast::Value::as<string_view>: not a string");
+  }
+
+public:
+
+  // ── as_unescaped() — decoded string content ─────────────────────────────
+  //
+  // as<std::string_view>() returns the raw source bytes, escapes and all.
+  // as_unescaped() returns the string with \n, \", \uXXXX (as UTF-8) and
+  // the other escapes decoded. A string without a backslash is returned as
+  // a view of the source, as before; one with escapes is decoded once into
+  // the document's arena, and later calls return the cached view. Views
+  // stay valid until the next parse into the document. Throws on a
+  // non-string or a malformed escape. Phase 99.
+  //
+  // Not thread-safe on a shared document: decoding an escaped string
+  // fills the document's cache (unescaped_), so concurrent as_unescaped()
+  // calls need external locking, as with the key and element indices.
+  // Escape-free strings write nothing. The parser records no "has
+  // escapes" bit: the staged Stage 2 takes string ends from the Stage 1
+  // index and never sees the bytes, and checking each string there cost
+  // ~7% of parse time. So each call repeats the memchr instead.
+  std::string_view as_unescaped() const {
+    if (!doc_)
+      throw std::runtime_error(
+          "beast::Value::as_unescaped: value is missing or invalid");
+    if (BEAST_UNLIKELY(!doc_->mutations_.empty())) {
+      auto mit = doc_->mutations_.find(idx_);
+      if (mit != doc_->mutations_.end()) {
+        const MutationEntry &m = mit->second;
+        if (m.type != TapeNodeType::StringRaw)
+          throw std::runtime_error("beast::Value::as_unescaped: not a string");
+        if (std::memchr(m.data.data(), '\\', m.data.size()) == nullptr)
+          return std::string_view(m.data);
+        return doc_->unescape_(idx_, m.data);
+      }
     }
+    const TapeNode &nd = doc_->tape[idx_];
+    if (nd.type() != TapeNodeType::StringRaw)
+      throw std::runtime_error("beast::Value::as_unescaped: not a string");
+    const std::string_view raw(doc_->source.data() + nd.offset,
+                               doc_->node_length(idx_));
+    if (std::memchr(raw.data(), '\\', raw.size()) == nullptr)
+      return raw;
+    return doc_->unescape_(idx_, raw);
   }
 
   // ── Implicit conversion
@@ -1088,7 +3177,7 @@ public:
       const TapeNode &nd = doc_->tape[i];
       const uint32_t meta = nd.meta;
       const auto type = static_cast<TapeNodeType>((meta >> 24) & 0xFF);
-      const uint8_t sep = (meta >> 16) & 0xFFu;
+      const uint8_t sep = (meta >> 16) & TapeNode::kSepMask;
 
       // Write pre-computed separator (branch-free for common case)
       // Phase 67 attempt (sep-per-case + StringRaw batch write) REVERTED:
@@ -1197,8 +3286,12 @@ public:
           vst1q_u8(uw + slen - 16, vld1q_u8(up + slen - 16));
           w += slen;
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #else  // generic NEON (non-Apple-Silicon): Phase 61 structure
         if (BEAST_LIKELY(slen <= 31)) {
@@ -1240,8 +3333,12 @@ public:
               *w++ = *sp++;
           }
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #endif // BEAST_ARCH_APPLE_SILICON
 #else
@@ -1282,8 +3379,12 @@ public:
           while (rem--)
             *w++ = *sp++;
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #endif // BEAST_HAS_NEON
         *w++ = '"';
@@ -1293,7 +3394,10 @@ public:
       case TapeNodeType::Integer:
       case TapeNodeType::NumberRaw:
       case TapeNodeType::Double: {
-        const uint16_t nlen = static_cast<uint16_t>(meta & 0xFFFFu);
+        const size_t nlen =
+            BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                ? doc_->long_length(static_cast<uint32_t>(i))
+                : static_cast<uint16_t>(meta & 0xFFFFu);
         std::memcpy(w, src + nd.offset, nlen);
         w += nlen;
         break;
@@ -1373,7 +3477,7 @@ public:
       const TapeNode &nd = doc_->tape[i];
       const uint32_t meta = nd.meta;
       const auto type = static_cast<TapeNodeType>((meta >> 24) & 0xFF);
-      const uint8_t sep = (meta >> 16) & 0xFFu;
+      const uint8_t sep = (meta >> 16) & TapeNode::kSepMask;
 
 #if BEAST_ARCH_APPLE_SILICON
       {
@@ -1456,8 +3560,12 @@ public:
           vst1q_u8(uw + slen - 16, vld1q_u8(up + slen - 16));
           w += slen;
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #else  // generic NEON (non-Apple-Silicon): Phase 61 structure
         if (BEAST_LIKELY(slen <= 31)) {
@@ -1499,8 +3607,12 @@ public:
               *w++ = *sp++;
           }
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #endif // BEAST_ARCH_APPLE_SILICON
 #else
@@ -1535,8 +3647,12 @@ public:
           while (rem--)
             *w++ = *sp++;
         } else {
-          std::memcpy(w, sp, slen);
-          w += slen;
+          // Phase 84: long strings only ever reach this branch.
+          const size_t n = BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                               ? doc_->long_length(static_cast<uint32_t>(i))
+                               : slen;
+          std::memcpy(w, sp, n);
+          w += n;
         }
 #endif
         *w++ = '"';
@@ -1546,7 +3662,10 @@ public:
       case TapeNodeType::Integer:
       case TapeNodeType::NumberRaw:
       case TapeNodeType::Double: {
-        const uint16_t nlen = static_cast<uint16_t>(meta & 0xFFFFu);
+        const size_t nlen =
+            BEAST_UNLIKELY(meta & TapeNode::kLongLenFlag)
+                ? doc_->long_length(static_cast<uint32_t>(i))
+                : static_cast<uint16_t>(meta & 0xFFFFu);
         std::memcpy(w, src + nd.offset, nlen);
         w += nlen;
         break;
@@ -1610,7 +3729,7 @@ public:
         return;
       const TapeNode &kn = doc_->tape[i];
       const char *kdata = doc_->source.data() + kn.offset;
-      if (kn.length() == key.size() &&
+      if (doc_->node_length(i) == key.size() &&
           std::memcmp(kdata, key.data(), key.size()) == 0) {
         doc_->deleted_.insert(
             i); // mark key deleted (cascade: dump skips value)
@@ -1638,6 +3757,7 @@ public:
       }
       if (count == idx) {
         doc_->deleted_.insert(i);
+        doc_->elem_index_.erase(idx_); // Phase 82: positions shifted
         doc_->last_dump_size_ = 0;
         return;
       }
@@ -1784,7 +3904,8 @@ public:
     // Returns {key_string_view, Value} — Value is constructed on demand
     std::pair<std::string_view, Value> operator*() const noexcept {
       const TapeNode &kn = doc_->tape[key_idx_];
-      return {std::string_view(doc_->source.data() + kn.offset, kn.length()),
+      return {std::string_view(doc_->source.data() + kn.offset,
+                               doc_->node_length(key_idx_)),
               Value(const_cast<DocumentView *>(doc_), key_idx_ + 1)};
     }
     ObjectIterator &operator++() noexcept {
@@ -2381,7 +4502,8 @@ private:
       // sep for the first node (idx_) is suppressed — it belongs to parent
       // context
       const uint8_t sep =
-          (i == idx_) ? 0u : static_cast<uint8_t>((meta >> 16) & 0xFFu);
+          (i == idx_) ? 0u
+                      : static_cast<uint8_t>((meta >> 16) & TapeNode::kSepMask);
       if (sep)
         *w++ = (sep == 0x02u) ? ':' : ',';
 
@@ -2431,7 +4553,7 @@ private:
         *w++ = ']';
         break;
       case TapeNodeType::StringRaw: {
-        const uint16_t slen = static_cast<uint16_t>(meta & 0xFFFFu);
+        const size_t slen = doc_->node_length(i);
         const size_t src_sz = doc_->source.size();
         const size_t safe_slen =
             (nd.offset < src_sz) ? std::min<size_t>(slen, src_sz - nd.offset)
@@ -2445,7 +4567,7 @@ private:
       case TapeNodeType::Integer:
       case TapeNodeType::NumberRaw:
       case TapeNodeType::Double: {
-        const uint16_t nlen = static_cast<uint16_t>(meta & 0xFFFFu);
+        const size_t nlen = doc_->node_length(i);
         const size_t src_sz = doc_->source.size();
         const size_t safe_nlen =
             (nd.offset < src_sz) ? std::min<size_t>(nlen, src_sz - nd.offset)
@@ -2640,7 +4762,7 @@ private:
           done_elem(stk[top]);
         break;
       case TapeNodeType::StringRaw: {
-        const uint16_t slen = static_cast<uint16_t>(nd.meta & 0xFFFFu);
+        const size_t slen = doc_->node_length(i);
         const size_t src_sz = doc_->source.size();
         const size_t safe_slen =
             (nd.offset < src_sz) ? std::min<size_t>(slen, src_sz - nd.offset)
@@ -2655,7 +4777,7 @@ private:
       case TapeNodeType::Integer:
       case TapeNodeType::NumberRaw:
       case TapeNodeType::Double: {
-        const uint16_t nlen = static_cast<uint16_t>(nd.meta & 0xFFFFu);
+        const size_t nlen = doc_->node_length(i);
         const size_t src_sz = doc_->source.size();
         const size_t safe_nlen =
             (nd.offset < src_sz) ? std::min<size_t>(nlen, src_sz - nd.offset)
@@ -2716,7 +4838,7 @@ private:
         // key
         const TapeNode &kn = doc_->tape[i];
         out += '"';
-        out.append(doc_->source.data() + kn.offset, kn.length());
+        out.append(doc_->source.data() + kn.offset, doc_->node_length(i));
         out += '"';
         out += ": ";
         Value val_v(doc_, i + 1);
@@ -2843,6 +4965,397 @@ static BEAST_INLINE uint16_t neon_movemask(uint8x16_t mask) noexcept {
 
 #endif // BEAST_HAS_NEON
 
+// ─────────────────────────────────────────────────────────────
+// Phase 100: UTF-8 validation
+//
+// Opt-in (DocumentView::enable_utf8_validation()); otherwise any bytes
+// are accepted inside strings. The vector check is the lookup algorithm
+// of Keiser & Lemire: three 16-entry tables, indexed by the high and low
+// nibble of each byte and the high nibble of the byte after it, flag
+// every bad 2-byte window, and a saturating subtract marks the bytes
+// that must be the 3rd / 4th of a sequence. 64 bytes per step; an
+// all-ASCII block only checks that no sequence is still open before it.
+//
+// The Stage 1 *_utf8 kernels run it on each block they scan, so the input
+// is read once; Stage1Carry carries its state across windows. Paths
+// without a Stage 1 kernel call validate_utf8() first.
+// ─────────────────────────────────────────────────────────────
+inline constexpr uint8_t kUtf8TooShort = 1 << 0;     // lead, no continuation
+inline constexpr uint8_t kUtf8TooLong = 1 << 1;      // ASCII, continuation
+inline constexpr uint8_t kUtf8Overlong3 = 1 << 2;    // E0 80..9F
+inline constexpr uint8_t kUtf8TooLarge = 1 << 3;     // F4 90..BF
+inline constexpr uint8_t kUtf8Surrogate = 1 << 4;    // ED A0..BF
+inline constexpr uint8_t kUtf8Overlong2 = 1 << 5;    // C0 / C1 lead
+inline constexpr uint8_t kUtf8TooLarge1000 = 1 << 6; // F5..FF lead
+inline constexpr uint8_t kUtf8Overlong4 = 1 << 6;    // F0 80..8F
+inline constexpr uint8_t kUtf8TwoConts = 1 << 7;     // two continuations
+inline constexpr uint8_t kUtf8Carry =
+    kUtf8TooShort | kUtf8TooLong | kUtf8TwoConts;
+
+// Indexed by the high nibble of the first byte of a window.
+alignas(16) inline constexpr uint8_t kUtf8Byte1High[16] = {
+    kUtf8TooLong, kUtf8TooLong, kUtf8TooLong, kUtf8TooLong, // 0_______
+    kUtf8TooLong, kUtf8TooLong, kUtf8TooLong, kUtf8TooLong,
+    kUtf8TwoConts, kUtf8TwoConts, kUtf8TwoConts, kUtf8TwoConts, // 10______
+    kUtf8TooShort | kUtf8Overlong2,                              // 1100____
+    kUtf8TooShort,                                               // 1101____
+    kUtf8TooShort | kUtf8Overlong3 | kUtf8Surrogate,             // 1110____
+    kUtf8TooShort | kUtf8TooLarge | kUtf8TooLarge1000 | kUtf8Overlong4};
+
+// Indexed by the low nibble of the first byte.
+alignas(16) inline constexpr uint8_t kUtf8Byte1Low[16] = {
+    kUtf8Carry | kUtf8Overlong3 | kUtf8Overlong2 | kUtf8Overlong4, // ____0000
+    kUtf8Carry | kUtf8Overlong2,                                   // ____0001
+    kUtf8Carry,
+    kUtf8Carry,
+    kUtf8Carry | kUtf8TooLarge, // ____0100
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000 | kUtf8Surrogate, // 1101
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000};
+
+// Indexed by the high nibble of the second byte.
+alignas(16) inline constexpr uint8_t kUtf8Byte2High[16] = {
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, // 0_______
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort,
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Overlong3 |
+        kUtf8TooLarge1000 | kUtf8Overlong4, // 1000____
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Overlong3 |
+        kUtf8TooLarge, // 1001____
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Surrogate |
+        kUtf8TooLarge, // 101_____
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Surrogate |
+        kUtf8TooLarge,
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort}; // 11______
+
+// Saturating-subtracted from a block: nonzero iff one of its last three
+// bytes starts a sequence that does not fit before the block ends.
+alignas(64) inline constexpr uint8_t kUtf8OpenMax[64] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF};
+
+// Stage1Carry::utf8_prev: the last three bytes before a range, the last
+// in bits 23-16. Returns it for the end of [src, src + len).
+inline uint32_t utf8_tail_(uint32_t prev, const char *src,
+                           size_t len) noexcept {
+  for (size_t i = len > 3 ? len - 3 : 0; i < len; ++i)
+    prev = (prev >> 8) | uint32_t{static_cast<uint8_t>(src[i])} << 16;
+  return prev;
+}
+
+// True if the bytes in `tail` end inside a sequence (input truncated).
+inline bool utf8_open_(uint32_t tail) noexcept {
+  return ((tail >> 16) & 0xFF) >= 0xC0 || ((tail >> 8) & 0xFF) >= 0xE0 ||
+         (tail & 0xFF) >= 0xF0;
+}
+
+// Byte-at-a-time RFC 3629 check with an 8-byte ASCII skip: the fallback
+// where no vector unit is compiled in.
+inline bool validate_utf8_scalar_(const char *src, size_t len) noexcept {
+  const auto *s = reinterpret_cast<const unsigned char *>(src);
+  size_t i = 0;
+  while (i < len) {
+    if (i + 8 <= len && !(load64(src + i) & 0x8080808080808080ULL)) {
+      i += 8;
+      continue;
+    }
+    const unsigned c = s[i];
+    if (c < 0x80) {
+      ++i;
+      continue;
+    }
+    size_t k;                      // continuation bytes
+    unsigned lo = 0x80, hi = 0xBF; // range of the first one
+    if (c >= 0xC2 && c <= 0xDF) {
+      k = 1;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+      k = 2;
+      lo = c == 0xE0 ? 0xA0 : 0x80; // overlong
+      hi = c == 0xED ? 0x9F : 0xBF; // surrogates
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      k = 3;
+      lo = c == 0xF0 ? 0x90 : 0x80; // overlong
+      hi = c == 0xF4 ? 0x8F : 0xBF; // above U+10FFFF
+    } else {
+      return false;
+    }
+    if (len - i <= k || s[i + 1] < lo || s[i + 1] > hi)
+      return false;
+    for (size_t j = 2; j <= k; ++j)
+      if ((s[i + j] & 0xC0) != 0x80)
+        return false;
+    i += k + 1;
+  }
+  return true;
+}
+
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+struct Utf8Avx512 {
+  __m512i prev; // the last block checked (its last 3 bytes are read)
+  __m512i open; // nonzero: prev ends inside a sequence
+  __m512i err;  // sticky: nonzero once any window is invalid
+};
+
+BEAST_TARGET_AVX512 void utf8_init_avx512_(Utf8Avx512 &s,
+                                           uint32_t tail) noexcept {
+  alignas(64) uint8_t b[64] = {};
+  b[61] = static_cast<uint8_t>(tail);
+  b[62] = static_cast<uint8_t>(tail >> 8);
+  b[63] = static_cast<uint8_t>(tail >> 16);
+  s.prev = _mm512_load_si512(b);
+  s.open = _mm512_subs_epu8(s.prev, _mm512_load_si512(kUtf8OpenMax));
+  s.err = _mm512_setzero_si512();
+}
+
+BEAST_TARGET_AVX512 void utf8_block_avx512_(Utf8Avx512 &s,
+                                            const char *p) noexcept {
+  const __m512i v = _mm512_loadu_si512(p);
+  if (BEAST_LIKELY(_mm512_movepi8_mask(v) == 0)) {
+    s.err = _mm512_or_si512(s.err, s.open);
+    return;
+  }
+  const __m512i lo4 = _mm512_set1_epi8(0x0F);
+  // maskz: GCC 12 warns about the unmasked form's undefined source.
+  const __m512i t1h = _mm512_maskz_broadcast_i32x4(
+      0xFFFF,
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte1High)));
+  const __m512i t1l = _mm512_maskz_broadcast_i32x4(
+      0xFFFF,
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte1Low)));
+  const __m512i t2h = _mm512_maskz_broadcast_i32x4(
+      0xFFFF,
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte2High)));
+  // Per 128-bit lane: the lane before it (lane 3 of prev for lane 0), so
+  // alignr can shift bytes across lane edges.
+  const __m512i before = _mm512_permutex2var_epi64(
+      s.prev, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), v);
+  const __m512i prev1 = _mm512_alignr_epi8(v, before, 15);
+  const __m512i prev2 = _mm512_alignr_epi8(v, before, 14);
+  const __m512i prev3 = _mm512_alignr_epi8(v, before, 13);
+  const __m512i sc = _mm512_and_si512(
+      _mm512_and_si512(
+          _mm512_shuffle_epi8(
+              t1h, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), lo4)),
+          _mm512_shuffle_epi8(t1l, _mm512_and_si512(prev1, lo4))),
+      _mm512_shuffle_epi8(t2h,
+                          _mm512_and_si512(_mm512_srli_epi16(v, 4), lo4)));
+  // Bit 7 set where the byte must be a 3rd (E0+ two back) or 4th (F0+
+  // three back) byte; the tables already set it for a 2nd continuation.
+  const __m512i must23 =
+      _mm512_or_si512(_mm512_subs_epu8(prev2, _mm512_set1_epi8(0x60)),
+                      _mm512_subs_epu8(prev3, _mm512_set1_epi8(0x70)));
+  const __m512i m80 = _mm512_and_si512(
+      must23, _mm512_set1_epi8(static_cast<char>(0x80)));
+  s.err = _mm512_or_si512(s.err, _mm512_xor_si512(sc, m80));
+  s.open = _mm512_subs_epu8(v, _mm512_load_si512(kUtf8OpenMax));
+  s.prev = v;
+}
+
+BEAST_TARGET_AVX512 bool utf8_failed_avx512_(const Utf8Avx512 &s) noexcept {
+  return _mm512_test_epi8_mask(s.err, s.err) != 0;
+}
+#endif // BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+struct Utf8Avx2 {
+  __m256i prev; // as in Utf8Avx512, 32 bytes wide
+  __m256i open;
+  __m256i err;
+};
+
+BEAST_TARGET_AVX2 void utf8_init_avx2_(Utf8Avx2 &s, uint32_t tail) noexcept {
+  alignas(32) uint8_t b[32] = {};
+  b[29] = static_cast<uint8_t>(tail);
+  b[30] = static_cast<uint8_t>(tail >> 8);
+  b[31] = static_cast<uint8_t>(tail >> 16);
+  s.prev = _mm256_load_si256(reinterpret_cast<const __m256i *>(b));
+  s.open = _mm256_subs_epu8(
+      s.prev,
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(kUtf8OpenMax + 32)));
+  s.err = _mm256_setzero_si256();
+}
+
+BEAST_TARGET_AVX2 void utf8_check_avx2_(Utf8Avx2 &s, __m256i v) noexcept {
+  const __m256i lo4 = _mm256_set1_epi8(0x0F);
+  const __m256i t1h = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte1High)));
+  const __m256i t1l = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte1Low)));
+  const __m256i t2h = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(kUtf8Byte2High)));
+  const __m256i before = _mm256_permute2x128_si256(s.prev, v, 0x21);
+  const __m256i prev1 = _mm256_alignr_epi8(v, before, 15);
+  const __m256i prev2 = _mm256_alignr_epi8(v, before, 14);
+  const __m256i prev3 = _mm256_alignr_epi8(v, before, 13);
+  const __m256i sc = _mm256_and_si256(
+      _mm256_and_si256(
+          _mm256_shuffle_epi8(
+              t1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lo4)),
+          _mm256_shuffle_epi8(t1l, _mm256_and_si256(prev1, lo4))),
+      _mm256_shuffle_epi8(t2h,
+                          _mm256_and_si256(_mm256_srli_epi16(v, 4), lo4)));
+  const __m256i must23 =
+      _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60)),
+                      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70)));
+  const __m256i m80 = _mm256_and_si256(
+      must23, _mm256_set1_epi8(static_cast<char>(0x80)));
+  s.err = _mm256_or_si256(s.err, _mm256_xor_si256(sc, m80));
+  s.prev = v;
+}
+
+// One 64-byte block as two halves.
+BEAST_TARGET_AVX2 void utf8_block_avx2_(Utf8Avx2 &s, const char *p) noexcept {
+  const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  const __m256i b =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+  if (BEAST_LIKELY(_mm256_movemask_epi8(_mm256_or_si256(a, b)) == 0)) {
+    s.err = _mm256_or_si256(s.err, s.open);
+    return;
+  }
+  utf8_check_avx2_(s, a);
+  utf8_check_avx2_(s, b);
+  s.open = _mm256_subs_epu8(
+      b,
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(kUtf8OpenMax + 32)));
+}
+
+BEAST_TARGET_AVX2 bool utf8_failed_avx2_(const Utf8Avx2 &s) noexcept {
+  return !_mm256_testz_si256(s.err, s.err);
+}
+#endif // BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+
+#if BEAST_HAS_NEON
+struct Utf8Neon {
+  uint8x16_t prev; // as in Utf8Avx512, 16 bytes wide
+  uint8x16_t open;
+  uint8x16_t err;
+};
+
+BEAST_INLINE void utf8_check_neon_(Utf8Neon &s, uint8x16_t v) noexcept {
+  const uint8x16_t lo4 = vdupq_n_u8(0x0F);
+  const uint8x16_t prev1 = vextq_u8(s.prev, v, 15);
+  const uint8x16_t prev2 = vextq_u8(s.prev, v, 14);
+  const uint8x16_t prev3 = vextq_u8(s.prev, v, 13);
+  const uint8x16_t sc = vandq_u8(
+      vandq_u8(vqtbl1q_u8(vld1q_u8(kUtf8Byte1High), vshrq_n_u8(prev1, 4)),
+               vqtbl1q_u8(vld1q_u8(kUtf8Byte1Low), vandq_u8(prev1, lo4))),
+      vqtbl1q_u8(vld1q_u8(kUtf8Byte2High), vshrq_n_u8(v, 4)));
+  const uint8x16_t must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0x60)),
+                                     vqsubq_u8(prev3, vdupq_n_u8(0x70)));
+  s.err = vorrq_u8(s.err,
+                   veorq_u8(sc, vandq_u8(must23, vdupq_n_u8(0x80))));
+  s.prev = v;
+}
+
+BEAST_INLINE void utf8_block_neon_(Utf8Neon &s, const char *p) noexcept {
+  const auto *u = reinterpret_cast<const uint8_t *>(p);
+  const uint8x16_t a = vld1q_u8(u), b = vld1q_u8(u + 16),
+                   c = vld1q_u8(u + 32), d = vld1q_u8(u + 48);
+  if (BEAST_LIKELY(vmaxvq_u8(vorrq_u8(vorrq_u8(a, b), vorrq_u8(c, d))) <
+                   0x80)) {
+    s.err = vorrq_u8(s.err, s.open);
+    return;
+  }
+  utf8_check_neon_(s, a);
+  utf8_check_neon_(s, b);
+  utf8_check_neon_(s, c);
+  utf8_check_neon_(s, d);
+  s.open = vqsubq_u8(d, vld1q_u8(kUtf8OpenMax + 48));
+}
+#endif // BEAST_HAS_NEON
+
+// The standalone pass: every whole block, then the rest padded with
+// spaces (which also closes the check for a sequence left open).
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX512 bool validate_utf8_avx512_(const char *src,
+                                               size_t len) noexcept {
+  Utf8Avx512 s;
+  utf8_init_avx512_(s, 0);
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    utf8_block_avx512_(s, src + i);
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  utf8_block_avx512_(s, buf);
+  return !utf8_failed_avx512_(s);
+}
+#endif
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX2 bool validate_utf8_avx2_(const char *src,
+                                           size_t len) noexcept {
+  Utf8Avx2 s;
+  utf8_init_avx2_(s, 0);
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    utf8_block_avx2_(s, src + i);
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  utf8_block_avx2_(s, buf);
+  return !utf8_failed_avx2_(s);
+}
+#endif
+
+#if BEAST_HAS_NEON
+inline bool validate_utf8_neon_(const char *src, size_t len) noexcept {
+  Utf8Neon s{vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0)};
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    utf8_block_neon_(s, src + i);
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  utf8_block_neon_(s, buf);
+  return vmaxvq_u8(s.err) == 0;
+}
+#endif
+
+#if BEAST_JSON_RUNTIME_DISPATCH
+using Utf8Fn = bool (*)(const char *, size_t) noexcept;
+
+inline Utf8Fn validate_utf8_select_() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return &validate_utf8_avx512_;
+  if (__builtin_cpu_supports("avx2"))
+    return &validate_utf8_avx2_;
+  return &validate_utf8_scalar_;
+}
+#endif
+
+/// @brief True if [src, src + len) is well-formed UTF-8 (RFC 3629: no
+/// overlong forms, surrogates or code points above U+10FFFF). The check
+/// parse() makes under DocumentView::enable_utf8_validation(), as a
+/// separate pass.
+inline bool validate_utf8(const char *src, size_t len) noexcept {
+#if BEAST_HAS_AVX512
+  return validate_utf8_avx512_(src, len);
+#elif BEAST_HAS_AVX2
+  return validate_utf8_avx2_(src, len);
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  static const Utf8Fn fn = validate_utf8_select_();
+  return fn(src, len);
+#elif BEAST_HAS_NEON
+  return validate_utf8_neon_(src, len);
+#else
+  return validate_utf8_scalar_(src, len);
+#endif
+}
+
+
 // ─────────────────────────────────────────────────────────────
 // Phase 50: Stage 1 AVX-512 Structural Scanner
 //
@@ -2857,21 +5370,27 @@ static BEAST_INLINE uint16_t neon_movemask(uint8x16_t mask) noexcept {
 //
 // Uses same escape / in-string algorithm as fill_bitmap() for correctness.
 // ─────────────────────────────────────────────────────────────
-#if BEAST_HAS_AVX512
-BEAST_INLINE void stage1_scan_avx512(const char *src, size_t len,
-                                     Stage1Index &idx) {
-  // Upper bound: at most every byte is structural (e.g. "[[[[[")
-  idx.reserve(len + 1);
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+// Phase 100: kUtf8 also validates each block (stage1_scan_avx512_utf8()).
+template <bool kUtf8>
+BEAST_TARGET_AVX512 Stage1Carry stage1_scan_avx512_(const char *src,
+                                                    size_t len,
+                                                    Stage1Index &idx,
+                                                    tape_off_t off0,
+                                                    Stage1Carry carry) {
+  // Phase 86: start from an estimate (~1 entry per 8 bytes covers typical
+  // documents) and grow per block instead of reserving len + 1 up front.
+  idx.reserve(len / 8 + 64);
   idx.reset();
-  uint32_t *out = idx.positions;
-  uint32_t count = 0;
+  tape_off_t *out = idx.positions;
+  tape_off_t count = 0;
 
   const char *p = src;
   const char *end = src + len;
 
-  uint64_t prev_in_string = 0; // all-0 = outside string; all-1 = inside string
-  bool prev_escaped = false;
-  uint64_t prev_non_ws = (1ULL << 63); // treat start as after whitespace
+  uint64_t prev_in_string = carry.in_string; // all-0 outside; all-1 inside
+  bool prev_escaped = carry.escaped;
+  uint64_t prev_non_ws = carry.prev_ws_like; // bit 63: byte before src
 
   // Pre-load broadcast constants outside the loop (hoisted to registers).
   const __m512i v_brace_o = _mm512_set1_epi8('{');
@@ -2883,9 +5402,14 @@ BEAST_INLINE void stage1_scan_avx512(const char *src, size_t len,
   const __m512i v_quote = _mm512_set1_epi8('"');
   const __m512i v_backslash = _mm512_set1_epi8('\\');
   const __m512i v_ws_thresh = _mm512_set1_epi8(0x20);
+  [[maybe_unused]] Utf8Avx512 utf8;
+  if constexpr (kUtf8)
+    utf8_init_avx512_(utf8, carry.utf8_prev);
 
   while (p + 64 <= end) {
     __m512i v = _mm512_loadu_si512(reinterpret_cast<const __m512i *>(p));
+    if constexpr (kUtf8)
+      utf8_block_avx512_(utf8, p);
 
     uint64_t q_bits = _mm512_cmpeq_epi8_mask(v, v_quote);
     uint64_t bs_bits = _mm512_cmpeq_epi8_mask(v, v_backslash);
@@ -2956,10 +5480,14 @@ BEAST_INLINE void stage1_scan_avx512(const char *src, size_t len,
     uint64_t structural = ((bracket_bits & ~inside) | clean_quotes) | vstart;
 
     // Write positions to flat array
-    uint32_t base = static_cast<uint32_t>(p - src);
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
     while (structural) {
       int bit = __builtin_ctzll(structural);
-      out[count++] = base + static_cast<uint32_t>(bit);
+      out[count++] = base + static_cast<tape_off_t>(bit);
       structural &= structural - 1;
     }
 
@@ -2977,6 +5505,8 @@ BEAST_INLINE void stage1_scan_avx512(const char *src, size_t len,
     std::memcpy(buf, p, remaining);
 
     __m512i v = _mm512_load_si512(reinterpret_cast<const __m512i *>(buf));
+    if constexpr (kUtf8)
+      utf8_block_avx512_(utf8, buf); // the padding closes open sequences
 
     uint64_t q_bits = _mm512_cmpeq_epi8_mask(v, v_quote);
     uint64_t bs_bits = _mm512_cmpeq_epi8_mask(v, v_backslash);
@@ -3037,73 +5567,120 @@ BEAST_INLINE void stage1_scan_avx512(const char *src, size_t len,
     uint64_t structural =
         (((bracket_bits & ~inside) | clean_quotes) | vstart) & m;
 
-    uint32_t base = static_cast<uint32_t>(p - src);
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
     while (structural) {
       int bit = __builtin_ctzll(structural);
-      out[count++] = base + static_cast<uint32_t>(bit);
+      out[count++] = base + static_cast<tape_off_t>(bit);
       structural &= structural - 1;
     }
   }
 
   idx.count = count;
+  Stage1Carry next{prev_in_string, prev_escaped, prev_non_ws};
+  if constexpr (kUtf8) {
+    next.utf8_prev = utf8_tail_(carry.utf8_prev, src, len);
+    next.utf8_error = carry.utf8_error || utf8_failed_avx512_(utf8);
+  }
+  return next;
 }
-#elif BEAST_HAS_NEON
+
+BEAST_TARGET_AVX512 Stage1Carry stage1_scan_avx512(const char *src, size_t len,
+                                                   Stage1Index &idx,
+                                                   tape_off_t off0 = 0,
+                                                   Stage1Carry carry = {}) {
+  return stage1_scan_avx512_<false>(src, len, idx, off0, carry);
+}
+
+BEAST_TARGET_AVX512 Stage1Carry stage1_scan_avx512_utf8(
+    const char *src, size_t len, Stage1Index &idx, tape_off_t off0 = 0,
+    Stage1Carry carry = {}) {
+  return stage1_scan_avx512_<true>(src, len, idx, off0, carry);
+}
+#endif // BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+
+#if (BEAST_HAS_AVX2 && !BEAST_HAS_AVX512) || BEAST_JSON_RUNTIME_DISPATCH
 // ─────────────────────────────────────────────────────────────
-// Phase 50: Stage 1 NEON Structural Scanner
+// Stage 1 AVX2 Structural Scanner
+//
+// Same output as stage1_scan_avx512() for AVX2-only x86 (Haswell+,
+// Zen 1-3). Only the block classification differs; the escape /
+// in-string / vstart bit logic is shared verbatim.
 // ─────────────────────────────────────────────────────────────
-BEAST_INLINE void stage1_scan_neon(const char *src, size_t len,
-                                   Stage1Index &idx) {
-  idx.reserve(len + 1);
+// Classifies one 64-byte block as two 32-byte halves → the same 64-bit masks
+// the AVX-512 kernel gets from one compare-to-mask. Signed cmpgt matches
+// _mm512_cmpgt_epi8_mask: 0x80-0xFF count as whitespace (only ever inside
+// strings).
+BEAST_TARGET_AVX2 void stage1_classify_avx2(const char *blk, uint64_t &q_bits,
+                                            uint64_t &bs_bits,
+                                            uint64_t &bracket_bits,
+                                            uint64_t &sep_bits,
+                                            uint64_t &non_ws) noexcept {
+  q_bits = bs_bits = bracket_bits = sep_bits = non_ws = 0;
+  for (int h = 0; h < 2; ++h) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blk + h * 32));
+    const __m256i m_quote = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'));
+    const __m256i m_bs = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'));
+    const __m256i m_bracket = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('{')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('}'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('[')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(']'))));
+    const __m256i m_sep =
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(',')));
+    const __m256i m_non_ws = _mm256_cmpgt_epi8(v, _mm256_set1_epi8(0x20));
+    const int sh = h * 32;
+    q_bits |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(m_quote))}
+              << sh;
+    bs_bits |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(m_bs))}
+               << sh;
+    bracket_bits |=
+        uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(m_bracket))} << sh;
+    sep_bits |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(m_sep))}
+                << sh;
+    non_ws |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(m_non_ws))}
+              << sh;
+  }
+}
+
+template <bool kUtf8>
+BEAST_TARGET_AVX2 Stage1Carry stage1_scan_avx2_(const char *src, size_t len,
+                                                Stage1Index &idx,
+                                                tape_off_t off0,
+                                                Stage1Carry carry) {
+  // Phase 86: start from an estimate (~1 entry per 8 bytes covers typical
+  // documents) and grow per block instead of reserving len + 1 up front.
+  idx.reserve(len / 8 + 64);
   idx.reset();
-  uint32_t *out = idx.positions;
-  uint32_t count = 0;
+  tape_off_t *out = idx.positions;
+  tape_off_t count = 0;
 
   const char *p = src;
   const char *end = src + len;
 
-  uint64_t prev_in_string = 0;
-  bool prev_escaped = false;
-  uint64_t prev_non_ws = (1ULL << 63);
+  uint64_t prev_in_string = carry.in_string; // all-0 outside; all-1 inside
+  bool prev_escaped = carry.escaped;
+  uint64_t prev_non_ws = carry.prev_ws_like; // bit 63: byte before src
 
-  const uint8x16_t v_brace_o = vdupq_n_u8('{');
-  const uint8x16_t v_brace_c = vdupq_n_u8('}');
-  const uint8x16_t v_bracket_o = vdupq_n_u8('[');
-  const uint8x16_t v_bracket_c = vdupq_n_u8(']');
-  const uint8x16_t v_colon = vdupq_n_u8(':');
-  const uint8x16_t v_comma = vdupq_n_u8(',');
-  const uint8x16_t v_quote = vdupq_n_u8('"');
-  const uint8x16_t v_backslash = vdupq_n_u8('\\');
-  const uint8x16_t v_ws_thresh = vdupq_n_u8(0x20);
+  [[maybe_unused]] Utf8Avx2 utf8;
+  if constexpr (kUtf8)
+    utf8_init_avx2_(utf8, carry.utf8_prev);
 
+  uint64_t q_bits, bs_bits, bracket_bits, sep_bits, non_ws;
   while (p + 64 <= end) {
-    uint64_t q_bits = 0, bs_bits = 0, bracket_bits = 0, sep_bits = 0,
-             non_ws = 0;
-
-    for (int i = 0; i < 4; ++i) {
-      uint8x16_t chunk =
-          vld1q_u8(reinterpret_cast<const uint8_t *>(p + i * 16));
-
-      uint8x16_t m_quo = vceqq_u8(chunk, v_quote);
-      uint8x16_t m_esc = vceqq_u8(chunk, v_backslash);
-
-      uint8x16_t m_bracket = vorrq_u8(
-          vorrq_u8(vceqq_u8(chunk, v_brace_o), vceqq_u8(chunk, v_brace_c)),
-          vorrq_u8(vceqq_u8(chunk, v_bracket_o), vceqq_u8(chunk, v_bracket_c)));
-      uint8x16_t m_sep =
-          vorrq_u8(vceqq_u8(chunk, v_colon), vceqq_u8(chunk, v_comma));
-
-      uint8x16_t m_not_white = vcgtq_u8(chunk, v_ws_thresh);
-
-      q_bits |= (uint64_t)neon_movemask(m_quo) << (i * 16);
-      bs_bits |= (uint64_t)neon_movemask(m_esc) << (i * 16);
-      bracket_bits |= (uint64_t)neon_movemask(m_bracket) << (i * 16);
-      sep_bits |= (uint64_t)neon_movemask(m_sep) << (i * 16);
-      non_ws |= (uint64_t)neon_movemask(m_not_white) << (i * 16);
-    }
-
+    stage1_classify_avx2(p, q_bits, bs_bits, bracket_bits, sep_bits, non_ws);
+    if constexpr (kUtf8)
+      utf8_block_avx2_(utf8, p);
+    // Phase 53: bracket_bits ({}[]) are emitted; sep_bits (:,) only feed
+    // ws_like / vstart.
     uint64_t s_bits = bracket_bits | sep_bits;
 
-    // ── Escape propagation ───────────────────
+    // ── Escape propagation (identical to stage1_scan_avx512()) ────────────
     uint64_t escaped = 0;
     uint64_t temp_esc = bs_bits;
     if (prev_escaped) {
@@ -3137,19 +5714,25 @@ BEAST_INLINE void stage1_scan_neon(const char *src, size_t len,
     uint64_t inside = in_string & ~clean_quotes;
 
     uint64_t external_non_ws = non_ws & ~inside;
+    // Structural chars outside strings + all real quotes (open & close)
     uint64_t external_symbols = (s_bits & ~inside) | clean_quotes;
     uint64_t ws_like = (~non_ws & ~inside) | external_symbols;
-
+    // vstart: first byte of each number/bool/null (non-ws, non-structural,
+    // outside strings, following whitespace or a structural character)
     uint64_t vstart = (external_non_ws & ~external_symbols) &
                       (ws_like << 1 | (prev_non_ws >> 63));
 
     uint64_t structural = ((bracket_bits & ~inside) | clean_quotes) | vstart;
 
     // Write positions to flat array
-    uint32_t base = static_cast<uint32_t>(p - src);
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
     while (structural) {
       int bit = __builtin_ctzll(structural);
-      out[count++] = base + static_cast<uint32_t>(bit);
+      out[count++] = base + static_cast<tape_off_t>(bit);
       structural &= structural - 1;
     }
 
@@ -3166,31 +5749,10 @@ BEAST_INLINE void stage1_scan_neon(const char *src, size_t len,
     std::memset(buf, ' ', 64);
     std::memcpy(buf, p, remaining);
 
-    uint64_t q_bits = 0, bs_bits = 0, bracket_bits = 0, sep_bits = 0,
-             non_ws = 0;
-
-    for (int i = 0; i < 4; ++i) {
-      uint8x16_t chunk =
-          vld1q_u8(reinterpret_cast<const uint8_t *>(buf + i * 16));
-
-      uint8x16_t m_quo = vceqq_u8(chunk, v_quote);
-      uint8x16_t m_esc = vceqq_u8(chunk, v_backslash);
-
-      uint8x16_t m_bracket = vorrq_u8(
-          vorrq_u8(vceqq_u8(chunk, v_brace_o), vceqq_u8(chunk, v_brace_c)),
-          vorrq_u8(vceqq_u8(chunk, v_bracket_o), vceqq_u8(chunk, v_bracket_c)));
-      uint8x16_t m_sep =
-          vorrq_u8(vceqq_u8(chunk, v_colon), vceqq_u8(chunk, v_comma));
-
-      uint8x16_t m_not_white = vcgtq_u8(chunk, v_ws_thresh);
-
-      q_bits |= (uint64_t)neon_movemask(m_quo) << (i * 16);
-      bs_bits |= (uint64_t)neon_movemask(m_esc) << (i * 16);
-      bracket_bits |= (uint64_t)neon_movemask(m_bracket) << (i * 16);
-      sep_bits |= (uint64_t)neon_movemask(m_sep) << (i * 16);
-      non_ws |= (uint64_t)neon_movemask(m_not_white) << (i * 16);
-    }
-
+    stage1_classify_avx2(buf, q_bits, bs_bits, bracket_bits, sep_bits,
+                         non_ws);
+    if constexpr (kUtf8)
+      utf8_block_avx2_(utf8, buf); // the padding closes open sequences
     uint64_t s_bits = bracket_bits | sep_bits;
 
     // Mask to valid bytes only
@@ -3236,22 +5798,386 @@ BEAST_INLINE void stage1_scan_neon(const char *src, size_t len,
     uint64_t vstart = (external_non_ws & ~external_symbols) &
                       (ws_like << 1 | (prev_non_ws >> 63));
 
-    uint64_t structural = ((bracket_bits & ~inside) | clean_quotes) | vstart;
+    uint64_t structural =
+        (((bracket_bits & ~inside) | clean_quotes) | vstart) & m;
 
-    uint32_t base = static_cast<uint32_t>(p - src);
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
     while (structural) {
       int bit = __builtin_ctzll(structural);
-      out[count++] = base + static_cast<uint32_t>(bit);
+      out[count++] = base + static_cast<tape_off_t>(bit);
       structural &= structural - 1;
     }
   }
 
   idx.count = count;
+  Stage1Carry next{prev_in_string, prev_escaped, prev_non_ws};
+  if constexpr (kUtf8) {
+    next.utf8_prev = utf8_tail_(carry.utf8_prev, src, len);
+    next.utf8_error = carry.utf8_error || utf8_failed_avx2_(utf8);
+  }
+  return next;
 }
-#endif // BEAST_HAS_AVX512
 
-// ─────────────────────────────────────────────────────────────
-// Phase 32: 256-Entry constexpr Action LUT
+BEAST_TARGET_AVX2 Stage1Carry stage1_scan_avx2(const char *src, size_t len,
+                                               Stage1Index &idx,
+                                               tape_off_t off0 = 0,
+                                               Stage1Carry carry = {}) {
+  return stage1_scan_avx2_<false>(src, len, idx, off0, carry);
+}
+
+BEAST_TARGET_AVX2 Stage1Carry stage1_scan_avx2_utf8(
+    const char *src, size_t len, Stage1Index &idx, tape_off_t off0 = 0,
+    Stage1Carry carry = {}) {
+  return stage1_scan_avx2_<true>(src, len, idx, off0, carry);
+}
+#endif
+
+#if BEAST_HAS_NEON
+// ─────────────────────────────────────────────────────────────
+// Phase 50: Stage 1 NEON Structural Scanner
+// ─────────────────────────────────────────────────────────────
+// Plain inline like the x86 kernels: only called through a Stage1Fn.
+inline Stage1Carry stage1_scan_neon(const char *src, size_t len,
+                                    Stage1Index &idx, tape_off_t off0 = 0,
+                                    Stage1Carry carry = {}) {
+  // Phase 86: start from an estimate (~1 entry per 8 bytes covers typical
+  // documents) and grow per block instead of reserving len + 1 up front.
+  idx.reserve(len / 8 + 64);
+  idx.reset();
+  tape_off_t *out = idx.positions;
+  tape_off_t count = 0;
+
+  const char *p = src;
+  const char *end = src + len;
+
+  uint64_t prev_in_string = carry.in_string;
+  bool prev_escaped = carry.escaped;
+  uint64_t prev_non_ws = carry.prev_ws_like;
+
+  const uint8x16_t v_brace_o = vdupq_n_u8('{');
+  const uint8x16_t v_brace_c = vdupq_n_u8('}');
+  const uint8x16_t v_bracket_o = vdupq_n_u8('[');
+  const uint8x16_t v_bracket_c = vdupq_n_u8(']');
+  const uint8x16_t v_colon = vdupq_n_u8(':');
+  const uint8x16_t v_comma = vdupq_n_u8(',');
+  const uint8x16_t v_quote = vdupq_n_u8('"');
+  const uint8x16_t v_backslash = vdupq_n_u8('\\');
+  const uint8x16_t v_ws_thresh = vdupq_n_u8(0x20);
+
+  while (p + 64 <= end) {
+    uint64_t q_bits = 0, bs_bits = 0, bracket_bits = 0, sep_bits = 0,
+             non_ws = 0;
+
+    for (int i = 0; i < 4; ++i) {
+      uint8x16_t chunk =
+          vld1q_u8(reinterpret_cast<const uint8_t *>(p + i * 16));
+
+      uint8x16_t m_quo = vceqq_u8(chunk, v_quote);
+      uint8x16_t m_esc = vceqq_u8(chunk, v_backslash);
+
+      uint8x16_t m_bracket = vorrq_u8(
+          vorrq_u8(vceqq_u8(chunk, v_brace_o), vceqq_u8(chunk, v_brace_c)),
+          vorrq_u8(vceqq_u8(chunk, v_bracket_o), vceqq_u8(chunk, v_bracket_c)));
+      uint8x16_t m_sep =
+          vorrq_u8(vceqq_u8(chunk, v_colon), vceqq_u8(chunk, v_comma));
+
+      uint8x16_t m_not_white = vcgtq_u8(chunk, v_ws_thresh);
+
+      q_bits |= (uint64_t)neon_movemask(m_quo) << (i * 16);
+      bs_bits |= (uint64_t)neon_movemask(m_esc) << (i * 16);
+      bracket_bits |= (uint64_t)neon_movemask(m_bracket) << (i * 16);
+      sep_bits |= (uint64_t)neon_movemask(m_sep) << (i * 16);
+      non_ws |= (uint64_t)neon_movemask(m_not_white) << (i * 16);
+    }
+
+    uint64_t s_bits = bracket_bits | sep_bits;
+
+    // ── Escape propagation ───────────────────
+    uint64_t escaped = 0;
+    uint64_t temp_esc = bs_bits;
+    if (prev_escaped) {
+      escaped |= 1ULL;
+      prev_escaped = false;
+      if (temp_esc & 1ULL)
+        temp_esc &= ~1ULL;
+    }
+    while (temp_esc) {
+      int start = __builtin_ctzll(temp_esc);
+      uint64_t mask_from_start = ~0ULL << start;
+      uint64_t non_bs_from_start = ~bs_bits & mask_from_start;
+      int run_end =
+          (non_bs_from_start == 0) ? 64 : __builtin_ctzll(non_bs_from_start);
+      int run_len = run_end - start;
+      for (int j = start + 1; j < run_end; j += 2)
+        escaped |= (1ULL << j);
+      if (run_len % 2 != 0) {
+        if (run_end < 64)
+          escaped |= (1ULL << run_end);
+        else
+          prev_escaped = true;
+      }
+      if (run_end == 64)
+        break;
+      temp_esc &= (~0ULL << run_end);
+    }
+
+    uint64_t clean_quotes = q_bits & ~escaped;
+    uint64_t in_string = simd::prefix_xor(clean_quotes) ^ prev_in_string;
+    uint64_t inside = in_string & ~clean_quotes;
+
+    uint64_t external_non_ws = non_ws & ~inside;
+    uint64_t external_symbols = (s_bits & ~inside) | clean_quotes;
+    uint64_t ws_like = (~non_ws & ~inside) | external_symbols;
+
+    uint64_t vstart = (external_non_ws & ~external_symbols) &
+                      (ws_like << 1 | (prev_non_ws >> 63));
+
+    uint64_t structural = ((bracket_bits & ~inside) | clean_quotes) | vstart;
+
+    // Write positions to flat array
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
+    while (structural) {
+      int bit = __builtin_ctzll(structural);
+      out[count++] = base + static_cast<tape_off_t>(bit);
+      structural &= structural - 1;
+    }
+
+    prev_in_string =
+        static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    prev_non_ws = ws_like;
+    p += 64;
+  }
+
+  // ── Tail: pad remaining bytes to 64 with spaces ───────────────────────
+  size_t remaining = static_cast<size_t>(end - p);
+  if (remaining > 0) {
+    alignas(64) char buf[64];
+    std::memset(buf, ' ', 64);
+    std::memcpy(buf, p, remaining);
+
+    uint64_t q_bits = 0, bs_bits = 0, bracket_bits = 0, sep_bits = 0,
+             non_ws = 0;
+
+    for (int i = 0; i < 4; ++i) {
+      uint8x16_t chunk =
+          vld1q_u8(reinterpret_cast<const uint8_t *>(buf + i * 16));
+
+      uint8x16_t m_quo = vceqq_u8(chunk, v_quote);
+      uint8x16_t m_esc = vceqq_u8(chunk, v_backslash);
+
+      uint8x16_t m_bracket = vorrq_u8(
+          vorrq_u8(vceqq_u8(chunk, v_brace_o), vceqq_u8(chunk, v_brace_c)),
+          vorrq_u8(vceqq_u8(chunk, v_bracket_o), vceqq_u8(chunk, v_bracket_c)));
+      uint8x16_t m_sep =
+          vorrq_u8(vceqq_u8(chunk, v_colon), vceqq_u8(chunk, v_comma));
+
+      uint8x16_t m_not_white = vcgtq_u8(chunk, v_ws_thresh);
+
+      q_bits |= (uint64_t)neon_movemask(m_quo) << (i * 16);
+      bs_bits |= (uint64_t)neon_movemask(m_esc) << (i * 16);
+      bracket_bits |= (uint64_t)neon_movemask(m_bracket) << (i * 16);
+      sep_bits |= (uint64_t)neon_movemask(m_sep) << (i * 16);
+      non_ws |= (uint64_t)neon_movemask(m_not_white) << (i * 16);
+    }
+
+    uint64_t s_bits = bracket_bits | sep_bits;
+
+    // Mask to valid bytes only
+    uint64_t m = (remaining >= 64) ? ~0ULL : (1ULL << remaining) - 1;
+    q_bits &= m;
+    bs_bits &= m;
+    bracket_bits &= m;
+    sep_bits &= m;
+    s_bits &= m;
+    non_ws &= m;
+
+    uint64_t escaped = 0;
+    uint64_t temp_esc = bs_bits;
+    if (prev_escaped) {
+      escaped |= 1ULL;
+      prev_escaped = false;
+      if (temp_esc & 1ULL)
+        temp_esc &= ~1ULL;
+    }
+    while (temp_esc) {
+      int start = __builtin_ctzll(temp_esc);
+      uint64_t mask_from_start = ~0ULL << start;
+      uint64_t non_bs_from_start = ~bs_bits & mask_from_start;
+      int run_end =
+          (non_bs_from_start == 0) ? 64 : __builtin_ctzll(non_bs_from_start);
+      int run_len = run_end - start;
+      for (int j = start + 1; j < run_end; j += 2)
+        escaped |= (1ULL << j);
+      if (run_len % 2 != 0 && run_end < 64)
+        escaped |= (1ULL << run_end);
+      if (run_end == 64)
+        break;
+      temp_esc &= (~0ULL << run_end);
+    }
+
+    uint64_t clean_quotes = (q_bits & ~escaped) & m;
+    uint64_t in_string = simd::prefix_xor(clean_quotes) ^ prev_in_string;
+    uint64_t inside = in_string & ~clean_quotes;
+
+    uint64_t external_non_ws = non_ws & ~inside;
+    uint64_t external_symbols = (s_bits & ~inside) | clean_quotes;
+    uint64_t ws_like = (~non_ws & ~inside) | external_symbols;
+    uint64_t vstart = (external_non_ws & ~external_symbols) &
+                      (ws_like << 1 | (prev_non_ws >> 63));
+
+    uint64_t structural = ((bracket_bits & ~inside) | clean_quotes) | vstart;
+
+    if (BEAST_UNLIKELY(count + 64 > idx.capacity)) {
+      idx.grow(count + 64);
+      out = idx.positions;
+    }
+    tape_off_t base = off0 + static_cast<tape_off_t>(p - src);
+    while (structural) {
+      int bit = __builtin_ctzll(structural);
+      out[count++] = base + static_cast<tape_off_t>(bit);
+      structural &= structural - 1;
+    }
+  }
+
+  idx.count = count;
+  return {prev_in_string, prev_escaped, prev_non_ws};
+}
+#endif // BEAST_HAS_NEON
+
+// ─────────────────────────────────────────────────────────────
+// Phase 96: portable Stage 1 scanner
+//
+// Byte-at-a-time form of the kernels above — same entries, same carry —
+// so the Cursor (see below) runs on any target. parse_reuse() does not
+// use it: without SIMD, single-pass parse() is the faster path.
+// ─────────────────────────────────────────────────────────────
+inline Stage1Carry stage1_scan_scalar(const char *src, size_t len,
+                                      Stage1Index &idx, tape_off_t off0 = 0,
+                                      Stage1Carry carry = {}) {
+  idx.reserve(len / 8 + 64);
+  idx.reset();
+  tape_off_t count = 0;
+  bool in_string = carry.in_string != 0;
+  bool escaped = carry.escaped;
+  bool prev_ws_like = (carry.prev_ws_like >> 63) != 0;
+
+  constexpr uint64_t K = 0x0101010101010101ULL;
+  constexpr uint64_t H = 0x8080808080808080ULL;
+  for (size_t i = 0; i < len; ++i) {
+    // SWAR-8 jumps over string bytes up to the next '"' or '\\', and
+    // over whitespace (bytes <= 0x20) between tokens.
+    if (i + 8 <= len && !escaped) {
+      const uint64_t v = load64(src + i);
+      if (in_string) {
+        uint64_t hq = v ^ (K * '"');
+        hq = (hq - K) & ~hq & H;
+        uint64_t hb = v ^ (K * '\\');
+        hb = (hb - K) & ~hb & H;
+        if (!(hq | hb)) {
+          i += 7;
+          continue;
+        }
+        i += BEAST_CTZ(hq | hb) >> 3;
+      } else if (const uint64_t tok = ((v + K * 0x5F) | v) & H; !tok) {
+        prev_ws_like = true; // tok: bytes above 0x20
+        i += 7;
+        continue;
+      } else if (const size_t ws = BEAST_CTZ(tok) >> 3) {
+        prev_ws_like = true;
+        i += ws;
+      }
+    }
+    const char c = src[i];
+    const bool quote = c == '"' && !escaped;
+    escaped = c == '\\' && !escaped;
+    bool emit, ws_like;
+    if (quote) {
+      in_string = !in_string;
+      emit = ws_like = true;
+    } else if (in_string) {
+      emit = ws_like = false;
+    } else {
+      const bool bracket = c == '{' || c == '}' || c == '[' || c == ']';
+      // 0x80-0xFF count as whitespace, as in the SIMD kernels.
+      ws_like = bracket || c == ':' || c == ',' ||
+                static_cast<signed char>(c) <= 0x20;
+      emit = bracket || (!ws_like && prev_ws_like); // bracket or vstart
+    }
+    if (emit) {
+      if (BEAST_UNLIKELY(count == idx.capacity))
+        idx.grow(count + 64);
+      idx.positions[count++] = off0 + static_cast<tape_off_t>(i);
+    }
+    prev_ws_like = ws_like;
+  }
+
+  idx.count = count;
+  return {in_string ? ~0ULL : 0, escaped, prev_ws_like ? 1ULL << 63 : 0};
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 88: Stage 1 entry point
+//
+// Runs the compiled-in Stage 1 kernel, or under BEAST_JSON_RUNTIME_DISPATCH
+// the best one this CPU supports (cpuid, resolved once). Returns false when
+// no kernel is usable — the caller falls back to single-pass parse(). NEON
+// builds keep using parse() (Phase 50 measured no gain there).
+// ─────────────────────────────────────────────────────────────
+// (src, len, idx, off0, carry): scans [src, src + len); entries are
+// off0-relative, so a chunk of a larger document emits document offsets.
+// Returns the carry for the byte after the range — exact when len is a
+// multiple of 64 (the space-padded tail block does not update it).
+using Stage1Fn = Stage1Carry (*)(const char *, size_t, Stage1Index &,
+                                 tape_off_t, Stage1Carry);
+
+#if BEAST_JSON_RUNTIME_DISPATCH
+inline Stage1Fn stage1_select_(bool utf8) noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return utf8 ? &stage1_scan_avx512_utf8 : &stage1_scan_avx512;
+  if (__builtin_cpu_supports("avx2"))
+    return utf8 ? &stage1_scan_avx2_utf8 : &stage1_scan_avx2;
+  return nullptr;
+}
+#endif
+
+// Kernel parse_reuse() will use for the two-phase path (nullptr: none).
+// Phase 100: `utf8` picks the variant that also validates UTF-8.
+inline Stage1Fn stage1_kernel(bool utf8 = false) noexcept {
+#if BEAST_HAS_AVX512
+  return utf8 ? &stage1_scan_avx512_utf8 : &stage1_scan_avx512;
+#elif BEAST_HAS_AVX2
+  return utf8 ? &stage1_scan_avx2_utf8 : &stage1_scan_avx2;
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  static const Stage1Fn fn = stage1_select_(false);
+  static const Stage1Fn fn_utf8 = stage1_select_(true);
+  return utf8 ? fn_utf8 : fn;
+#else
+  (void)utf8;
+  return nullptr;
+#endif
+}
+
+// "AVX-512", "AVX2" or "none" — for benchmarks and diagnostics.
+inline const char *stage1_isa() noexcept {
+  const Stage1Fn fn = stage1_kernel();
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+  if (fn == &stage1_scan_avx512)
+    return "AVX-512";
+#endif
+  return fn ? "AVX2" : "none";
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 32: 256-Entry constexpr Action LUT
 //
 // Replaces the 17-case switch(c) in parse() with an 11-entry
 // switch(kActionLut[c]). Fewer cases → better Branch Target Buffer
@@ -3322,15 +6248,36 @@ class Parser {
   // cur_state_ is register-resident throughout parse() — no memory access per
   // push(). cstate_stack_[d] saves/restores the parent depth's state on
   // open/close bracket events (infrequent: ~8% of tokens in twitter.json).
-  // Supports up to depth 1087 (same as old bit-stack + overflow).
+  // Supports up to depth 1087 (same as old bit-stack + overflow); deeper
+  // input is rejected on open rather than overrunning the stacks.
+  static constexpr size_t kMaxDepth = 1087;
   uint8_t cur_state_ = 0;
-  uint8_t cstate_stack_[1088] = {};
+  uint8_t cstate_stack_[kMaxDepth + 1] = {};
+
+  // Phase 80: tape index of the open node at each depth. push_end()
+  // back-patches the close index (offset) and element count (length bits)
+  // into that node. Uninitialised on purpose: written on open before read.
+  uint32_t open_stack_[kMaxDepth + 1];
+
+  // Phase 83: element count of the innermost open container (keys for
+  // objects). push() bumps it for every non-value token; count_stack_[d]
+  // saves the parent's count across a nested container.
+  uint32_t cur_count_ = 0;
+  uint32_t count_stack_[kMaxDepth + 1];
 
   // Phase 19 Technique 8: local tape_head_ register variable.
   // Kept as a field but initialized from doc_->tape.base in parse().
   // The compiler will register-allocate this across the entire parse() body,
   // eliminating the pointer-chain access doc_->tape.head on every push().
   TapeNode *tape_head_ = nullptr;
+  // Phase 86: arena end. parse() keeps kTapeSlack free nodes ahead of
+  // tape_head_ at the top of every loop iteration; one iteration pushes at
+  // most two (a value plus a fused key or close). parse_staged() needs no
+  // check: its arena is sized from the Stage 1 count.
+  static constexpr size_t kTapeSlack = 4;
+  TapeNode *tape_cap_ = nullptr;
+  // Phase 97: DocumentView::decode_numbers_, read once per parse.
+  bool decode_ = false;
 
   // Phase 59: Key Length Cache — schema-prediction key scanner bypass.
   // For each nesting depth, caches JSON source lengths of object keys seen in
@@ -3351,6 +6298,21 @@ class Parser {
     uint16_t lens[MAX_DEPTH][MAX_KEYS] = {}; // cached source lengths (0=unset)
   } kc_;
 
+  // ── Phase 95: padded input ─────────────────────────────────
+  // The scanners below and parse() / parse_staged_() take kPadded = true
+  // for input followed by at least kPadding zero bytes (parse_padded()).
+  // A wide load is then legal at any p < end_, so the vector loops run to
+  // the end of the input and the scalar tail loops after them compile
+  // away. A zero byte is neither a digit nor a literal letter, so digit
+  // runs and true / false / null need no bounds check at all.
+  template <bool kPadded>
+  BEAST_INLINE bool can_load_(const char *p, size_t n) const noexcept {
+    if constexpr (kPadded)
+      return p < end_;
+    else
+      return p + n <= end_;
+  }
+
   // ── skip_to_action: SWAR-8 + scalar whitespace skip chain ──
   // Returns the first action byte and advances p_ past whitespace.
   // Use the returned char directly in switch(c) — avoids extra *p_ read.
@@ -3359,6 +6321,7 @@ class Parser {
   // distribution (typically 2-8 consecutive WS bytes between tokens), the
   // vld1q_u8 overhead exceeds the gain vs SWAR-8. NEON accelerates bulk
   // whitespace (>16 consecutive bytes), which is rare here.
+  template <bool kPadded = false>
   BEAST_INLINE char skip_to_action() noexcept {
     // Fast path: already on action byte.
     // Guard p_ < end_ before dereferencing: callers may reach here with
@@ -3387,7 +6350,7 @@ class Parser {
       p_ += 8;
     }
     // Still in whitespace → bulk path: AVX-512 64B/iter for long WS runs.
-    if (BEAST_LIKELY(p_ + 64 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(p_, 64))) {
       const __m512i ws_thresh = _mm512_set1_epi8(0x20);
       do {
         __m512i v = _mm512_loadu_si512(reinterpret_cast<const __m512i *>(p_));
@@ -3398,10 +6361,10 @@ class Parser {
           return *p_;
         }
         p_ += 64;
-      } while (BEAST_LIKELY(p_ + 64 <= end_));
+      } while (BEAST_LIKELY(can_load_<kPadded>(p_, 64)));
     }
     // <64B tail: SWAR-8 scalar walk
-    while (BEAST_LIKELY(p_ + 8 <= end_)) {
+    while (BEAST_LIKELY(can_load_<kPadded>(p_, 8))) {
       uint64_t am = swar_action_mask(load64(p_));
       if (BEAST_LIKELY(am != 0)) {
         p_ += BEAST_CTZ(am) >> 3;
@@ -3415,7 +6378,7 @@ class Parser {
     // (vld1q) and max-reduce (vmaxvq) have significantly lower latency and
     // higher throughput than scalar GPR dependencies on both Apple Silicon
     // and Generic ARM cores.
-    while (BEAST_LIKELY(p_ + 16 <= end_)) {
+    while (BEAST_LIKELY(can_load_<kPadded>(p_, 16))) {
       uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p_));
       uint8x16_t mask = vcgtq_u8(v, vdupq_n_u8(0x20));
       // vmaxvq returns the max 32-bit element. If any byte was > 0x20,
@@ -3431,7 +6394,7 @@ class Parser {
     }
 #else
     // SWAR-32 fallback (no SIMD available)
-    while (BEAST_LIKELY(p_ + 32 <= end_)) {
+    while (BEAST_LIKELY(can_load_<kPadded>(p_, 32))) {
       uint64_t a0 = swar_action_mask(load64(p_));
       uint64_t a1 = swar_action_mask(load64(p_ + 8));
       uint64_t a2 = swar_action_mask(load64(p_ + 16));
@@ -3454,7 +6417,7 @@ class Parser {
       }
       p_ += 32;
     }
-    while (BEAST_LIKELY(p_ + 8 <= end_)) {
+    while (BEAST_LIKELY(can_load_<kPadded>(p_, 8))) {
       uint64_t am = swar_action_mask(load64(p_));
       if (BEAST_LIKELY(am != 0)) {
         p_ += BEAST_CTZ(am) >> 3;
@@ -3464,6 +6427,8 @@ class Parser {
     }
 #endif
 
+    if constexpr (kPadded)
+      return 0; // the loops above only stop early on an action byte
     // Scalar tail
     while (p_ < end_) {
       c = static_cast<unsigned char>(*p_);
@@ -3485,6 +6450,7 @@ class Parser {
   //   aarch64 (NEON 16B)  ← PRIMARY   — M1 / ARMv8+
   //   x86_64  (SSE2 16B)  ← SECONDARY — Nehalem+, all modern x86
   //   generic (SWAR-16)   ← FALLBACK
+  template <bool kPadded = false>
   BEAST_INLINE const char *scan_string_end(const char *p) noexcept {
     constexpr uint64_t K = 0x0101010101010101ULL;
     constexpr uint64_t H = 0x8080808080808080ULL;
@@ -3495,7 +6461,7 @@ class Parser {
     // Short strings (≤8 chars) exit here with zero SIMD overhead.
     // Backslash-early strings also exit early (benefit escape-heavy JSON).
 #if !BEAST_HAS_NEON
-    if (BEAST_LIKELY(p + 8 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(p, 8))) {
       uint64_t v0;
       std::memcpy(&v0, p, 8);
       uint64_t hq0 = v0 ^ qm;
@@ -3515,7 +6481,7 @@ class Parser {
     {
       const uint8x16_t vq = vdupq_n_u8('"');
       const uint8x16_t vbs = vdupq_n_u8('\\');
-      while (BEAST_LIKELY(p + 16 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 16))) {
         uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
         uint8x16_t m = vorrq_u8(vceqq_u8(v, vq), vceqq_u8(v, vbs));
         if (BEAST_UNLIKELY(vmaxvq_u32(vreinterpretq_u32_u8(m)) != 0)) {
@@ -3538,7 +6504,7 @@ class Parser {
     {
       const __m512i vq512 = _mm512_set1_epi8('"');
       const __m512i vbs512 = _mm512_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 64 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 64))) {
         __m512i v = _mm512_loadu_si512(reinterpret_cast<const __m512i *>(p));
         uint64_t mask = _mm512_cmpeq_epi8_mask(v, vq512) |
                         _mm512_cmpeq_epi8_mask(v, vbs512);
@@ -3554,7 +6520,7 @@ class Parser {
     {
       const __m256i vq = _mm256_set1_epi8('"');
       const __m256i vbs = _mm256_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 32 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 32))) {
         __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
         uint32_t mask =
             static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(
@@ -3568,7 +6534,7 @@ class Parser {
     {
       const __m128i vq = _mm_set1_epi8('"');
       const __m128i vbs = _mm_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 16 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 16))) {
         __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
         int mask = _mm_movemask_epi8(
             _mm_or_si128(_mm_cmpeq_epi8(v, vq), _mm_cmpeq_epi8(v, vbs)));
@@ -3582,7 +6548,7 @@ class Parser {
     {
       const __m128i vq = _mm_set1_epi8('"');
       const __m128i vbs = _mm_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 16 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 16))) {
         __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
         int mask = _mm_movemask_epi8(
             _mm_or_si128(_mm_cmpeq_epi8(v, vq), _mm_cmpeq_epi8(v, vbs)));
@@ -3593,7 +6559,7 @@ class Parser {
     }
 #else
     // Generic SWAR-16 fallback (no SIMD available)
-    while (p + 16 <= end_) {
+    while (can_load_<kPadded>(p, 16)) {
       uint64_t v0, v1;
       std::memcpy(&v0, p, 8);
       std::memcpy(&v1, p + 8, 8);
@@ -3615,6 +6581,8 @@ class Parser {
     }
 #endif
 
+    if constexpr (kPadded)
+      return p; // p >= end_: unterminated
     // ── Tail: 8B SWAR + scalar ─────────────────────────────────────
     if (p + 8 <= end_) {
       uint64_t v;
@@ -3633,9 +6601,10 @@ class Parser {
     return p;
   }
 
+  template <bool kPadded = false>
   BEAST_INLINE const char *skip_string(const char *p) noexcept {
     while (p < end_) {
-      p = scan_string_end(p);
+      p = scan_string_end<kPadded>(p);
       if (p >= end_)
         return end_;
       if (*p == '"')
@@ -3652,12 +6621,13 @@ class Parser {
   // Saves ~11 scalar instructions per call by using AVX2 directly at p =
   // s+32 (no 8-byte prologue). For strings 32-63 chars: 1 AVX2 op total vs
   // SWAR-8+AVX2 (17 instructions).
+  template <bool kPadded = false>
   BEAST_INLINE const char *skip_string_from32(const char *s) noexcept {
     const char *p = s + 32;
 #if BEAST_HAS_AVX2
     const __m256i vq = _mm256_set1_epi8('"');
     const __m256i vbs = _mm256_set1_epi8('\\');
-    while (BEAST_LIKELY(p + 32 <= end_)) {
+    while (BEAST_LIKELY(can_load_<kPadded>(p, 32))) {
       __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
       uint32_t mask =
           static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(
@@ -3675,7 +6645,7 @@ class Parser {
     {
       const __m128i vq128 = _mm_set1_epi8('"');
       const __m128i vbs128 = _mm_set1_epi8('\\');
-      while (p + 16 <= end_) {
+      while (can_load_<kPadded>(p, 16)) {
         __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
         int mask = _mm_movemask_epi8(
             _mm_or_si128(_mm_cmpeq_epi8(v, vq128), _mm_cmpeq_epi8(v, vbs128)));
@@ -3692,7 +6662,7 @@ class Parser {
 #endif
     // SWAR-8 + scalar tail (platform-agnostic, handles last <16B)
     while (p < end_) {
-      p = scan_string_end(p);
+      p = scan_string_end<kPadded>(p);
       if (p >= end_)
         return end_;
       if (*p == '"')
@@ -3708,12 +6678,13 @@ class Parser {
   // clean by an AVX-512 inline scan. For strings 64-127 chars: 1 AVX-512 op
   // total vs full scan_string_end().
 #if BEAST_HAS_AVX512
+  template <bool kPadded = false>
   BEAST_INLINE const char *skip_string_from64(const char *s) noexcept {
     const char *p = s + 64;
     {
       const __m512i vq512 = _mm512_set1_epi8('"');
       const __m512i vbs512 = _mm512_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 64 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 64))) {
         __m512i v = _mm512_loadu_si512(reinterpret_cast<const __m512i *>(p));
         uint64_t mask = _mm512_cmpeq_epi8_mask(v, vq512) |
                         _mm512_cmpeq_epi8_mask(v, vbs512);
@@ -3731,7 +6702,7 @@ class Parser {
     {
       const __m256i vq = _mm256_set1_epi8('"');
       const __m256i vbs = _mm256_set1_epi8('\\');
-      while (BEAST_LIKELY(p + 32 <= end_)) {
+      while (BEAST_LIKELY(can_load_<kPadded>(p, 32))) {
         __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
         uint32_t mask =
             static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(
@@ -3750,7 +6721,7 @@ class Parser {
     {
       const __m128i vq128 = _mm_set1_epi8('"');
       const __m128i vbs128 = _mm_set1_epi8('\\');
-      while (p + 16 <= end_) {
+      while (can_load_<kPadded>(p, 16)) {
         __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
         int mask = _mm_movemask_epi8(
             _mm_or_si128(_mm_cmpeq_epi8(v, vq128), _mm_cmpeq_epi8(v, vbs128)));
@@ -3766,7 +6737,7 @@ class Parser {
     }
     // Scalar tail (platform-agnostic, handles last <16B)
     while (p < end_) {
-      p = scan_string_end(p);
+      p = scan_string_end<kPadded>(p);
       if (p >= end_)
         return end_;
       if (*p == '"')
@@ -3787,6 +6758,7 @@ class Parser {
   // Phase B1 upgrade: SWAR-24 fast path (same as main switch case '"':)
   // covers ≤24-byte keys with no backslash, accounting for 90%+ of
   // twitter.json keys.
+  template <bool kPadded = false>
   BEAST_INLINE char scan_key_colon_next(const char *s,
                                         const char **key_end_out) noexcept {
     // s is the char after the opening '"' of the key.
@@ -3829,7 +6801,7 @@ class Parser {
     // ── Phase 43: AVX-512 64B one-shot key scan
     // ───────────────────────────── Handles keys ≤63 chars in one 512-bit
     // operation.
-    if (BEAST_LIKELY(s + 64 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(s, 64))) {
       const __m512i _vq512 = _mm512_set1_epi8('"');
       const __m512i _vbs512 = _mm512_set1_epi8('\\');
       __m512i _v512 = _mm512_loadu_si512(reinterpret_cast<const __m512i *>(s));
@@ -3843,7 +6815,7 @@ class Parser {
         goto skn_slow; // backslash → full scanner
       }
       // mask==0: bytes [s, s+64) clean → skip_string_from64
-      e = skip_string_from64(s);
+      e = skip_string_from64<kPadded>(s);
       if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
         return 0;
       goto skn_found;
@@ -3854,7 +6826,7 @@ class Parser {
     // ───────────────────────────────────────── Handles keys ≤31 chars in
     // one 256-bit operation. mask==0 or backslash → goto skn_slow directly
     // (no SWAR-24 redundancy).
-    if (BEAST_LIKELY(s + 32 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(s, 32))) {
       const __m256i _vq = _mm256_set1_epi8('"');
       const __m256i _vbs = _mm256_set1_epi8('\\');
       __m256i _v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
@@ -3871,7 +6843,7 @@ class Parser {
       // ── Phase 41: mask==0 — bytes [s, s+32) are clean ────────────────
       // skip_string_from32 starts AVX2 at s+32 directly, skipping
       // scan_string_end's SWAR-8 gate (~11 instructions saved per call).
-      e = skip_string_from32(s);
+      e = skip_string_from32<kPadded>(s);
       if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
         return 0;
       goto skn_found;
@@ -3901,7 +6873,7 @@ class Parser {
     // For keys >48B (all 3 clean): skip_string(s+48) avoids rescanning 48B.
     // For keys 32-48B (v1+v2 clean, gate fails): fall to 2×16B path below.
     // For keys ≤32B (common case): identical hot path to the 2×16B baseline.
-    if (BEAST_LIKELY(s + 48 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(s, 48))) {
       const uint8x16_t vq = vdupq_n_u8('"');
       const uint8x16_t vbs = vdupq_n_u8('\\');
 
@@ -3939,13 +6911,13 @@ class Parser {
       }
 
       // [s, s+48) confirmed clean — skip_string(s+48) bypasses rescanning
-      e = skip_string(s + 48);
+      e = skip_string<kPadded>(s + 48);
       if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
         return 0; // malformed
       goto skn_found;
     }
     // 32 ≤ remaining < 48: 2×16B with skip_string(s+32) bypass
-    if (BEAST_LIKELY(s + 32 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(s, 32))) {
       const uint8x16_t vq = vdupq_n_u8('"');
       const uint8x16_t vbs = vdupq_n_u8('\\');
 
@@ -3972,7 +6944,7 @@ class Parser {
       }
 
       // [s, s+32) clean → continue from s+32 (avoids rescanning via skn_slow)
-      e = skip_string(s + 32);
+      e = skip_string<kPadded>(s + 32);
       if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
         return 0; // malformed
       goto skn_found;
@@ -3997,7 +6969,7 @@ class Parser {
     //
     // Phase 65-M1: when both 16B checks are clean (key >32B), call
     // skip_string(s+32) instead of goto skn_slow to avoid rescanning [s,s+32).
-    if (BEAST_LIKELY(s + 32 <= end_)) {
+    if (BEAST_LIKELY(can_load_<kPadded>(s, 32))) {
       const uint8x16_t vq = vdupq_n_u8('"');
       const uint8x16_t vbs = vdupq_n_u8('\\');
 
@@ -4024,7 +6996,7 @@ class Parser {
       }
 
       // [s, s+32) confirmed clean — skip_string(s+32) avoids rescanning
-      e = skip_string(s + 32);
+      e = skip_string<kPadded>(s + 32);
       if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
         return 0; // malformed
       goto skn_found;
@@ -4043,7 +7015,7 @@ class Parser {
       constexpr uint64_t H = 0x8080808080808080ULL;
       const uint64_t qm = K * static_cast<uint8_t>('"');
       const uint64_t bsm = K * static_cast<uint8_t>('\\');
-      if (BEAST_LIKELY(s + 24 <= end_)) {
+      if (BEAST_LIKELY(can_load_<kPadded>(s, 24))) {
         uint64_t v0;
         std::memcpy(&v0, s, 8);
         uint64_t hq0 = v0 ^ qm;
@@ -4082,7 +7054,7 @@ class Parser {
     } // end SWAR-24 scope (K/H/qm/bsm)
 #endif // BEAST_HAS_AVX2
   skn_slow:
-    e = skip_string(s);
+    e = skip_string<kPadded>(s);
     if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
       return 0; // malformed
   skn_found:
@@ -4090,7 +7062,7 @@ class Parser {
     if (BEAST_LIKELY(kd < KeyLenCache::MAX_DEPTH)) {
       const uint8_t kidx = kc_.key_idx[kd];
       if (kidx < KeyLenCache::MAX_KEYS) {
-        if (kc_.lens[kd][kidx] == 0)
+        if (kc_.lens[kd][kidx] == 0 && BEAST_LIKELY(e - s <= 0xFFFF))
           kc_.lens[kd][kidx] = static_cast<uint16_t>(e - s);
         kc_.key_idx[kd] = kidx + 1;
       }
@@ -4098,8 +7070,8 @@ class Parser {
   skn_cache_hit:
     if (key_end_out)
       *key_end_out = e;
-    push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-         static_cast<uint32_t>(s - data_));
+    push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+             static_cast<tape_off_t>(s - data_));
     p_ = e + 1; // advance past closing '"'
 
     // Now: consume ':' and skip whitespace to the value start.
@@ -4111,16 +7083,16 @@ class Parser {
         unsigned char nc = static_cast<unsigned char>(*p_);
         if (BEAST_LIKELY(nc > 0x20))
           return static_cast<char>(nc);
-        return skip_to_action();
+        return skip_to_action<kPadded>();
       }
       return 0;
     }
     // Rare: whitespace between key and colon, or missing colon
-    char ch = skip_to_action();
+    char ch = skip_to_action<kPadded>();
     if (ch != ':')
       return ch; // let outer loop handle it
     ++p_;
-    return skip_to_action();
+    return skip_to_action<kPadded>();
   }
 
   // ── Phase 19 Technique 8: tape push via local register pointer ─
@@ -4132,7 +7104,7 @@ class Parser {
   //   sep = 0  → no separator  (root, first array element, first object
   //   key) sep = 1  → comma         (non-first array element or object key)
   //   sep = 2  → colon         (object value, always)
-  BEAST_INLINE void push(TapeNodeType t, uint16_t l, uint32_t o) noexcept {
+  BEAST_INLINE void push(TapeNodeType t, uint16_t l, tape_off_t o) noexcept {
     // Phase 58-A: prefetch tape write slot 16 TapeNodes (192B) ahead — store
     // hint. Hides tape-arena write latency; significant gain on large files
     // (canada).
@@ -4157,6 +7129,9 @@ class Parser {
       const uint8_t cs = cur_state_;
       sep = sep_lut[cs];
       cur_state_ = ncs_lut[cs];
+      // Phase 83: every push except an object value (sep=2) is a new
+      // array element or object key.
+      cur_count_ += (sep != 2);
     }
     TapeNode *n = tape_head_++;
     n->meta = (static_cast<uint32_t>(t) << 24) |
@@ -4164,8 +7139,45 @@ class Parser {
     n->offset = o;
   }
 
+  // Phase 84: push() for StringRaw / number tokens. Lengths that do not fit
+  // the 16 length bits take the cold push_long_() path; the compare is the
+  // only cost on the common path.
+  BEAST_INLINE void push_len(TapeNodeType t, size_t l, tape_off_t o) {
+    if (BEAST_UNLIKELY(l > 0xFFFFu)) {
+      push_long_(t, l, o);
+      return;
+    }
+    push(t, static_cast<uint16_t>(l), o);
+  }
+
+  BEAST_NOINLINE void push_long_(TapeNodeType t, size_t l, tape_off_t o) {
+    doc_->long_lens_.emplace_back(tape_size(), static_cast<tape_off_t>(l));
+    push(t, 0xFFFFu, o);
+    tape_head_[-1].meta |= TapeNode::kLongLenFlag;
+  }
+
+  // push_open(): for ObjectStart / ArrayStart — records the node's tape index
+  // for push_end()'s back-patch and starts a fresh element count.
+  // Call BEFORE ++depth_.
+  BEAST_INLINE void push_open(TapeNodeType t, tape_off_t o) noexcept {
+    open_stack_[depth_] = tape_size();
+    push(t, 0, o); // counts as an element of the parent
+    count_stack_[depth_] = cur_count_;
+    cur_count_ = 0;
+  }
+
   // push_end(): for ObjectEnd / ArrayEnd — always sep=0, no state update.
-  BEAST_INLINE void push_end(TapeNodeType t, uint32_t o) noexcept {
+  // Call AFTER --depth_ so open_stack_[depth_] is the matching open node.
+  BEAST_INLINE void push_end(TapeNodeType t, tape_off_t o) noexcept {
+    TapeNode &open = doc_->tape.base[open_stack_[depth_]];
+    // Phase 83: element count → open node's length bits (saturating).
+    open.meta |= cur_count_ < TapeNode::kCountSaturated
+                     ? cur_count_
+                     : TapeNode::kCountSaturated;
+    cur_count_ = count_stack_[depth_];
+#if BEAST_JSON_TAPE_LINKS
+    open.offset = tape_size();
+#endif
     TapeNode *n = tape_head_++;
     n->meta = static_cast<uint32_t>(t) << 24; // sep=0, len=0
     n->offset = o;
@@ -4175,28 +7187,66 @@ class Parser {
     return static_cast<uint32_t>(tape_head_ - doc_->tape.base);
   }
 
-public:
-  explicit Parser(DocumentView *doc)
-      : p_(doc->data()), end_(doc->data() + doc->size()), data_(doc->data()),
-        doc_(doc),
-        tape_head_(doc->tape.base) // initialize local head from arena base
-  {}
-
-  // ── Phase 19: main parse loop ──────────────────────────────
-  // Key changes vs Phase 18:
+  // Phase 97: cold path of kActNumber under enable_number_decoding().
+  // Decodes the number just pushed into numbers_[its tape index] and flags
+  // the node. Values Value::as<T>() would compute differently are left
+  // undecoded — text that does not parse, and "-0" (as<double>() keeps the
+  // sign) — and keep the text path.
+  BEAST_NOINLINE void decode_number_(const char *s, const char *e, bool flt) {
+    const uint32_t i = tape_size() - 1;
+    std::vector<uint64_t> &nums = doc_->numbers_;
+    if (BEAST_UNLIKELY(i >= nums.size()))
+      nums.resize(std::max<size_t>(doc_->tape.capacity(), i + size_t{1}));
+    uint64_t bits;
+    if (flt) {
+      double d = 0.0;
+      if (parse_double(s, e, d).ec != std::errc{})
+        return;
+      std::memcpy(&bits, &d, sizeof(bits));
+    } else {
+      int64_t v = 0;
+      if (std::from_chars(s, e, v).ec != std::errc{} || (v == 0 && *s == '-'))
+        return;
+      bits = static_cast<uint64_t>(v);
+    }
+    nums[i] = bits;
+    tape_head_[-1].meta |= TapeNode::kDecodedFlag;
+  }
+
+  // Phase 86: cold path of parse()'s per-iteration capacity check.
+  BEAST_NOINLINE void grow_tape_() {
+    doc_->tape.head = tape_head_;
+    doc_->tape.grow(doc_->tape.capacity() + kTapeSlack);
+    tape_head_ = doc_->tape.head;
+    tape_cap_ = doc_->tape.cap;
+  }
+
+public:
+  explicit Parser(DocumentView *doc)
+      : p_(doc->data()), end_(doc->data() + doc->size()), data_(doc->data()),
+        doc_(doc),
+        tape_head_(doc->tape.base), // initialize local head from arena base
+        tape_cap_(doc->tape.cap), decode_(doc->decode_numbers_) {}
+
+  // ── Phase 19: main parse loop ──────────────────────────────
+  // Key changes vs Phase 18:
   //   1. char c = skip_to_action()  → switch(c) avoids re-read of *p_
   //   2. tape_head_ is local → no doc_->tape.size() pointer chain
   //   3. NEON 16-byte WS skip in skip_to_action() path
+  template <bool kPadded = false>
   [[gnu::hot, gnu::flatten]] bool parse() {
     // skip_to_action() returns the first action char AND advances p_.
     // We keep 'c' as the dispatch value — no *p_ re-read needed.
-    char c = skip_to_action();
+    char c = skip_to_action<kPadded>();
     if (BEAST_UNLIKELY(c == 0 || p_ >= end_)) {
       doc_->tape.head = tape_head_; // sync
       return false;
     }
 
     while (p_ < end_) {
+      if (BEAST_UNLIKELY(static_cast<size_t>(tape_cap_ - tape_head_) <
+                         kTapeSlack))
+        grow_tape_();
       // Phase 58-A / Apple Silicon: prefetch BEAST_PREFETCH_DISTANCE bytes
       // ahead with L2 locality hint. Distance is arch-tuned at compile time:
       //   Apple Silicon (M1/M2/M3): 512B (4 × 128B cache lines)
@@ -4210,9 +7260,9 @@ public:
 
       case kActObjOpen: {
         // Nested objects/arrays are not valid object keys (RFC 8259 §4).
-        if (BEAST_UNLIKELY(cur_state_ & 0b001u))
+        if (BEAST_UNLIKELY((cur_state_ & 0b001u) || depth_ >= kMaxDepth))
           goto fail;
-        push(TapeNodeType::ObjectStart, 0, static_cast<uint32_t>(p_ - data_));
+        push_open(TapeNodeType::ObjectStart, static_cast<tape_off_t>(p_ - data_));
         // Phase 60-A: save parent state, init new object context.
         // cstate_stack_[depth_] saves cur_state_ for restore on close.
         cstate_stack_[depth_] = cur_state_;
@@ -4232,9 +7282,9 @@ public:
         break;
       }
       case kActArrOpen: {
-        if (BEAST_UNLIKELY(cur_state_ & 0b001u))
+        if (BEAST_UNLIKELY((cur_state_ & 0b001u) || depth_ >= kMaxDepth))
           goto fail;
-        push(TapeNodeType::ArrayStart, 0, static_cast<uint32_t>(p_ - data_));
+        push_open(TapeNodeType::ArrayStart, static_cast<tape_off_t>(p_ - data_));
         // Phase 60-A: save parent state, init new array context.
         cstate_stack_[depth_] = cur_state_;
         cur_state_ = 0b000u; // in_obj=0, is_key=0, has_elem=0
@@ -4256,7 +7306,7 @@ public:
         // Phase 60-A: restore parent depth's state (no mask arithmetic).
         cur_state_ = cstate_stack_[depth_];
         push_end(c == '}' ? TapeNodeType::ObjectEnd : TapeNodeType::ArrayEnd,
-                 static_cast<uint32_t>(p_ - data_));
+                 static_cast<tape_off_t>(p_ - data_));
         ++p_;
         break;
       }
@@ -4272,7 +7322,7 @@ public:
         // ────────────────────── One 512-bit load handles ≤63-char strings
         // in a single zmm op. Expected gain: citm (long keys) −5~10%,
         // twitter moderate.
-        if (BEAST_LIKELY(s + 64 <= end_)) {
+        if (BEAST_LIKELY(can_load_<kPadded>(s, 64))) {
           const __m512i _vq512 = _mm512_set1_epi8('"');
           const __m512i _vbs512 = _mm512_set1_epi8('\\');
           __m512i _v512 =
@@ -4282,19 +7332,19 @@ public:
           if (BEAST_LIKELY(_mask512 != 0)) {
             e = s + __builtin_ctzll(_mask512);
             if (BEAST_LIKELY(*e == '"')) {
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
             goto str_slow; // backslash first → full scanner
           }
           // mask==0: bytes [s, s+64) clean → skip_string_from64
-          e = skip_string_from64(s);
+          e = skip_string_from64<kPadded>(s);
           if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
             goto fail;
-          push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-               static_cast<uint32_t>(s - data_));
+          push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                   static_cast<tape_off_t>(s - data_));
           p_ = e + 1;
           goto str_done;
         }
@@ -4305,7 +7355,7 @@ public:
         // 31 chars in 1 SIMD op. twitter.json: 84% of strings ≤24 chars —
         // major hot-path speedup. mask==0 or backslash → goto str_slow
         // directly (no SWAR-24 redundancy).
-        if (BEAST_LIKELY(s + 32 <= end_)) {
+        if (BEAST_LIKELY(can_load_<kPadded>(s, 32))) {
           const __m256i _vq = _mm256_set1_epi8('"');
           const __m256i _vbs = _mm256_set1_epi8('\\');
           __m256i _v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s));
@@ -4315,8 +7365,8 @@ public:
           if (BEAST_LIKELY(_mask != 0)) {
             e = s + __builtin_ctz(_mask);
             if (BEAST_LIKELY(*e == '"')) {
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
@@ -4326,11 +7376,11 @@ public:
           // skip_string_from32 starts AVX2 at s+32 directly, skipping
           // scan_string_end's SWAR-8 gate (~11 instructions saved per
           // call).
-          e = skip_string_from32(s);
+          e = skip_string_from32<kPadded>(s);
           if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
             goto fail;
-          push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-               static_cast<uint32_t>(s - data_));
+          push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                   static_cast<tape_off_t>(s - data_));
           p_ = e + 1;
           goto str_done;
         }
@@ -4342,7 +7392,7 @@ public:
         // value strings: tweet dates, screen names, short URLs).
         // For strings > 31 chars the 32B check is clean → skip_string_from32
         // to avoid rescanning the first 32B (important for long tweet text).
-        if (BEAST_LIKELY(s + 32 <= end_)) {
+        if (BEAST_LIKELY(can_load_<kPadded>(s, 32))) {
           const uint8x16_t vq = vdupq_n_u8('"');
           const uint8x16_t vbs = vdupq_n_u8('\\');
           uint8x16_t v1 = vld1q_u8(reinterpret_cast<const uint8_t *>(s));
@@ -4352,8 +7402,8 @@ public:
             while (*e != '"' && *e != '\\')
               ++e;
             if (BEAST_LIKELY(*e == '"')) {
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
@@ -4366,8 +7416,8 @@ public:
             while (*e != '"' && *e != '\\')
               ++e;
             if (BEAST_LIKELY(*e == '"')) {
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
@@ -4375,11 +7425,11 @@ public:
           }
           // [s, s+32) clean: long string — skip_string_from32 starts
           // SWAR-8 at s+32, avoiding rescan of the clean first 32B.
-          e = skip_string_from32(s);
+          e = skip_string_from32<kPadded>(s);
           if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
             goto fail;
-          push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-               static_cast<uint32_t>(s - data_));
+          push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                   static_cast<tape_off_t>(s - data_));
           p_ = e + 1;
           goto str_done;
         }
@@ -4388,7 +7438,7 @@ public:
         // SWAR cascaded: load v0 first, early exit for ≤8-char strings
         // (Phase D2: covers 36% of twitter.json strings without loading
         // v1/v2). twitter.json coverage: ≤8 (36%), ≤16 (64%), ≤24 (84%)
-        if (BEAST_LIKELY(s + 24 <= end_)) {
+        if (BEAST_LIKELY(can_load_<kPadded>(s, 24))) {
           uint64_t v0;
           std::memcpy(&v0, s, 8);
           uint64_t hq0 = v0 ^ qm;
@@ -4398,8 +7448,8 @@ public:
           if (BEAST_LIKELY(!hb0)) {
             if (hq0) { // ≤8-char string, no backslash
               e = s + (BEAST_CTZ(hq0) >> 3);
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
@@ -4423,13 +7473,13 @@ public:
               } else {
                 goto str_slow;
               }
-              push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                   static_cast<uint32_t>(s - data_));
+              push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                       static_cast<tape_off_t>(s - data_));
               p_ = e + 1;
               goto str_done;
             }
           }
-        } else if (s + 8 <= end_) {
+        } else if (can_load_<kPadded>(s, 8)) {
           uint64_t v;
           std::memcpy(&v, s, 8);
           uint64_t hq = v ^ qm;
@@ -4438,19 +7488,19 @@ public:
           hb = (hb - K) & ~hb & H;
           if (BEAST_LIKELY(hq && !hb)) {
             e = s + (BEAST_CTZ(hq) >> 3);
-            push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-                 static_cast<uint32_t>(s - data_));
+            push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                     static_cast<tape_off_t>(s - data_));
             p_ = e + 1;
             goto str_done;
           }
         }
       str_slow:
         // Strings >24 bytes or containing backslash — full SWAR-16 scanner
-        e = skip_string(s);
+        e = skip_string<kPadded>(s);
         if (BEAST_UNLIKELY(e >= end_ || *e != '"'))
           goto fail;
-        push(TapeNodeType::StringRaw, static_cast<uint16_t>(e - s),
-             static_cast<uint32_t>(s - data_));
+        push_len(TapeNodeType::StringRaw, static_cast<size_t>(e - s),
+                 static_cast<tape_off_t>(s - data_));
         p_ = e + 1;
 
       str_done:
@@ -4459,7 +7509,7 @@ public:
         if (BEAST_LIKELY(p_ < end_)) {
           unsigned char nc = static_cast<unsigned char>(*p_);
           if (nc <= 0x20) {
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             nc = static_cast<unsigned char>(c);
@@ -4467,7 +7517,7 @@ public:
           if (BEAST_LIKELY(nc == ':')) {
             // After a key: consume ':' and find value start.
             ++p_;
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue; // bypass loop bottom, straight to value
@@ -4486,13 +7536,13 @@ public:
               if (BEAST_LIKELY(p_ < end_)) {
                 unsigned char fc = static_cast<unsigned char>(*p_);
                 if (fc <= 0x20) {
-                  fc = static_cast<unsigned char>(skip_to_action());
+                  fc = static_cast<unsigned char>(skip_to_action<kPadded>());
                   if (BEAST_UNLIKELY(p_ >= end_))
                     goto done;
                 }
                 if (BEAST_LIKELY(fc == '"')) {
                   // Fused key scan: SWAR-24 + push + ':' consume + WS skip
-                  char vc = scan_key_colon_next(p_ + 1, nullptr);
+                  char vc = scan_key_colon_next<kPadded>(p_ + 1, nullptr);
                   if (BEAST_UNLIKELY(vc == 0))
                     goto fail;
                   if (BEAST_UNLIKELY(p_ >= end_))
@@ -4507,7 +7557,7 @@ public:
               goto done;
             }
             // Not in object (in array): find next element
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue; // bypass loop bottom, straight to next token!
@@ -4520,9 +7570,9 @@ public:
             cur_state_ = cstate_stack_[depth_];
             push_end(nc == '}' ? TapeNodeType::ObjectEnd
                                : TapeNodeType::ArrayEnd,
-                     static_cast<uint32_t>(p_ - data_));
+                     static_cast<tape_off_t>(p_ - data_));
             ++p_;
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue;
@@ -4534,8 +7584,9 @@ public:
         // Non-string values are illegal as object keys (RFC 8259 §4).
         if (BEAST_UNLIKELY(cur_state_ & 0b001u))
           goto fail;
-        if (BEAST_LIKELY(p_ + 4 <= end_ && !std::memcmp(p_, "true", 4))) {
-          push(TapeNodeType::BooleanTrue, 4, static_cast<uint32_t>(p_ - data_));
+        if (BEAST_LIKELY((kPadded || p_ + 4 <= end_) &&
+                         !std::memcmp(p_, "true", 4))) {
+          push(TapeNodeType::BooleanTrue, 4, static_cast<tape_off_t>(p_ - data_));
           p_ += 4;
         } else
           goto fail;
@@ -4543,9 +7594,10 @@ public:
       case kActFalse:
         if (BEAST_UNLIKELY(cur_state_ & 0b001u))
           goto fail;
-        if (BEAST_LIKELY(p_ + 5 <= end_ && !std::memcmp(p_, "false", 5))) {
+        if (BEAST_LIKELY((kPadded || p_ + 5 <= end_) &&
+                         !std::memcmp(p_, "false", 5))) {
           push(TapeNodeType::BooleanFalse, 5,
-               static_cast<uint32_t>(p_ - data_));
+               static_cast<tape_off_t>(p_ - data_));
           p_ += 5;
         } else
           goto fail;
@@ -4553,8 +7605,9 @@ public:
       case kActNull:
         if (BEAST_UNLIKELY(cur_state_ & 0b001u))
           goto fail;
-        if (BEAST_LIKELY(p_ + 4 <= end_ && !std::memcmp(p_, "null", 4))) {
-          push(TapeNodeType::Null, 4, static_cast<uint32_t>(p_ - data_));
+        if (BEAST_LIKELY((kPadded || p_ + 4 <= end_) &&
+                         !std::memcmp(p_, "null", 4))) {
+          push(TapeNodeType::Null, 4, static_cast<tape_off_t>(p_ - data_));
           p_ += 4;
         } else
           goto fail;
@@ -4566,7 +7619,7 @@ public:
         if (BEAST_LIKELY(p_ < end_)) {
           unsigned char nc = static_cast<unsigned char>(*p_);
           if (nc <= 0x20) {
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             nc = static_cast<unsigned char>(c);
@@ -4578,12 +7631,12 @@ public:
               if (BEAST_LIKELY(p_ < end_)) {
                 unsigned char fc = static_cast<unsigned char>(*p_);
                 if (fc <= 0x20) {
-                  fc = static_cast<unsigned char>(skip_to_action());
+                  fc = static_cast<unsigned char>(skip_to_action<kPadded>());
                   if (BEAST_UNLIKELY(p_ >= end_))
                     goto done;
                 }
                 if (BEAST_LIKELY(fc == '"')) {
-                  char vc = scan_key_colon_next(p_ + 1, nullptr);
+                  char vc = scan_key_colon_next<kPadded>(p_ + 1, nullptr);
                   if (BEAST_UNLIKELY(vc == 0))
                     goto fail;
                   if (BEAST_UNLIKELY(p_ >= end_))
@@ -4596,7 +7649,7 @@ public:
               }
               goto done;
             }
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue;
@@ -4609,9 +7662,9 @@ public:
             cur_state_ = cstate_stack_[depth_];
             push_end(nc == '}' ? TapeNodeType::ObjectEnd
                                : TapeNodeType::ArrayEnd,
-                     static_cast<uint32_t>(p_ - data_));
+                     static_cast<tape_off_t>(p_ - data_));
             ++p_;
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue;
@@ -4642,7 +7695,7 @@ public:
         {
           const uint8x16_t vzero = vdupq_n_u8('0');
           const uint8x16_t vnine = vdupq_n_u8(9);
-          while (p_ + 16 <= end_) {
+          while (kPadded || p_ + 16 <= end_) {
             uint8x16_t vv = vld1q_u8(reinterpret_cast<const uint8_t *>(p_));
             uint8x16_t sub =
                 vsubq_u8(vv, vzero); // [0..9]=digit; else wraps ≥10
@@ -4656,7 +7709,7 @@ public:
           }
         }
 #else
-        while (p_ + 8 <= end_) {
+        while (kPadded || p_ + 8 <= end_) {
           uint64_t v;
           std::memcpy(&v, p_, 8);
           uint64_t shifted = v - 0x3030303030303030ULL;
@@ -4703,7 +7756,7 @@ public:
     {                                                                          \
       const uint8x16_t _vzero = vdupq_n_u8('0');                               \
       const uint8x16_t _vnine = vdupq_n_u8(9);                                 \
-      while (p_ + 16 <= end_) {                                                \
+      while (kPadded || p_ + 16 <= end_) {                                     \
         uint8x16_t _vv = vld1q_u8(reinterpret_cast<const uint8_t *>(p_));      \
         uint8x16_t _sub = vsubq_u8(_vv, _vzero);                               \
         uint8x16_t _nd = vcgtq_u8(_sub, _vnine);                               \
@@ -4721,7 +7774,7 @@ public:
 #else
 #define BEAST_SKIP_DIGITS()                                                    \
   do {                                                                         \
-    while (p_ + 8 <= end_) {                                                   \
+    while (kPadded || p_ + 8 <= end_) {                                        \
       uint64_t _v;                                                             \
       std::memcpy(&_v, p_, 8);                                                 \
       uint64_t _s = _v - 0x3030303030303030ULL;                                \
@@ -4747,8 +7800,10 @@ public:
           }
 #undef BEAST_SKIP_DIGITS
         }
-        push(flt ? TapeNodeType::NumberRaw : TapeNodeType::Integer,
-             static_cast<uint16_t>(p_ - s), static_cast<uint32_t>(s - data_));
+        push_len(flt ? TapeNodeType::NumberRaw : TapeNodeType::Integer,
+                 static_cast<size_t>(p_ - s), static_cast<tape_off_t>(s - data_));
+        if (BEAST_UNLIKELY(decode_))
+          decode_number_(s, p_, flt);
 
         // ── Phase 25 + B1: Double-pump Number Parsing with fused key
         // scanner ─ Numbers are values. They are ALWAYS followed by ',' or
@@ -4758,7 +7813,7 @@ public:
         if (BEAST_LIKELY(p_ < end_)) {
           unsigned char nc = static_cast<unsigned char>(*p_);
           if (nc <= 0x20) {
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             nc = static_cast<unsigned char>(c);
@@ -4770,12 +7825,12 @@ public:
               if (BEAST_LIKELY(p_ < end_)) {
                 unsigned char fc = static_cast<unsigned char>(*p_);
                 if (fc <= 0x20) {
-                  fc = static_cast<unsigned char>(skip_to_action());
+                  fc = static_cast<unsigned char>(skip_to_action<kPadded>());
                   if (BEAST_UNLIKELY(p_ >= end_))
                     goto done;
                 }
                 if (BEAST_LIKELY(fc == '"')) {
-                  char vc = scan_key_colon_next(p_ + 1, nullptr);
+                  char vc = scan_key_colon_next<kPadded>(p_ + 1, nullptr);
                   if (BEAST_UNLIKELY(vc == 0))
                     goto fail;
                   if (BEAST_UNLIKELY(p_ >= end_))
@@ -4788,7 +7843,7 @@ public:
               }
               goto done;
             }
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue; // bypass loop bottom separator logic, go straight to
@@ -4802,9 +7857,9 @@ public:
             cur_state_ = cstate_stack_[depth_];
             push_end(nc == '}' ? TapeNodeType::ObjectEnd
                                : TapeNodeType::ArrayEnd,
-                     static_cast<uint32_t>(p_ - data_));
+                     static_cast<tape_off_t>(p_ - data_));
             ++p_;
-            c = skip_to_action();
+            c = skip_to_action<kPadded>();
             if (BEAST_UNLIKELY(p_ >= end_))
               goto done;
             continue; // End handled inline!
@@ -4821,7 +7876,7 @@ public:
       // After the separator, try a direct *p_ peek before calling
       // skip_to_action. For JSON like "key":value or value,"next", the char
       // after sep is > 0x20.
-      c = skip_to_action();
+      c = skip_to_action<kPadded>();
       if (BEAST_UNLIKELY(p_ >= end_))
         break;
       if (BEAST_LIKELY(c == ':' || c == ',')) {
@@ -4834,7 +7889,7 @@ public:
         if (BEAST_LIKELY(nc > 0x20)) {
           c = static_cast<char>(nc); // direct dispatch, zero function call
         } else {
-          c = skip_to_action(); // whitespace present, do SWAR skip
+          c = skip_to_action<kPadded>(); // whitespace present, do SWAR skip
           if (BEAST_UNLIKELY(p_ >= end_))
             break;
         }
@@ -4856,7 +7911,58 @@ public:
     return false;
   }
 
-#if BEAST_HAS_AVX512 || BEAST_HAS_NEON
+  // ── Phase 101: tape output of the strict parser ────────────
+  // parse_strict() runs the RFC 8259 grammar (rfc8259::detail_::
+  // Validator) once and builds the tape through these as it goes, instead
+  // of validating first and then parsing the same bytes with parse(). They
+  // push exactly the nodes parse() would; the grammar is checked by the
+  // caller, so there are no context checks here. parse() and Stage 2 stay
+  // as they are (Phase 70-M1: new code in parse() costs twitter).
+  BEAST_INLINE void strict_value_(TapeNodeType t, const char *s, size_t l) {
+    if (BEAST_UNLIKELY(static_cast<size_t>(tape_cap_ - tape_head_) <
+                       kTapeSlack))
+      grow_tape_();
+    push_len(t, l, static_cast<tape_off_t>(s - data_));
+  }
+
+  BEAST_INLINE void strict_number_(const char *s, const char *e, bool flt) {
+    strict_value_(flt ? TapeNodeType::NumberRaw : TapeNodeType::Integer, s,
+                  static_cast<size_t>(e - s));
+    if (BEAST_UNLIKELY(decode_))
+      decode_number_(s, e, flt);
+  }
+
+  // `s` is the '{' / '['. False past kMaxDepth, which parse() rejects too.
+  BEAST_INLINE bool strict_open_(TapeNodeType t, const char *s) {
+    if (BEAST_UNLIKELY(depth_ >= kMaxDepth))
+      return false;
+    if (BEAST_UNLIKELY(static_cast<size_t>(tape_cap_ - tape_head_) <
+                       kTapeSlack))
+      grow_tape_();
+    push_open(t, static_cast<tape_off_t>(s - data_));
+    cstate_stack_[depth_] = cur_state_;
+    cur_state_ = t == TapeNodeType::ObjectStart ? 0b011u : 0b000u;
+    ++depth_;
+    return true;
+  }
+
+  BEAST_INLINE void strict_close_(TapeNodeType t, const char *s) {
+    if (BEAST_UNLIKELY(static_cast<size_t>(tape_cap_ - tape_head_) <
+                       kTapeSlack))
+      grow_tape_();
+    --depth_;
+    cur_state_ = cstate_stack_[depth_];
+    push_end(t, static_cast<tape_off_t>(s - data_));
+  }
+
+  void strict_finish_() noexcept { doc_->tape.head = tape_head_; }
+
+  // Phase 104: DuplicateKeys::LastWins — the tape index of the key just
+  // pushed, and erasing an earlier member through the deletion overlay.
+  uint32_t strict_last_() const noexcept { return tape_size() - 1; }
+  void strict_erase_(uint32_t key) { doc_->deleted_.insert(key); }
+
+#if BEAST_HAS_AVX2 || BEAST_HAS_NEON || BEAST_JSON_RUNTIME_DISPATCH
   // ── Phase 50: Stage 2 — index-based parse loop ───────────────────────
   //
   // Key differences from parse():
@@ -4870,11 +7976,199 @@ public:
   //   • After each opening '"', the VERY NEXT index entry is the closing
   //   '"' • structural chars inside strings are excluded from the index •
   //   value starts (digit/'-'/'t'/'f'/'n') are marked via vstart
-  [[gnu::hot]] bool parse_staged(const Stage1Index &s1) noexcept {
-    const uint32_t *pos = s1.positions;
-    const uint32_t n = s1.count;
+  //
+  // Not noexcept: long strings (Phase 84) and decoded numbers (Phase 97)
+  // allocate, and std::bad_alloc must reach the caller as from parse().
+  [[gnu::hot]] bool parse_staged(const Stage1Index &s1) {
+    return parse_staged_<StagedRange::Document>(s1.positions, s1.count);
+  }
+
+  // Phase 90: parse pos[0, n) as whole elements of the root array (depth 1),
+  // appending after the nodes already on doc_->tape. `first`: the range
+  // holds the array's first element (no separator before it). Used by
+  // parse_parallel() workers; false on malformed input or if the range
+  // does not end back at depth 1. `count` gets the elements pushed.
+  bool parse_staged_elements(const tape_off_t *pos, tape_off_t n, bool first,
+                             uint32_t &count) {
+    tape_head_ = doc_->tape.head;
+    depth_ = 1;
+    cur_state_ = first ? 0b000u : 0b100u; // array; has_elem unless first
+    cur_count_ = 0;
+    const bool ok = parse_staged_<StagedRange::Elements>(pos, n);
+    count = cur_count_;
+    return ok;
+  }
+
+  // Phase 91: windowed Stage 1 + 2. Scans `window` bytes (a multiple of 64)
+  // at a time into idx and parses each block before scanning the next, so
+  // the index is reused while still cache-resident instead of growing to
+  // ~1 entry per 8 bytes of the whole document. The scanner carry crosses
+  // block edges; Stage 2's depth, state stacks and tape simply continue.
+  template <bool kPadded = false>
+  bool parse_windowed(Stage1Fn stage1, Stage1Index &idx, size_t window) {
+    return parse_blocks_<StagedRange::Window, kPadded>(stage1, idx, window);
+  }
+
+  // Phase 92: parse_windowed() over a stream of JSON values (NDJSON / JSON
+  // Lines, or any whitespace between them) parsed as the elements of an
+  // implicit root array: tape[0] is a synthetic ArrayStart spanning every
+  // document. An empty stream is an empty array.
+  bool parse_many(Stage1Fn stage1, Stage1Index &idx, size_t window) {
+    return parse_blocks_<StagedRange::Stream>(stage1, idx, window);
+  }
+
+  // Phase 93: resumable parse_windowed() for push-style input. `prefix`
+  // is everything received so far — it only grows at the end, but may move
+  // between calls (only offsets are kept). Whole 64-byte blocks are scanned
+  // and parsed as they arrive; a trailing number / literal is held back
+  // like an open string, since the next bytes may extend it. With `last`,
+  // the tail is scanned and the document checked; false: malformed.
+  bool parse_prefix(Stage1Fn stage1, Stage1Index &idx, std::string_view prefix,
+                    bool last, size_t window) {
+    data_ = p_ = prefix.data();
+    end_ = data_ + prefix.size();
+    const size_t stop = last ? prefix.size() : prefix.size() & ~size_t{63};
+    if (!scan_blocks_<StagedRange::Window>(stage1, idx, stop, window, !last))
+      return false;
+    return !last || end_blocks_<StagedRange::Window>();
+  }
 
-    if (BEAST_UNLIKELY(n == 0)) {
+private:
+  // Document: the whole index. Elements: parse_staged_elements() range — no
+  // empty-input or trailing checks, ends at depth 1 instead of 0. Window:
+  // one parse_windowed() block — no checks, last_off kept across blocks.
+  // Stream: one parse_many() block — a Window inside the implicit root.
+  enum class StagedRange : uint8_t { Document, Elements, Window, Stream };
+
+  // Phase 91/93: state carried from one Stage 1 block to the next.
+  enum class Held : uint8_t { None, Quote, Value };
+  tape_off_t win_last_off_ = 0; // parse_staged_()'s last_off
+  Stage1Carry carry_{};
+  size_t scanned_ = 0; // bytes Stage 1 has consumed
+  tape_off_t held_ = 0; // held-back index entry (consume_block_())
+  Held held_kind_ = Held::None;
+
+  BEAST_INLINE void reserve_tape_(size_t nodes) {
+    if (BEAST_UNLIKELY(static_cast<size_t>(tape_cap_ - tape_head_) < nodes)) {
+      doc_->tape.head = tape_head_;
+      doc_->tape.grow(doc_->tape.size() + nodes);
+      tape_head_ = doc_->tape.head;
+      tape_cap_ = doc_->tape.cap;
+    }
+  }
+
+  template <StagedRange kBlock, bool kPadded = false>
+  bool parse_blocks_(Stage1Fn stage1, Stage1Index &idx, size_t window) {
+    if constexpr (kBlock == StagedRange::Stream) {
+      reserve_tape_(2);
+      push_open(TapeNodeType::ArrayStart, 0);
+      cstate_stack_[0] = cur_state_;
+      cur_state_ = 0b000u;
+      depth_ = 1;
+    }
+    return scan_blocks_<kBlock, kPadded>(
+               stage1, idx, static_cast<size_t>(end_ - data_), window, false) &&
+           end_blocks_<kBlock, kPadded>();
+  }
+
+  // Scans [scanned_, stop) in `window`-byte blocks, running Stage 2 over
+  // each. `growing`: more input may follow stop (parse_prefix()).
+  template <StagedRange kBlock, bool kPadded = false>
+  bool scan_blocks_(Stage1Fn stage1, Stage1Index &idx, size_t stop,
+                    size_t window, bool growing) {
+    const size_t len = static_cast<size_t>(end_ - data_);
+    while (scanned_ < stop) {
+      const size_t blk = std::min(window, stop - scanned_);
+      carry_ = stage1(data_ + scanned_, blk, idx,
+                      static_cast<tape_off_t>(scanned_), carry_);
+      scanned_ += blk;
+      // The final block's carry is not exact (padded tail), but nothing
+      // follows it anyway.
+      const bool more = growing || scanned_ < len;
+      // Phase 100: only the *_utf8 kernels set these. A sequence cut off
+      // by the end of input shows in utf8_prev when no padded tail ran.
+      if (BEAST_UNLIKELY(carry_.utf8_error ||
+                         (!more && utf8_open_(carry_.utf8_prev))))
+        return false;
+      if (!consume_block_<kBlock, kPadded>(idx.positions, idx.count,
+                                           more && carry_.in_string, growing))
+        return false;
+    }
+    return true;
+  }
+
+  // Stage 2 over one block's entries, resuming a held-back entry first. A
+  // string still open at the block edge (in_string) holds its opening quote
+  // back until the block holding its closing quote (nothing else is emitted
+  // inside a string, so it is the last entry); with hold_value, so does a
+  // trailing number / literal. The tape grows per block: at most one node
+  // per entry, plus the held one and parse_many()'s closing root node.
+  template <StagedRange kBlock, bool kPadded = false>
+  bool consume_block_(const tape_off_t *pos, tape_off_t n, bool in_string,
+                      bool hold_value) {
+    reserve_tape_(static_cast<size_t>(n) + 2);
+    if (BEAST_UNLIKELY(held_kind_ != Held::None)) {
+      if (held_kind_ == Held::Quote) {
+        if (n == 0)
+          return true; // the whole block is inside the string
+        const tape_off_t close_off = *pos++;
+        --n;
+        push_len(TapeNodeType::StringRaw,
+                 static_cast<size_t>(close_off - held_ - 1), held_ + 1);
+        win_last_off_ = close_off + 1;
+      } else {
+        if (n == 0 && hold_value)
+          return true; // only whitespace so far: the token may continue
+        if (!parse_staged_<kBlock, kPadded>(&held_, 1))
+          return false;
+      }
+      held_kind_ = Held::None;
+    }
+    if (n != 0) {
+      const char c = data_[pos[n - 1]];
+      if (BEAST_UNLIKELY(in_string)) {
+        held_kind_ = Held::Quote;
+        held_ = pos[--n];
+      } else if (hold_value && c != '"' && c != '{' && c != '[' && c != '}' &&
+                 c != ']') {
+        held_kind_ = Held::Value;
+        held_ = pos[--n];
+      }
+    }
+    return parse_staged_<kBlock, kPadded>(pos, n);
+  }
+
+  // After the last block: flush a held value, then the whole-input checks.
+  template <StagedRange kBlock, bool kPadded = false>
+  bool end_blocks_() {
+    if (held_kind_ == Held::Value &&
+        !consume_block_<kBlock, kPadded>(nullptr, 0, false, false))
+      return false;
+    bool ok = held_kind_ == Held::None; // else: unterminated string
+    for (const char *tail = data_ + win_last_off_; ok && tail < end_; ++tail)
+      ok = static_cast<unsigned char>(*tail) <= 0x20;
+    if constexpr (kBlock == StagedRange::Stream) {
+      ok = ok && depth_ == 1;
+      if (ok) {
+        --depth_;
+        cur_state_ = cstate_stack_[0];
+        push_end(TapeNodeType::ArrayEnd, static_cast<tape_off_t>(end_ - data_));
+      }
+    } else {
+      ok = ok && depth_ == 0 && tape_head_ > doc_->tape.base;
+    }
+    doc_->tape.head = tape_head_;
+    return ok;
+  }
+
+  template <StagedRange kRange, bool kPadded = false>
+  BEAST_INLINE bool parse_staged_(const tape_off_t *pos, const tape_off_t n) {
+    constexpr bool kElements = kRange == StagedRange::Elements;
+    constexpr bool kWindow =
+        kRange == StagedRange::Window || kRange == StagedRange::Stream;
+    constexpr bool kInRoot =
+        kRange == StagedRange::Elements || kRange == StagedRange::Stream;
+    if (kRange == StagedRange::Document && BEAST_UNLIKELY(n == 0)) {
       doc_->tape.head = tape_head_;
       return false; // empty / all-whitespace JSON is invalid
     }
@@ -4882,16 +8176,18 @@ public:
     // last_off tracks the byte offset just past the end of the last
     // consumed atom.  After the for-loop we scan [last_off, end_) for stray
     // non- whitespace, which catches things like "nulls" or "true garbage".
-    uint32_t last_off = 0;
+    tape_off_t last_off = kWindow ? win_last_off_ : 0;
 
-    for (uint32_t i = 0; i < n;) {
-      const uint32_t off = pos[i++];
+    for (tape_off_t i = 0; i < n;) {
+      const tape_off_t off = pos[i++];
       const char c = data_[off];
 
       switch (static_cast<ActionId>(kActionLut[static_cast<uint8_t>(c)])) {
 
       case kActObjOpen: {
-        push(TapeNodeType::ObjectStart, 0, off);
+        if (BEAST_UNLIKELY(depth_ >= kMaxDepth))
+          goto s2_fail;
+        push_open(TapeNodeType::ObjectStart, off);
         // Phase 60-A: save parent state, init new object context.
         cstate_stack_[depth_] = cur_state_;
         cur_state_ = 0b011u; // in_obj=1, is_key=1, has_elem=0
@@ -4904,7 +8200,9 @@ public:
       }
 
       case kActArrOpen: {
-        push(TapeNodeType::ArrayStart, 0, off);
+        if (BEAST_UNLIKELY(depth_ >= kMaxDepth))
+          goto s2_fail;
+        push_open(TapeNodeType::ArrayStart, off);
         // Phase 60-A: save parent state, init new array context.
         cstate_stack_[depth_] = cur_state_;
         cur_state_ = 0b000u; // in_obj=0, is_key=0, has_elem=0
@@ -4916,6 +8214,9 @@ public:
       case kActClose: {
         if (BEAST_UNLIKELY(depth_ == 0))
           goto s2_fail;
+        // Phase 90/92: a worker range or stream never closes the root.
+        if (kInRoot && BEAST_UNLIKELY(depth_ == 1))
+          goto s2_fail;
         --depth_;
         // Phase 60-A: restore parent state (no mask arithmetic needed).
         cur_state_ = cstate_stack_[depth_];
@@ -4929,10 +8230,10 @@ public:
         // Stage 1 guarantees: pos[i] is the closing '"' of this string.
         if (BEAST_UNLIKELY(i >= n))
           goto s2_fail;
-        const uint32_t close_off = pos[i++]; // consume closing '"'
-        push(TapeNodeType::StringRaw,
-             static_cast<uint16_t>(close_off - off - 1),
-             off + 1); // offset = first char inside string
+        const tape_off_t close_off = pos[i++]; // consume closing '"'
+        push_len(TapeNodeType::StringRaw,
+                 static_cast<size_t>(close_off - off - 1),
+                 off + 1); // offset = first char inside string
         last_off = close_off + 1;
         break;
       }
@@ -4948,7 +8249,7 @@ public:
         if (*pn == '-')
           ++pn;
         // SWAR-8 integer digit scan
-        while (pn + 8 <= end_) {
+        while (kPadded || pn + 8 <= end_) {
           uint64_t v;
           std::memcpy(&v, pn, 8);
           uint64_t shifted = v - 0x3030303030303030ULL;
@@ -4972,7 +8273,7 @@ public:
           if (pn < end_ && (*pn == '+' || *pn == '-'))
             ++pn;
           // SWAR-8 fractional digit scan
-          while (pn + 8 <= end_) {
+          while (kPadded || pn + 8 <= end_) {
             uint64_t _v;
             std::memcpy(&_v, pn, 8);
             uint64_t _s = _v - 0x3030303030303030ULL;
@@ -4991,7 +8292,7 @@ public:
             ++pn;
             if (pn < end_ && (*pn == '+' || *pn == '-'))
               ++pn;
-            while (pn + 8 <= end_) {
+            while (kPadded || pn + 8 <= end_) {
               uint64_t _v;
               std::memcpy(&_v, pn, 8);
               uint64_t _s = _v - 0x3030303030303030ULL;
@@ -5008,14 +8309,17 @@ public:
               ++pn;
           }
         }
-        push(flt ? TapeNodeType::NumberRaw : TapeNodeType::Integer,
-             static_cast<uint16_t>(pn - s), off);
-        last_off = static_cast<uint32_t>(pn - data_);
+        push_len(flt ? TapeNodeType::NumberRaw : TapeNodeType::Integer,
+                 static_cast<size_t>(pn - s), off);
+        if (BEAST_UNLIKELY(decode_))
+          decode_number_(s, pn, flt);
+        last_off = static_cast<tape_off_t>(pn - data_);
         break;
       }
 
       case kActTrue:
-        if (BEAST_UNLIKELY(off + 4 > static_cast<uint32_t>(end_ - data_) ||
+        if (BEAST_UNLIKELY((!kPadded &&
+                            off + 4 > static_cast<tape_off_t>(end_ - data_)) ||
                            std::memcmp(data_ + off, "true", 4)))
           goto s2_fail;
         push(TapeNodeType::BooleanTrue, 4, off);
@@ -5023,7 +8327,8 @@ public:
         break;
 
       case kActFalse:
-        if (BEAST_UNLIKELY(off + 5 > static_cast<uint32_t>(end_ - data_) ||
+        if (BEAST_UNLIKELY((!kPadded &&
+                            off + 5 > static_cast<tape_off_t>(end_ - data_)) ||
                            std::memcmp(data_ + off, "false", 5)))
           goto s2_fail;
         push(TapeNodeType::BooleanFalse, 5, off);
@@ -5031,7 +8336,8 @@ public:
         break;
 
       case kActNull:
-        if (BEAST_UNLIKELY(off + 4 > static_cast<uint32_t>(end_ - data_) ||
+        if (BEAST_UNLIKELY((!kPadded &&
+                            off + 4 > static_cast<tape_off_t>(end_ - data_)) ||
                            std::memcmp(data_ + off, "null", 4)))
           goto s2_fail;
         push(TapeNodeType::Null, 4, off);
@@ -5043,6 +8349,15 @@ public:
       } // switch
     } // for
 
+    if constexpr (kElements) {
+      doc_->tape.head = tape_head_;
+      return depth_ == 1;
+    }
+    if constexpr (kWindow) {
+      win_last_off_ = last_off;
+      return true; // head stays in tape_head_ until the last block
+    }
+
     // Trailing non-whitespace check: catch inputs like "nulls" where Stage
     // 1 only marks the value start ('n') but not the trailing junk ('s').
     {
@@ -5062,14 +8377,29 @@ public:
     doc_->tape.head = tape_head_;
     return false;
   }
-#endif // BEAST_HAS_AVX512
+#endif // BEAST_HAS_AVX2 || BEAST_HAS_NEON || BEAST_JSON_RUNTIME_DISPATCH
 };
 
 // ─────────────────────────────────────────────────────────────
 // Public API
 // ─────────────────────────────────────────────────────────────
 
-inline Value parse_reuse(DocumentView &doc, std::string_view json) {
+// Phase 85: 32-bit source offsets cannot address past 4 GB.
+inline bool source_size_ok_([[maybe_unused]] size_t n) noexcept {
+#if !BEAST_JSON_TAPE64
+  return n <= UINT32_MAX;
+#else
+  return true;
+#endif
+}
+
+inline void check_source_size_(size_t n) {
+  if (BEAST_UNLIKELY(!source_size_ok_(n)))
+    throw std::runtime_error(error_message(Error::InputTooLarge));
+}
+
+// Phase 103: prepare_parse_() without the size check.
+inline void reset_parse_(DocumentView &doc, std::string_view json) noexcept {
   doc.source = json;
   // Clear mutation / deletion / addition overlays from any prior parse.
   // These maps reference tape indices that are invalidated when the tape is
@@ -5077,154 +8407,1282 @@ inline Value parse_reuse(DocumentView &doc, std::string_view json) {
   doc.mutations_.clear();
   doc.deleted_.clear();
   doc.additions_.clear();
-  // Worst-case tape nodes == json.size() (e.g. "[[[...]]]" produces one
-  // node per character). Use json.size() + 64 as a guaranteed upper bound.
-  const size_t needed = json.size() + 64;
-  if (BEAST_UNLIKELY(!doc.tape.base ||
-                     static_cast<size_t>(doc.tape.cap - doc.tape.base) <
-                         needed)) {
-    doc.tape.reserve(needed);
-  } else {
-    doc.tape.reset(); // hot path: head = base (1 instruction)
-  }
-#if BEAST_HAS_AVX512
-  // Phase 50: Stage 1+2 is beneficial when the positions array fits in
-  // L2/L3 cache and the JSON is string-heavy (e.g. twitter.json,
-  // citm.json). Large number-heavy files (canada.json, gsoc-2018.json) have
-  // too many positions (~1M+) causing L3 pressure: Stage 1 overhead exceeds
-  // savings. Threshold: 2 MB — includes twitter(617KB) and citm(1.65MB);
-  // excludes canada(2.15MB) and gsoc(3.3MB).
-  static constexpr size_t kStage12MaxSize = 2 * 1024 * 1024; // 2 MB
-  if (BEAST_LIKELY(json.size() <= kStage12MaxSize)) {
-    stage1_scan_avx512(json.data(), json.size(), doc.idx);
-    if (!Parser(&doc).parse_staged(doc.idx)) {
-      throw std::runtime_error("Invalid JSON");
+  doc.key_index_.clear();  // Phase 81: keyed by stale ObjectStart indices
+  doc.elem_index_.clear(); // Phase 82: keyed by stale ArrayStart indices
+  doc.long_lens_.clear();  // Phase 84: refilled by the parser
+  doc.unescaped_.clear();  // Phase 99: views into strings_, rewound below
+  doc.strings_.reset();
+}
+
+// Phase 89: shared prologue / epilogue of parse_reuse() and parse_parallel().
+inline void prepare_parse_(DocumentView &doc, std::string_view json) {
+  reset_parse_(doc, json);
+  check_source_size_(json.size());
+}
+
+// Phase 100: the separate UTF-8 pass, for paths without a Stage 1 kernel.
+inline bool utf8_ok_(const DocumentView &doc, std::string_view json) noexcept {
+  return !doc.validate_utf8_ || validate_utf8(json.data(), json.size());
+}
+
+inline void check_utf8_(const DocumentView &doc, std::string_view json) {
+  if (!utf8_ok_(doc, json))
+    throw std::runtime_error(error_message(Error::InvalidJson));
+}
+
+// Phase 85: tape indices (links, Value handles) remain 32-bit.
+inline bool tape_size_ok_([[maybe_unused]] const DocumentView &doc) noexcept {
+#if BEAST_JSON_TAPE64
+  return doc.tape.size() <= UINT32_MAX;
+#else
+  return true;
+#endif
+}
+
+inline Value finish_parse_(DocumentView &doc) {
+  if (BEAST_UNLIKELY(!tape_size_ok_(doc)))
+    throw std::runtime_error(error_message(Error::TapeTooLarge));
+  return Value(&doc, 0);
+}
+
+// Phase 91: bytes of input per Stage 1 block in parse_reuse(). The block's
+// index (~1 entry per 8 bytes) plus its source bytes stay in L2 between the
+// scan and Stage 2. A multiple of 64 (the carry is exact at block edges).
+inline constexpr size_t kStage1Window = 64 * 1024;
+
+// Phase 95: kPadded = true is parse_padded() (see Parser::can_load_()).
+// Phase 103: reports failure as an Error; parse_reuse_() throws it.
+template <bool kPadded>
+inline Error parse_reuse_ec_(DocumentView &doc, std::string_view json) {
+  reset_parse_(doc, json);
+  if (BEAST_UNLIKELY(!source_size_ok_(json.size())))
+    return Error::InputTooLarge;
+  // Phase 86: the worst case is one node per input byte ("[[[...]]]"), but
+  // typical documents need ~1 per 20 bytes. Start at 1 per 8 and let push()
+  // grow the arena, so peak memory tracks the real node count instead of
+  // 8 bytes of tape per input byte.
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+  // Phase 50 ran Stage 1 + 2 only up to 2 MB: past that, a whole-document
+  // index (~1M+ positions for canada / gsoc) fell out of L2/L3 between the
+  // two passes. Phase 91 interleaves them per kStage1Window block instead,
+  // so the index is consumed while cache-resident at any input size.
+  // Phase 88: a compile-time constant unless runtime dispatch is on.
+  const Stage1Fn stage1 = stage1_kernel(doc.validate_utf8_);
+  if (BEAST_LIKELY(stage1)) {
+    // Phase 86: Stage 2 pushes at most one node per index entry, so
+    // parse_windowed() grows the tape per block from the index count
+    // (exactly count + 1 nodes for a single-block document).
+    doc.tape.reset();
+    if (!Parser(&doc).parse_windowed<kPadded>(stage1, doc.idx,
+                                              kStage1Window)) {
+      return Error::InvalidJson;
     }
   } else {
-    if (!Parser(&doc).parse()) {
-      throw std::runtime_error("Invalid JSON");
+    if (!utf8_ok_(doc, json))
+      return Error::InvalidJson;
+    doc.tape.reserve(json.size() / 8 + 64);
+    if (!Parser(&doc).parse<kPadded>()) {
+      return Error::InvalidJson;
     }
   }
 #else
-  if (!Parser(&doc).parse()) {
-    throw std::runtime_error("Invalid JSON");
+  if (!utf8_ok_(doc, json))
+    return Error::InvalidJson;
+  doc.tape.reserve(json.size() / 8 + 64);
+  if (!Parser(&doc).parse<kPadded>()) {
+    return Error::InvalidJson;
   }
 #endif
+  return tape_size_ok_(doc) ? Error::None : Error::TapeTooLarge;
+}
+
+template <bool kPadded>
+inline Value parse_reuse_(DocumentView &doc, std::string_view json) {
+  const Error e = parse_reuse_ec_<kPadded>(doc, json);
+  if (BEAST_UNLIKELY(e != Error::None))
+    throw std::runtime_error(error_message(e));
   return Value(&doc, 0);
 }
 
-// ── Value::merge_patch() out-of-line (needs parse_reuse) ────────────────────
-inline void Value::merge_patch(std::string_view patch_json) {
-  if (!is_object())
-    return;
-  DocumentView patch_doc;
-  Value patch = parse_reuse(patch_doc, patch_json);
-  merge_patch_impl_(patch);
+inline Value parse_reuse(DocumentView &doc, std::string_view json) {
+  return parse_reuse_<false>(doc, json);
 }
 
-// ───────────────────────────────────────────────────────────────────────────
-// SafeValue — optional-propagating chain proxy
+// Phase 103: parse_reuse() without exceptions: sets `ec` and returns an
+// invalid Value{} on failure.
+inline Value parse_reuse(DocumentView &doc, std::string_view json,
+                         Error &ec) {
+  ec = parse_reuse_ec_<false>(doc, json);
+  return ec == Error::None ? Value(&doc, 0) : Value();
+}
+
+// Phase 95: json must be followed by kPadding readable zero bytes, as in a
+// PaddedString or a MappedFile.
+inline Value parse_padded(DocumentView &doc, std::string_view json) {
+  return parse_reuse_<true>(doc, json);
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 92: Multi-document streams (NDJSON / JSON Lines)
 //
-// Returned by Value::get(key/idx).  Every subsequent operator[] propagates
-// std::nullopt silently: if any step is absent, the entire chain returns
-// an empty SafeValue without throwing.
+// parse_many() parses a buffer of concatenated JSON values into one tape,
+// as the elements of an implicit root array: root.size() is the document
+// count and root[i] / root.elements() yield each document. Stage 1 runs
+// once over the stream (in kStage1Window blocks) and one Parser builds
+// every document, so its state stacks are not re-zeroed per record. On
+// the single-pass path (no Stage 1 kernel) KeyLenCache likewise carries
+// over between records that share a schema; Stage 2 needs no key scan.
+// ─────────────────────────────────────────────────────────────
+
+// No Stage 1 kernel: parse() already accepts consecutive root values.
+// Shift its tape one node right and wrap it in the root array, marking
+// every document after the first as comma-separated like array elements.
+inline void parse_many_scalar_(DocumentView &doc) {
+  std::string_view json = doc.source;
+  doc.tape.reserve(json.size() / 8 + 64);
+  if (!Parser(&doc).parse()) {
+    for (char c : json)
+      if (static_cast<unsigned char>(c) > 0x20)
+        throw std::runtime_error("Invalid JSON");
+    doc.tape.reset(); // empty stream: no documents
+  }
+  const size_t m = doc.tape.size();
+  if (doc.tape.capacity() < m + 2)
+    doc.tape.grow(m + 2);
+  TapeNode *t = doc.tape.base;
+  std::memmove(t + 1, t, m * sizeof(TapeNode));
+#if BEAST_JSON_TAPE_LINKS
+  for (size_t i = 1; i <= m; ++i) {
+    const TapeNodeType ty = t[i].type();
+    if (ty == TapeNodeType::ObjectStart || ty == TapeNodeType::ArrayStart)
+      ++t[i].offset;
+  }
+#endif
+  for (auto &ll : doc.long_lens_)
+    ++ll.first;
+  if (doc.decode_numbers_ && !doc.numbers_.empty()) { // Phase 97
+    const size_t n = std::min(m, doc.numbers_.size());
+    doc.numbers_.resize(std::max(doc.numbers_.size(), n + 1));
+    std::memmove(doc.numbers_.data() + 1, doc.numbers_.data(),
+                 n * sizeof(uint64_t));
+  }
+  uint64_t docs = 0;
+  for (size_t i = 1; i <= m; ++docs) {
+    if (docs)
+      t[i].meta = (t[i].meta & ~(TapeNode::kSepMask << 16)) | (1u << 16);
+    const TapeNodeType ty = t[i].type();
+    if (ty != TapeNodeType::ObjectStart && ty != TapeNodeType::ArrayStart) {
+      ++i;
+      continue;
+    }
+    for (size_t depth = 0;; ++i) { // to the matching close node
+      const TapeNodeType nt = t[i].type();
+      if (nt == TapeNodeType::ObjectStart || nt == TapeNodeType::ArrayStart)
+        ++depth;
+      else if ((nt == TapeNodeType::ObjectEnd ||
+                nt == TapeNodeType::ArrayEnd) &&
+               --depth == 0)
+        break;
+    }
+    ++i;
+  }
+  t[0].meta = (static_cast<uint32_t>(TapeNodeType::ArrayStart) << 24) |
+              static_cast<uint32_t>(
+                  std::min<uint64_t>(docs, TapeNode::kCountSaturated));
+#if BEAST_JSON_TAPE_LINKS
+  t[0].offset = static_cast<tape_off_t>(m + 1);
+#else
+  t[0].offset = 0;
+#endif
+  t[m + 1].meta = static_cast<uint32_t>(TapeNodeType::ArrayEnd) << 24;
+  t[m + 1].offset = static_cast<tape_off_t>(json.size());
+  doc.tape.head = t + m + 2;
+}
+
+inline Value parse_many(DocumentView &doc, std::string_view json) {
+  prepare_parse_(doc, json);
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+  if (const Stage1Fn stage1 = stage1_kernel(doc.validate_utf8_);
+      BEAST_LIKELY(stage1)) {
+    doc.tape.reset();
+    if (!Parser(&doc).parse_many(stage1, doc.idx, kStage1Window))
+      throw std::runtime_error("Invalid JSON");
+    return finish_parse_(doc);
+  }
+#endif
+  check_utf8_(doc, json);
+  parse_many_scalar_(doc);
+  return finish_parse_(doc);
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 93: Push-style streaming parse
 //
-// Read path comparison:
-//   root["user"]["id"].as<int>()        ← throws on missing key (fast path)
-//   root.get("user")["id"].as<int>()    ← std::optional<int>, never throws
-//   root.get("user")["id"].value_or(-1) ← int with default, never throws
+// StreamParser takes a document in successive chunks (e.g. as socket reads
+// complete) and runs the windowed Stage 1 + 2 over each whole 64-byte
+// block as soon as it has arrived; finish() after the last chunk only has
+// the final partial block left. Parser state — depth, state stacks,
+// scanner carry, a held-back open string or trailing number — persists
+// between calls, so no byte is scanned twice.
 //
-// SafeValue is std::optional<Value>-compatible: has_value(), operator bool,
-// operator* and operator-> all work, so existing code using optional<Value>
-// patterns compiles unchanged.
-// ───────────────────────────────────────────────────────────────────────────
+// Tape offsets index one contiguous source, so the bytes must end up in a
+// single buffer. Either:
+//   • feed(chunk) appends a copy to a buffer the StreamParser owns; the
+//     caller may release each chunk right away, or
+//   • advance(received) is given everything received so far in a buffer
+//     the caller fills in place (e.g. sized from Content-Length): no copy.
+// Values from finish() read that buffer: keep it (and, for feed(), the
+// StreamParser) alive while using them, as with parse()'s source. Without
+// a Stage 1 kernel the bytes are only collected and parse() runs in
+// finish().
+//
+// The document's options (number decoding, UTF-8 validation) are read
+// when a document's first bytes arrive, like parse() reads them on entry:
+// set them any time before the first feed() / advance() after reset().
+// Changing them mid-document takes effect from the next one. (Without a
+// Stage 1 kernel the parse, and so the read, happens in finish().) The
+// key and element indices are read on lookup, as always.
+// ─────────────────────────────────────────────────────────────
+class StreamParser {
+public:
+  explicit StreamParser(DocumentView &doc) : doc_(doc) {}
 
-/// @brief An optional-propagating proxy for safe JSON navigation.
-/// @details `SafeValue` is obtained via `Value::get()`. It propagates absence
-/// silently (similar to a monad). Any chained access on an absent `SafeValue`
-/// will return another absent `SafeValue` without throwing or crashing.
-class SafeValue {
-  Value val_; // valid only when has_ == true; default-constructed otherwise
-  bool has_ = false;
+  /// Starts a new document; the owned buffer keeps its capacity.
+  void reset() {
+    buf_.clear();
+    view_ = {};
+    in_place_ = failed_ = false;
+    parser_.reset(); // the next step_() starts the document
+  }
 
-public:
-  SafeValue() noexcept = default;
-  explicit SafeValue(Value v) noexcept : val_(v), has_(true) {}
+  /// Appends a copy of `chunk` and parses every block it completes.
+  /// @throws std::runtime_error once the input is known to be malformed.
+  void feed(std::string_view chunk) {
+    buf_.append(chunk);
+    step_(buf_, false);
+  }
 
-  // ── std::optional-compatible interface ───────────────────────────────────
+  /// In-place input: `received` is the whole document so far. It may only
+  /// grow at the end, but may move (only offsets are kept).
+  void advance(std::string_view received) {
+    in_place_ = true;
+    step_(received, false);
+  }
 
-  bool has_value() const noexcept { return has_; }
-  explicit operator bool() const noexcept { return has_; }
+  /// Parses the rest and returns the root. Call after the last chunk.
+  /// @throws std::runtime_error on malformed or incomplete JSON.
+  Value finish() {
+    if (!in_place_)
+      view_ = buf_;
+    step_(view_, true);
+    doc_.source = view_;
+    return finish_parse_(doc_);
+  }
 
-  Value &value() {
-    if (!has_)
-      throw std::bad_optional_access{};
-    return val_;
+  /// Bytes received so far.
+  size_t size() const noexcept {
+    return in_place_ ? view_.size() : buf_.size();
   }
-  const Value &value() const {
-    if (!has_)
-      throw std::bad_optional_access{};
-    return val_;
+
+private:
+  void step_(std::string_view json, bool last) {
+    if (BEAST_UNLIKELY(failed_))
+      throw std::runtime_error("Invalid JSON");
+    check_source_size_(json.size());
+    if (!parser_)
+      begin_();
+    view_ = json;
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+    if (const Stage1Fn stage1 = stage1_kernel(utf8_);
+        BEAST_LIKELY(stage1)) {
+      if (!parser_->parse_prefix(stage1, doc_.idx, json, last,
+                                 kStage1Window)) {
+        failed_ = true;
+        throw std::runtime_error("Invalid JSON");
+      }
+      return;
+    }
+#endif
+    if (last) {
+      doc_.source = json;
+      doc_.tape.reserve(json.size() / 8 + 64);
+      if (!utf8_ok_(doc_, json) || !Parser(&doc_).parse()) {
+        failed_ = true;
+        throw std::runtime_error("Invalid JSON");
+      }
+    }
   }
-  Value &operator*() { return value(); }
-  const Value &operator*() const { return value(); }
-  Value *operator->() { return &value(); }
-  const Value *operator->() const { return &value(); }
 
-  // ── Type checks — false when absent ──────────────────────────────────────
+  // Reads the document's options: the Parser takes decode_numbers_, and
+  // utf8_ holds the Stage 1 kernel choice for the whole document.
+  void begin_() {
+    prepare_parse_(doc_, {});
+    doc_.tape.reset();
+    utf8_ = doc_.validate_utf8_;
+    parser_.emplace(&doc_);
+  }
 
-  bool is_null() const noexcept { return has_ && val_.is_null(); }
-  bool is_bool() const noexcept { return has_ && val_.is_bool(); }
-  bool is_int() const noexcept { return has_ && val_.is_int(); }
-  bool is_double() const noexcept { return has_ && val_.is_double(); }
-  bool is_number() const noexcept { return has_ && val_.is_number(); }
-  bool is_string() const noexcept { return has_ && val_.is_string(); }
-  bool is_object() const noexcept { return has_ && val_.is_object(); }
-  bool is_array() const noexcept { return has_ && val_.is_array(); }
+  DocumentView &doc_;
+  std::optional<Parser> parser_; // empty until the document's first bytes
+  std::string buf_;        // feed(): the document so far
+  std::string_view view_;  // the document so far, either mode
+  bool in_place_ = false;
+  bool failed_ = false;
+  bool utf8_ = false;
+};
 
-  // ── Chaining — absent propagates forward, never throws ───────────────────
+// Phase 94: parses a file through a read-only mapping (see MappedFile) —
+// no copy into a std::string, and pages are read ahead of the scan. The
+// mapping moves into doc, replacing any previous one, so Values stay valid
+// for the document's lifetime.
+inline Value parse_file(DocumentView &doc, const char *path,
+                        bool populate = false) {
+  MappedFile file(path, populate);
+  const std::string_view json = file.view();
+  doc.file_ = std::move(file); // the view survives the move
+  return parse_padded(doc, json); // zero-padded either way
+}
 
-  SafeValue operator[](std::string_view key) const noexcept {
-    if (!has_)
-      return {};
-    return val_.get(key); // calls Value::get() defined below
+// ─────────────────────────────────────────────────────────────
+// Phase 96: Cursor — forward-only on-demand access
+//
+// For reading a few fields out of a message without building its tape.
+// The Cursor runs Stage 1 over kWindow bytes at a time, only as far as
+// the reads reach, and walks the entries: a skipped value costs a pass
+// over its entries (brackets are counted, strings and scalars are one or
+// two entries each); a value that is read is decoded from the source.
+//
+// Forward-only: an object's fields are looked up in document order (a key
+// before the last one found is not seen again), an array is iterated
+// once, and reading or entering a value consumes it. A handle the cursor
+// has moved past is spent: operator[] finds nothing, elements() is empty,
+// as<T>() throws. Separators, keys and the values read are checked at the
+// levels visited; a value skipped whole is only checked for balanced
+// brackets.
+// ─────────────────────────────────────────────────────────────
+class Cursor;
+
+// Nesting change per Stage 1 entry: +1 for '{' '[', -1 for '}' ']'.
+static constexpr auto kNestLut = []() consteval {
+  std::array<int8_t, 256> t{};
+  t[static_cast<uint8_t>('{')] = t[static_cast<uint8_t>('[')] = 1;
+  t[static_cast<uint8_t>('}')] = t[static_cast<uint8_t>(']')] = -1;
+  return t;
+}();
+
+// A value under a Cursor: its source offset and nesting depth. Cheap to
+// copy; valid until the cursor moves past it or iterate()s again.
+class OnDemandValue {
+public:
+  OnDemandValue() noexcept = default;
+
+  // Type checks look at the first byte only and never consume.
+  bool is_valid() const noexcept { return cur_ != nullptr; }
+  explicit operator bool() const noexcept { return cur_ != nullptr; }
+  bool is_null() const noexcept { return c_ == 'n'; }
+  bool is_bool() const noexcept { return c_ == 't' || c_ == 'f'; }
+  bool is_number() const noexcept {
+    return c_ == '-' || (c_ >= '0' && c_ <= '9');
   }
-  SafeValue operator[](const char *key) const noexcept {
+  bool is_string() const noexcept { return c_ == '"'; }
+  bool is_object() const noexcept { return c_ == '{'; }
+  bool is_array() const noexcept { return c_ == '['; }
+
+  /// Next field named `key` of this object, searching forward from the
+  /// last one found. Invalid when absent, not an object, or spent.
+  /// @throws std::runtime_error on malformed JSON on the way.
+  OnDemandValue operator[](std::string_view key) const;
+  OnDemandValue operator[](const char *key) const {
     return (*this)[std::string_view(key)];
   }
-  SafeValue operator[](size_t idx) const noexcept {
-    if (!has_)
-      return {};
-    return val_.get(idx);
+
+  /// Reads a scalar and consumes it: bool, integral and floating types,
+  /// std::string_view (raw, escapes as in the source) or std::string.
+  /// @throws std::runtime_error on a type mismatch, an invalid or spent
+  /// value, or a malformed token.
+  template <typename T> T as() const;
+
+  class ArrayIterator;
+  class ArrayRange;
+
+  /// The remaining elements of this array (none if not an array or spent).
+  ArrayRange elements() const noexcept;
+
+private:
+  friend class Cursor;
+  OnDemandValue(Cursor *cur, tape_off_t off, uint32_t depth, char c) noexcept
+      : cur_(cur), off_(off), depth_(depth), c_(c) {}
+
+  OnDemandValue next_element_() const;
+
+  Cursor *cur_ = nullptr;
+  tape_off_t off_ = 0; // first byte
+  uint32_t depth_ = 0; // containers open around it
+  char c_ = '\0';      // first byte, for the type checks
+};
+
+// Single-pass iterator over array elements. Advancing skips whatever is
+// left of the current element.
+class OnDemandValue::ArrayIterator {
+  OnDemandValue arr_, elem_; // elem_ invalid: end
+
+public:
+  using difference_type = std::ptrdiff_t;
+  using value_type = OnDemandValue;
+  using iterator_category = std::input_iterator_tag;
+
+  ArrayIterator() noexcept = default;
+  explicit ArrayIterator(const OnDemandValue &arr)
+      : arr_(arr), elem_(arr.next_element_()) {}
+
+  OnDemandValue operator*() const noexcept { return elem_; }
+  ArrayIterator &operator++() {
+    elem_ = arr_.next_element_();
+    return *this;
   }
-  SafeValue operator[](int idx) const noexcept {
-    if (idx < 0 || !has_)
-      return {};
-    return val_.get(static_cast<size_t>(idx));
+  void operator++(int) { ++*this; }
+  bool operator==(const ArrayIterator &o) const noexcept {
+    return elem_.cur_ == o.elem_.cur_ && elem_.off_ == o.elem_.off_;
   }
+};
 
-  // Alias for further chaining (same as operator[]):
-  SafeValue get(std::string_view key) const noexcept { return (*this)[key]; }
-  SafeValue get(const char *key) const noexcept { return (*this)[key]; }
-  SafeValue get(size_t idx) const noexcept { return (*this)[idx]; }
-  SafeValue get(int idx) const noexcept { return (*this)[idx]; }
+class OnDemandValue::ArrayRange {
+  OnDemandValue arr_;
 
-  // ── Terminal: typed extraction ────────────────────────────────────────────
+public:
+  explicit ArrayRange(const OnDemandValue &arr) noexcept : arr_(arr) {}
+  ArrayIterator begin() const { return ArrayIterator(arr_); }
+  ArrayIterator end() const noexcept { return {}; }
+};
 
-  // as<T>() — returns std::optional<T>; std::nullopt when absent or wrong type
-  template <JsonReadable T> std::optional<T> as() const noexcept {
-    if (!has_)
-      return std::nullopt;
-    return val_.try_as<T>();
-  }
+inline OnDemandValue::ArrayRange OnDemandValue::elements() const noexcept {
+  return ArrayRange(*this);
+}
 
-  // value_or(default) — direct T with fallback; never throws
-  template <JsonReadable T> T value_or(T def) const noexcept {
-    auto r = as<T>();
-    return r ? *r : def;
+class Cursor {
+public:
+  Cursor() = default;
+  Cursor(const Cursor &) = delete;
+  Cursor &operator=(const Cursor &) = delete;
+
+  /// Starts on `json` and returns its root. `json` must outlive the
+  /// values; handles from the previous document are spent. The index
+  /// buffers are kept for reuse.
+  /// @throws std::runtime_error if there is no value.
+  OnDemandValue iterate(std::string_view json) {
+    check_source_size_(json.size());
+    src_ = json.data();
+    len_ = json.size();
+    scanned_ = 0;
+    carry_ = {};
+    idx_.reset();
+    i_ = 0;
+    levels_.clear();
+    const tape_off_t off = peek_();
+    if (off == len_)
+      fail_();
+    gap_(0, off, 0);
+    pending_ = true;
+    return value_(off);
   }
 
-  // dump() — "null" when absent
+private:
+  friend class OnDemandValue;
+
+  // Window scanned per Stage 1 call: entries stay in L1, and bytes past
+  // the last read are never scanned.
+  static constexpr size_t kWindow = 16 * 1024;
+
+  struct Level {
+    tape_off_t start; // the '{' or '['
+    bool first;       // no member stepped over yet
+  };
+
+  [[noreturn]] static void fail_() { throw std::runtime_error("Invalid JSON"); }
+
+  static Stage1Fn kernel_() noexcept {
+    if (const Stage1Fn fn = stage1_kernel())
+      return fn;
+#if BEAST_HAS_NEON
+    return &stage1_scan_neon;
+#else
+    return &stage1_scan_scalar;
+#endif
+  }
+
+  // Offset of the next unconsumed entry (len_ past the last one), scanning
+  // further windows as needed.
+  BEAST_INLINE tape_off_t peek_() {
+    while (BEAST_UNLIKELY(i_ == idx_.count)) {
+      if (scanned_ == len_)
+        return static_cast<tape_off_t>(len_);
+      const size_t n = std::min(kWindow, len_ - scanned_);
+      carry_ = scan_(src_ + scanned_, n, idx_,
+                     static_cast<tape_off_t>(scanned_), carry_);
+      scanned_ += n;
+      i_ = 0;
+    }
+    return idx_.positions[i_];
+  }
+
+  char at_(tape_off_t off) const noexcept {
+    return off < len_ ? src_[off] : '\0';
+  }
+
+  OnDemandValue value_(tape_off_t off) noexcept {
+    return OnDemandValue(this, off, static_cast<uint32_t>(levels_.size()),
+                         src_[off]);
+  }
+
+  // [from, to) holds whitespace around exactly one `sep` (none if 0).
+  void gap_(size_t from, size_t to, char sep) const {
+    bool seen = sep == 0;
+    for (; from < to; ++from) {
+      const char c = src_[from];
+      if (c == sep && !seen)
+        seen = true;
+      else if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+        fail_();
+    }
+    if (!seen)
+      fail_();
+  }
+
+  // End of the number or literal starting at `off`.
+  size_t token_end_(size_t off) const noexcept {
+    while (off < len_) {
+      const char c = src_[off];
+      if (static_cast<signed char>(c) <= 0x20 || c == ',' || c == ':' ||
+          c == ']' || c == '}' || c == '[' || c == '{' || c == '"')
+        break;
+      ++off;
+    }
+    return off;
+  }
+
+  // Consumes entries through the bracket that closes `open` levels;
+  // returns its offset. One table add per entry, no bracket branches.
+  tape_off_t skip_nested_(int32_t open) {
+    for (;;) {
+      if (BEAST_UNLIKELY(peek_() == len_))
+        fail_();
+      const tape_off_t *pos = idx_.positions;
+      for (tape_off_t i = i_, n = idx_.count; i < n; ++i) {
+        open += kNestLut[static_cast<uint8_t>(src_[pos[i]])];
+        if (open == 0) {
+          i_ = i + 1;
+          return pos[i];
+        }
+      }
+      i_ = idx_.count;
+    }
+  }
+
+  // Consumes the pending value.
+  void skip_value_() {
+    const tape_off_t off = peek_();
+    const char c = at_(off);
+    if (c == '"') {
+      ++i_;
+      const tape_off_t close = peek_();
+      if (close == len_)
+        fail_();
+      ++i_;
+      after_ = close + 1;
+    } else if (c == '{' || c == '[') {
+      ++i_;
+      after_ = skip_nested_(1) + 1;
+    } else if (c == '\0' || c == '}' || c == ']') {
+      fail_();
+    } else {
+      ++i_;
+      after_ = token_end_(off);
+    }
+    pending_ = false;
+  }
+
+  bool pending_at_(const OnDemandValue &v) {
+    return pending_ && v.depth_ == levels_.size() && peek_() == v.off_;
+  }
+  bool open_(const OnDemandValue &v) const noexcept {
+    return v.depth_ < levels_.size() && levels_[v.depth_].start == v.off_;
+  }
+
+  // Puts the cursor among the members of container `v`, entering it if it
+  // is the pending value or leaving whatever it holds open. False if `v`
+  // is spent.
+  bool reach_(const OnDemandValue &v) {
+    if (pending_at_(v)) {
+      ++i_;
+      levels_.push_back({v.off_, true});
+      after_ = v.off_ + 1;
+      pending_ = false;
+      return true;
+    }
+    if (!open_(v))
+      return false;
+    while (levels_.size() > v.depth_ + 1) {
+      after_ = skip_nested_(1) + 1;
+      levels_.pop_back();
+      pending_ = false;
+    }
+    return true;
+  }
+
+  // Steps to the first entry of the innermost container's next member,
+  // over the pending value and the separator. False (the container now
+  // closed) at its end.
+  bool step_() {
+    if (pending_)
+      skip_value_();
+    Level &lv = levels_.back();
+    const tape_off_t off = peek_();
+    if (off == len_)
+      fail_();
+    if (src_[off] == (src_[lv.start] == '{' ? '}' : ']')) {
+      gap_(after_, off, 0);
+      ++i_;
+      after_ = off + 1;
+      levels_.pop_back();
+      return false;
+    }
+    gap_(after_, off, lv.first ? 0 : ',');
+    lv.first = false;
+    return true;
+  }
+
+  OnDemandValue find_field_(const OnDemandValue &obj, std::string_view key) {
+    if (!obj.is_object() || !reach_(obj))
+      return {};
+    while (step_()) {
+      const tape_off_t open = peek_();
+      if (src_[open] != '"')
+        fail_();
+      ++i_;
+      const tape_off_t close = peek_();
+      if (close == len_)
+        fail_();
+      ++i_;
+      const tape_off_t val = peek_();
+      if (val == len_)
+        fail_();
+      gap_(close + 1, val, ':');
+      pending_ = true;
+      if (std::string_view(src_ + open + 1, close - open - 1) == key)
+        return value_(val);
+    }
+    return {};
+  }
+
+  OnDemandValue next_element_(const OnDemandValue &arr) {
+    if (!arr.is_array() || !reach_(arr) || !step_())
+      return {};
+    pending_ = true;
+    return value_(peek_());
+  }
+
+  // Consumes scalar `v` and returns its token (string: the raw contents).
+  std::string_view read_(const OnDemandValue &v) {
+    if (!pending_at_(v))
+      throw std::runtime_error(
+          "beast::OnDemandValue::as: value was already consumed");
+    ++i_;
+    pending_ = false;
+    if (v.c_ != '"') {
+      after_ = token_end_(v.off_);
+      return {src_ + v.off_, after_ - v.off_};
+    }
+    const tape_off_t close = peek_();
+    if (close == len_)
+      fail_();
+    ++i_;
+    after_ = close + 1;
+    return {src_ + v.off_ + 1, close - v.off_ - 1};
+  }
+
+  Stage1Fn scan_ = kernel_();
+  Stage1Index idx_;
+  Stage1Carry carry_;
+  const char *src_ = nullptr;
+  size_t len_ = 0;
+  size_t scanned_ = 0;        // bytes handed to Stage 1 so far
+  tape_off_t i_ = 0;          // next entry in idx_
+  std::vector<Level> levels_; // open containers, outermost first
+  size_t after_ = 0;          // end of the last consumed token
+  bool pending_ = false;      // entry i_ starts a value not yet consumed
+};
+
+inline OnDemandValue OnDemandValue::operator[](std::string_view key) const {
+  return cur_ ? cur_->find_field_(*this, key) : OnDemandValue{};
+}
+
+inline OnDemandValue OnDemandValue::next_element_() const {
+  return cur_ ? cur_->next_element_(*this) : OnDemandValue{};
+}
+
+template <typename T> T OnDemandValue::as() const {
+  if (!cur_)
+    throw std::runtime_error(
+        "beast::OnDemandValue::as: value is missing or invalid");
+  if constexpr (std::is_same_v<T, bool>) {
+    if (!is_bool())
+      throw std::runtime_error("beast::OnDemandValue::as<bool>: not a boolean");
+    const std::string_view s = cur_->read_(*this);
+    if (s != "true" && s != "false")
+      throw std::runtime_error("Invalid JSON");
+    return s[0] == 't';
+  } else if constexpr (std::is_integral_v<T>) {
+    if (!is_number())
+      throw std::runtime_error(
+          "beast::OnDemandValue::as<integral>: not an integer");
+    const std::string_view s = cur_->read_(*this);
+    int64_t val = 0;
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), val);
+    if (ec != std::errc{})
+      throw std::runtime_error(
+          "beast::OnDemandValue::as<integral>: parse error");
+    if (ptr != s.data() + s.size())
+      throw std::runtime_error(
+          "beast::OnDemandValue::as<integral>: not an integer");
+    T out{};
+    if (!narrow_int_(val, out)) // as Value::get<T>(): no silent truncation
+      throw std::runtime_error(
+          "beast::OnDemandValue::as<integral>: out of range");
+    return out;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (!is_number())
+      throw std::runtime_error("beast::OnDemandValue::as<float>: not a number");
+    const std::string_view s = cur_->read_(*this);
+    // parse_double() would take "-inf" and "-nan".
+    if (s[0] == '-' && (s.size() < 2 || s[1] < '0' || s[1] > '9'))
+      throw std::runtime_error("beast::OnDemandValue::as<float>: parse error");
+    double val = 0.0;
+    auto [ptr, ec] = parse_double(s.data(), s.data() + s.size(), val);
+    if (ec != std::errc{} || ptr != s.data() + s.size())
+      throw std::runtime_error("beast::OnDemandValue::as<float>: parse error");
+    return static_cast<T>(val);
+  } else if constexpr (std::is_same_v<T, std::string_view>) {
+    if (!is_string())
+      throw std::runtime_error(
+          "beast::OnDemandValue::as<string_view>: not a string");
+    return cur_->read_(*this);
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return std::string(as<std::string_view>());
+  } else {
+    static_assert(sizeof(T) == 0,
+                  "beast::OnDemandValue::as<T>: unsupported type");
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 89: Multi-threaded Stage 1
+//
+// Stage 1 is a pure function of (bytes, carry state), so a large document
+// is cut into 64-byte-aligned chunks scanned on separate threads:
+//   1. Parallel: each chunk counts its unescaped quotes (memchr + a
+//      backward look at the preceding backslash run).
+//   2. Prefix pass: the XOR of those parities gives each chunk's in-string
+//      state; the escape and "after whitespace" bits come from the bytes
+//      just before the chunk.
+//   3. Parallel: each chunk runs the Stage 1 kernel with its carry,
+//      emitting document offsets; the arrays are concatenated in order.
+// The result is identical to one sequential scan. Stage 2 stays
+// single-threaded (parse_staged() over the merged index).
+// ─────────────────────────────────────────────────────────────
+
+// Below this much input per thread, spawning costs more than it saves.
+inline constexpr size_t kParallelMinChunk = 1024 * 1024; // 1 MB
+
+// Runs fn(0..n-1): chunk 0 on the calling thread, the rest on workers.
+// The first exception thrown by any chunk is rethrown after all joins.
+template <typename Fn> inline void run_chunks_(size_t n, Fn &&fn) {
+  std::vector<std::exception_ptr> errors(n);
+  auto guarded = [&](size_t i) {
+    try {
+      fn(i);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(n);
+  for (size_t i = 1; i < n; ++i) {
+    try {
+      workers.emplace_back(guarded, i);
+    } catch (...) {
+      guarded(i); // thread creation failed: run the chunk inline
+    }
+  }
+  guarded(0);
+  for (auto &t : workers)
+    t.join();
+  for (auto &e : errors)
+    if (e)
+      std::rethrow_exception(e);
+}
+
+// Length of the backslash run ending just before src[i].
+inline size_t backslash_run_(const char *src, size_t i) noexcept {
+  size_t k = 0;
+  while (k < i && src[i - 1 - k] == '\\')
+    ++k;
+  return k;
+}
+
+// Kernel state at src[b] given the in-string parity of [0, b).
+inline Stage1Carry chunk_carry_(const char *src, size_t b,
+                                bool in_string) noexcept {
+  Stage1Carry c;
+  if (b == 0)
+    return c;
+  c.in_string = in_string ? ~0ULL : 0;
+  c.escaped = backslash_run_(src, b) & 1;
+  // Mirrors the kernels' ws_like bit for src[b - 1]. Only consulted when
+  // src[b] is outside a string, so src[b - 1] is too (or a closing quote).
+  const char ch = src[b - 1];
+  bool ws_like = static_cast<signed char>(ch) <= 0x20 || ch == '{' ||
+                 ch == '}' || ch == '[' || ch == ']' || ch == ':' ||
+                 ch == ',';
+  if (ch == '"')
+    ws_like = (backslash_run_(src, b - 1) & 1) == 0;
+  c.prev_ws_like = ws_like ? (1ULL << 63) : 0;
+  return c;
+}
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+// Parity of the unescaped quotes in [src + b, src + e). A quote is
+// unescaped iff the backslash run before it is even, so only blocks that
+// hold both quotes and backslashes look at single bytes. Every CPU with a
+// Stage 1 kernel has AVX2.
+BEAST_TARGET_AVX2 bool quote_parity_avx2(const char *src, size_t b,
+                                         size_t e) noexcept {
+  const __m256i v_quote = _mm256_set1_epi8('"');
+  const __m256i v_backslash = _mm256_set1_epi8('\\');
+  unsigned odd = 0;
+  size_t i = b;
+  for (; i + 32 <= e; i += 32) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    uint32_t q = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, v_quote)));
+    if (!q)
+      continue;
+    const uint32_t bs = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, v_backslash)));
+    if (BEAST_LIKELY(!bs && (i == 0 || src[i - 1] != '\\'))) {
+      odd ^= static_cast<unsigned>(__builtin_popcount(q));
+      continue;
+    }
+    for (; q; q &= q - 1) {
+      const size_t at = i + static_cast<size_t>(__builtin_ctz(q));
+      odd ^= static_cast<unsigned>(~backslash_run_(src, at) & 1);
+    }
+  }
+  for (; i < e; ++i)
+    if (src[i] == '"')
+      odd ^= static_cast<unsigned>(~backslash_run_(src, i) & 1);
+  return odd & 1;
+}
+
+/// Builds the Stage 1 index of `json` on up to `threads` threads (chunks of
+/// at least `min_chunk` bytes). Output equals a sequential scan. Returns
+/// false if no Stage 1 kernel is usable or the index would overflow.
+inline bool stage1_scan_parallel(std::string_view json, Stage1Index &idx,
+                                 unsigned threads,
+                                 size_t min_chunk = kParallelMinChunk) {
+  const Stage1Fn stage1 = stage1_kernel();
+  if (!stage1)
+    return false;
+  const char *src = json.data();
+  const size_t len = json.size();
+  size_t n = std::min<size_t>(threads ? threads : 1,
+                              len / std::max<size_t>(min_chunk, 64));
+  if (n <= 1) {
+    stage1(src, len, idx, 0, Stage1Carry{});
+    return true;
+  }
+  const size_t chunk = ((len + n - 1) / n + 63) & ~size_t{63};
+  n = (len + chunk - 1) / chunk;
+  auto bounds = [&](size_t i) {
+    return std::pair<size_t, size_t>(i * chunk,
+                                     std::min(len, (i + 1) * chunk));
+  };
+
+  std::vector<uint8_t> parity(n);
+  run_chunks_(n, [&](size_t i) {
+    const auto [b, e] = bounds(i);
+    parity[i] = quote_parity_avx2(src, b, e);
+  });
+
+  std::vector<Stage1Carry> carry(n);
+  bool in_string = false;
+  for (size_t i = 0; i < n; ++i) {
+    carry[i] = chunk_carry_(src, bounds(i).first, in_string);
+    in_string ^= parity[i] != 0;
+  }
+
+  // Chunk 0 scans straight into idx; the others go to per-chunk arrays,
+  // kept per calling thread so repeated parses reuse them like doc.idx.
+  // (Bound to a local reference: a lambda naming the thread_local directly
+  // would see each worker's own, empty instance.)
+  thread_local std::vector<Stage1Index> cache;
+  std::vector<Stage1Index> &parts = cache;
+  if (parts.size() < n - 1)
+    parts.resize(n - 1);
+  run_chunks_(n, [&](size_t i) {
+    const auto [b, e] = bounds(i);
+    stage1(src + b, e - b, i ? parts[i - 1] : idx,
+           static_cast<tape_off_t>(b), carry[i]);
+  });
+
+  // Concatenate in chunk order; each copy runs on its own thread.
+  std::vector<size_t> at(n - 1);
+  size_t total = idx.count;
+  for (size_t i = 0; i + 1 < n; ++i) {
+    at[i] = total;
+    total += parts[i].count;
+  }
+  // No overflow: at most one entry per byte, and check_source_size_()
+  // bounds the input by tape_off_t.
+  if (total > idx.capacity)
+    idx.grow(total);
+  run_chunks_(n - 1, [&](size_t i) {
+    std::memcpy(idx.positions + at[i], parts[i].positions,
+                parts[i].count * sizeof(tape_off_t));
+  });
+  idx.count = static_cast<tape_off_t>(total);
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Phase 90: Multi-threaded Stage 2 for a root array
+//
+// Elements of the root array are independent, so every depth-1 element
+// start in the Stage 1 index is a safe cut:
+//   1. Parallel: each nominal index range sums its bracket depth delta and
+//      quote parity; a prefix pass gives the exact depth at every range
+//      start.
+//   2. Parallel: from that known depth, each range walks forward to its
+//      first depth-1 element start (usually a few entries) — the cut.
+//   3. Parallel: each worker builds a partial tape over its cut range with
+//      Parser::parse_staged_elements(); worker 0 writes in place.
+//   4. Parallel: the other partial tapes are copied behind it, rebasing
+//      container end-links (Phase 80) and long-length indices (Phase 84);
+//      the root ArrayStart / ArrayEnd nodes are written last.
+// Any other shape — root not an array, a worker rejecting its range (which
+// includes closing the root early) — returns false and the caller runs the
+// sequential parse_staged(), so acceptance matches parse_reuse().
+// ─────────────────────────────────────────────────────────────
+
+// Builds doc.tape from doc.idx on up to `threads` threads; doc.tape must
+// hold doc.idx.count + 1 nodes. false: run parse_staged() instead. Throws
+// on trailing non-whitespace, as parse_reuse() would.
+inline bool stage2_parallel_(DocumentView &doc, unsigned threads,
+                             size_t min_chunk) {
+  const tape_off_t *pos = doc.idx.positions;
+  const tape_off_t count = doc.idx.count;
+  const char *src = doc.data();
+  if (count < 4 || src[pos[0]] != '[' || src[pos[count - 1]] != ']')
+    return false;
+  size_t n = std::min<size_t>(threads, doc.size() /
+                                           std::max<size_t>(min_chunk, 64));
+  if (n <= 1)
+    return false;
+
+  // Interior entries [1, last): everything between the root brackets.
+  const tape_off_t last = count - 1;
+  const size_t step = (last - 1 + n - 1) / n;
+  n = (last - 1 + step - 1) / step;
+  auto lo = [&](size_t k) { return static_cast<tape_off_t>(1 + k * step); };
+  auto hi = [&](size_t k) {
+    return static_cast<tape_off_t>(
+        std::min<size_t>(last, 1 + (k + 1) * step));
+  };
+
+  // 1. Depth delta and quote parity per nominal range.
+  struct RangeDelta {
+    int64_t depth = 0;
+    bool quotes = false;
+  };
+  std::vector<RangeDelta> delta(n);
+  run_chunks_(n, [&](size_t k) {
+    RangeDelta r;
+    for (tape_off_t i = lo(k); i < hi(k); ++i) {
+      const char c = src[pos[i]];
+      if (c == '{' || c == '[')
+        ++r.depth;
+      else if (c == '}' || c == ']')
+        --r.depth;
+      else if (c == '"')
+        r.quotes = !r.quotes;
+    }
+    delta[k] = r;
+  });
+  std::vector<RangeDelta> start(n); // depth / in-string at each range start
+  int64_t depth = 1;
+  bool in_string = false;
+  for (size_t k = 0; k < n; ++k) {
+    start[k].depth = depth;
+    start[k].quotes = in_string;
+    depth += delta[k].depth;
+    in_string ^= delta[k].quotes;
+  }
+  if (depth != 1 || in_string)
+    return false;
+
+  // 2. Cut k = first depth-1 element start at or after lo(k).
+  std::vector<tape_off_t> cut(n + 1);
+  cut[0] = 1;
+  cut[n] = last;
+  run_chunks_(n - 1, [&](size_t j) {
+    const size_t k = j + 1;
+    int64_t d = start[k].depth;
+    bool q = start[k].quotes;
+    tape_off_t i = lo(k);
+    for (; i < hi(k); ++i) {
+      const char c = src[pos[i]];
+      if (d == 1 && !q && c != '}' && c != ']')
+        break;
+      if (c == '{' || c == '[')
+        ++d;
+      else if (c == '}' || c == ']')
+        --d;
+      else if (c == '"')
+        q = !q;
+    }
+    cut[k] = i; // == hi(k): no element starts here; merges into range k-1
+  });
+
+  // 3. Partial tapes. Scratch documents are kept per calling thread, like
+  // the Stage 1 chunk arrays.
+  thread_local std::vector<std::unique_ptr<DocumentView>> cache;
+  std::vector<std::unique_ptr<DocumentView>> &parts = cache;
+  while (parts.size() < n - 1)
+    parts.push_back(std::make_unique<DocumentView>());
+  std::vector<uint32_t> elements(n);
+  std::vector<uint8_t> ok(n);
+  doc.tape.head = doc.tape.base + 1; // root node is written in step 4
+  run_chunks_(n, [&](size_t k) {
+    DocumentView &d = k ? *parts[k - 1] : doc;
+    const tape_off_t len = cut[k + 1] - cut[k];
+    if (k) {
+      d.source = doc.source;
+      d.decode_numbers_ = doc.decode_numbers_;
+      d.long_lens_.clear();
+      d.tape.reserve(len + size_t{1});
+    }
+    ok[k] = Parser(&d).parse_staged_elements(pos + cut[k], len, cut[k] == 1,
+                                             elements[k]);
+  });
+  if (std::find(ok.begin(), ok.end(), 0) != ok.end()) {
+    doc.long_lens_.clear();
+    return false;
+  }
+
+  // 4. Stitch: offsets of each partial tape in the final one.
+  std::vector<size_t> at(n);
+  size_t total = doc.tape.size();
+  uint64_t elems = elements[0];
+  for (size_t k = 1; k < n; ++k) {
+    at[k] = total;
+    total += parts[k - 1]->tape.size();
+    elems += elements[k];
+  }
+  if (doc.decode_numbers_ && doc.numbers_.size() < total)
+    doc.numbers_.resize(std::max(doc.tape.capacity(), total));
+  run_chunks_(n - 1, [&](size_t j) {
+    const TapeArena &part = parts[j]->tape;
+    const size_t base = at[j + 1];
+    TapeNode *out = doc.tape.base + base;
+    const size_t m = part.size();
+    // Phase 97: decoded numbers move with their nodes.
+    const std::vector<uint64_t> &nums = parts[j]->numbers_;
+    if (doc.decode_numbers_ && !nums.empty())
+      std::memcpy(doc.numbers_.data() + base, nums.data(),
+                  std::min(m, nums.size()) * sizeof(uint64_t));
+#if BEAST_JSON_TAPE_LINKS
+    for (size_t i = 0; i < m; ++i) {
+      TapeNode nd = part.base[i];
+      const TapeNodeType t = nd.type();
+      if (t == TapeNodeType::ObjectStart || t == TapeNodeType::ArrayStart)
+        nd.offset += static_cast<tape_off_t>(base);
+      out[i] = nd;
+    }
+#else
+    std::memcpy(out, part.base, m * sizeof(TapeNode));
+#endif
+  });
+  for (size_t k = 1; k < n; ++k)
+    for (const auto &[node, len] : parts[k - 1]->long_lens_)
+      doc.long_lens_.emplace_back(node + static_cast<uint32_t>(at[k]), len);
+
+  TapeNode &root = doc.tape.base[0];
+  root.meta = (static_cast<uint32_t>(TapeNodeType::ArrayStart) << 24) |
+              static_cast<uint32_t>(
+                  std::min<uint64_t>(elems, TapeNode::kCountSaturated));
+#if BEAST_JSON_TAPE_LINKS
+  root.offset = static_cast<tape_off_t>(total);
+#else
+  root.offset = pos[0];
+#endif
+  TapeNode &end = doc.tape.base[total];
+  end.meta = static_cast<uint32_t>(TapeNodeType::ArrayEnd) << 24;
+  end.offset = pos[last];
+  doc.tape.head = &end + 1;
+
+  // parse_staged()'s trailing check: only whitespace after the root.
+  for (const char *p = src + pos[last] + 1; p < src + doc.size(); ++p)
+    if (static_cast<unsigned char>(*p) > 0x20)
+      throw std::runtime_error("Invalid JSON");
+  return true;
+}
+#endif // BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+
+/// Opt-in multi-threaded parse: Stage 1 runs on up to `threads` threads
+/// (0 = hardware_concurrency()); so does Stage 2 when the root is an array,
+/// otherwise it runs on the calling thread. Produces the same tape as
+/// parse_reuse(), which it defers to when the input is too small to split
+/// or no Stage 1 kernel is available.
+inline Value parse_parallel(DocumentView &doc, std::string_view json,
+                            unsigned threads,
+                            size_t min_chunk = kParallelMinChunk) {
+  if (threads == 0)
+    threads = std::thread::hardware_concurrency();
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+  if (threads <= 1 || json.size() < 2 * std::max<size_t>(min_chunk, 64) ||
+      !stage1_kernel())
+    return parse_reuse(doc, json);
+  prepare_parse_(doc, json);
+  check_utf8_(doc, json); // Phase 100: not fused into the chunked scan
+  if (stage1_scan_parallel(json, doc.idx, threads, min_chunk)) {
+    doc.tape.reserve(doc.idx.count + size_t{1});
+    if (!stage2_parallel_(doc, threads, min_chunk) &&
+        !Parser(&doc).parse_staged(doc.idx))
+      throw std::runtime_error("Invalid JSON");
+  } else {
+    doc.tape.reserve(json.size() / 8 + 64);
+    if (!Parser(&doc).parse())
+      throw std::runtime_error("Invalid JSON");
+  }
+  return finish_parse_(doc);
+#else
+  (void)min_chunk;
+  return parse_reuse(doc, json);
+#endif
+}
+
+// ── Value::merge_patch() out-of-line (needs parse_reuse) ────────────────────
+inline void Value::merge_patch(std::string_view patch_json) {
+  if (!is_object())
+    return;
+  DocumentView patch_doc;
+  Value patch = parse_reuse(patch_doc, patch_json);
+  merge_patch_impl_(patch);
+}
+
+// ───────────────────────────────────────────────────────────────────────────
+// SafeValue — optional-propagating chain proxy
+//
+// Returned by Value::get(key/idx).  Every subsequent operator[] propagates
+// std::nullopt silently: if any step is absent, the entire chain returns
+// an empty SafeValue without throwing.
+//
+// Read path comparison:
+//   root["user"]["id"].as<int>()        ← throws on missing key (fast path)
+//   root.get("user")["id"].as<int>()    ← std::optional<int>, never throws
+//   root.get("user")["id"].value_or(-1) ← int with default, never throws
+//
+// SafeValue is std::optional<Value>-compatible: has_value(), operator bool,
+// operator* and operator-> all work, so existing code using optional<Value>
+// patterns compiles unchanged.
+// ───────────────────────────────────────────────────────────────────────────
+
+/// @brief An optional-propagating proxy for safe JSON navigation.
+/// @details `SafeValue` is obtained via `Value::get()`. It propagates absence
+/// silently (similar to a monad). Any chained access on an absent `SafeValue`
+/// will return another absent `SafeValue` without throwing or crashing.
+class SafeValue {
+  Value val_; // valid only when has_ == true; default-constructed otherwise
+  bool has_ = false;
+
+public:
+  SafeValue() noexcept = default;
+  explicit SafeValue(Value v) noexcept : val_(v), has_(true) {}
+
+  // ── std::optional-compatible interface ───────────────────────────────────
+
+  bool has_value() const noexcept { return has_; }
+  explicit operator bool() const noexcept { return has_; }
+
+  Value &value() {
+    if (!has_)
+      throw std::bad_optional_access{};
+    return val_;
+  }
+  const Value &value() const {
+    if (!has_)
+      throw std::bad_optional_access{};
+    return val_;
+  }
+  Value &operator*() { return value(); }
+  const Value &operator*() const { return value(); }
+  Value *operator->() { return &value(); }
+  const Value *operator->() const { return &value(); }
+
+  // ── Type checks — false when absent ──────────────────────────────────────
+
+  bool is_null() const noexcept { return has_ && val_.is_null(); }
+  bool is_bool() const noexcept { return has_ && val_.is_bool(); }
+  bool is_int() const noexcept { return has_ && val_.is_int(); }
+  bool is_double() const noexcept { return has_ && val_.is_double(); }
+  bool is_number() const noexcept { return has_ && val_.is_number(); }
+  bool is_string() const noexcept { return has_ && val_.is_string(); }
+  bool is_object() const noexcept { return has_ && val_.is_object(); }
+  bool is_array() const noexcept { return has_ && val_.is_array(); }
+
+  // ── Chaining — absent propagates forward, never throws ───────────────────
+
+  SafeValue operator[](std::string_view key) const noexcept {
+    if (!has_)
+      return {};
+    return val_.get(key); // calls Value::get() defined below
+  }
+  SafeValue operator[](const char *key) const noexcept {
+    return (*this)[std::string_view(key)];
+  }
+  SafeValue operator[](size_t idx) const noexcept {
+    if (!has_)
+      return {};
+    return val_.get(idx);
+  }
+  SafeValue operator[](int idx) const noexcept {
+    if (idx < 0 || !has_)
+      return {};
+    return val_.get(static_cast<size_t>(idx));
+  }
+
+  // Alias for further chaining (same as operator[]):
+  SafeValue get(std::string_view key) const noexcept { return (*this)[key]; }
+  SafeValue get(const char *key) const noexcept { return (*this)[key]; }
+  SafeValue get(size_t idx) const noexcept { return (*this)[idx]; }
+  SafeValue get(int idx) const noexcept { return (*this)[idx]; }
+
+  // ── Terminal: typed extraction ────────────────────────────────────────────
+
+  // as<T>() — returns std::optional<T>; std::nullopt when absent or wrong type
+  template <JsonReadable T> std::optional<T> as() const noexcept {
+    if (!has_)
+      return std::nullopt;
+    return val_.try_as<T>();
+  }
+
+  // value_or(default) — direct T with fallback; never throws
+  template <JsonReadable T> T value_or(T def) const noexcept {
+    auto r = as<T>();
+    return r ? *r : def;
+  }
+
+  // dump() — "null" when absent
   std::string dump() const { return has_ ? val_.dump() : "null"; }
 
   // ── Pipe fallback on SafeValue: safe_val | default ────────────────────────
@@ -5307,20 +9765,11 @@ inline SafeValue Value::get(const char *key) const noexcept {
   return get(std::string_view(key));
 }
 inline SafeValue Value::get(size_t idx) const noexcept {
-  if (!is_array())
+  // Same lookup as operator[](size_t): element table + deleted_ aware.
+  Value v = (*this)[idx];
+  if (!v)
     return {};
-  uint32_t i = idx_ + 1;
-  const size_t ntape = doc_->tape.size();
-  size_t count = 0;
-  while (i < ntape) {
-    if (doc_->tape[i].type() == TapeNodeType::ArrayEnd)
-      return {};
-    if (count == idx)
-      return SafeValue(Value(doc_, i));
-    i = skip_value_(i);
-    ++count;
-  }
-  return {};
+  return SafeValue(v);
 }
 inline SafeValue Value::get(int idx) const noexcept {
   if (idx < 0)
@@ -5328,6 +9777,7 @@ inline SafeValue Value::get(int idx) const noexcept {
   return get(static_cast<size_t>(idx));
 }
 
+} // namespace BEAST_JSON_TAPE_ABI
 } // namespace lazy
 } // namespace json
 } // namespace beast
@@ -5393,6 +9843,21 @@ using Document = beast::json::lazy::DocumentView;
 /// Lifetime tied to the originating Document.
 using Value = beast::json::lazy::Value;
 
+/// Push-style parser for a document arriving in chunks: feed() each chunk
+/// (or advance() over a buffer filled in place), then finish() for the root.
+using StreamParser = beast::json::lazy::StreamParser;
+
+/// Owned input buffer with the zero padding parse_padded() relies on.
+using PaddedString = beast::json::lazy::PaddedString;
+
+/// Forward-only on-demand reader: iterate() a message and look up fields
+/// or walk arrays in document order, with no tape built. Reusable.
+using Cursor = beast::json::lazy::Cursor;
+
+/// A value under a Cursor; read with as<T>(), navigate with operator[]
+/// and elements(). Spent once the cursor moves past it.
+using OnDemandValue = beast::json::lazy::OnDemandValue;
+
 /// @brief Parses a JSON string into the provided Document.
 /// @param doc The Document object which will own the allocated memory.
 /// @param json The JSON string to parse.
@@ -5403,10 +9868,142 @@ inline Value parse(Document &doc, std::string_view json) {
   return beast::json::lazy::parse_reuse(doc, json);
 }
 
+/// Error code of the exception-free API: parse(doc, json, ec) and
+/// Value::get<T>().
+using Error = beast::json::lazy::Error;
+
+/// A T or an Error, after std::expected: returned by Value::get<T>().
+template <typename T> using Result = beast::json::lazy::Result<T>;
+
+/// The message the throwing API uses for an Error. (A using-declaration:
+/// a wrapper would be ambiguous with the one found through Error by ADL.)
+using beast::json::lazy::error_message;
+
+/// @brief parse() without exceptions: malformed input sets `ec` (to
+/// Error::InvalidJson, or InputTooLarge / TapeTooLarge) and returns an
+/// invalid Value{}; success sets Error::None. Nothing is thrown or
+/// allocated for a rejected document. std::bad_alloc still propagates.
+inline Value parse(Document &doc, std::string_view json, Error &ec) {
+  return beast::json::lazy::parse_reuse(doc, json, ec);
+}
+
+/// @brief Same result as parse(), with the Stage 1 structural scan split
+/// across threads. Opt-in; pays off on multi-megabyte documents.
+/// @param threads Worker count; 0 uses std::thread::hardware_concurrency().
+/// @note Inputs under ~2 MB, or builds without a Stage 1 kernel, parse on
+/// the calling thread exactly as parse() does.
+inline Value parse_parallel(Document &doc, std::string_view json,
+                            unsigned threads = 0) {
+  return beast::json::lazy::parse_parallel(doc, json, threads);
+}
+
+/// @brief Parses a stream of JSON documents — NDJSON / JSON Lines, or any
+/// whitespace between top-level values — into one shared tape.
+/// @return An array Value with one element per document: iterate
+/// `elements()` or index it. An empty stream yields an empty array.
+/// @throws std::runtime_error if any document is malformed.
+inline Value parse_many(Document &doc, std::string_view json) {
+  return beast::json::lazy::parse_many(doc, json);
+}
+
+/// @brief parse() for input in a PaddedString: the scanners skip their
+/// end-of-input bounds checks and tail loops, which pays off on small
+/// messages. Same result as parse(); `json` must outlive the Values.
+inline Value parse_padded(Document &doc, const PaddedString &json) {
+  return beast::json::lazy::parse_padded(doc, json.view());
+}
+Value parse_padded(Document &doc, PaddedString &&json) = delete; // dangles
+
+/// @brief Parses a JSON file, memory-mapped rather than read into a string.
+/// The mapping is owned by `doc` and released by its next parse_file() or
+/// its destruction.
+/// @param populate Pre-fault the whole file up front (MAP_POPULATE, Linux)
+/// instead of on first touch — worth it for files parsed end to end.
+/// @throws std::runtime_error if the file cannot be read or is malformed.
+inline Value parse_file(Document &doc, const std::string &path,
+                        bool populate = false) {
+  return beast::json::lazy::parse_file(doc, path.c_str(), populate);
+}
+
+/// @brief True if `json` is well-formed UTF-8: the check parsing adds under
+/// Document::enable_utf8_validation(), as a standalone pass.
+inline bool validate_utf8(std::string_view json) noexcept {
+  return beast::json::lazy::validate_utf8(json.data(), json.size());
+}
+
 /// Optional-propagating chain proxy returned by Value::get().
 /// Propagates std::nullopt silently through nested access — never throws.
 using SafeValue = beast::json::lazy::SafeValue;
 
+// ============================================================================
+// Phase 104: parse policies — beast::parse<Policy>(doc, json)
+// ============================================================================
+//
+// A policy is a type with these static constexpr members; each combination
+// compiles its own grammar loop, so a disabled feature costs nothing:
+//
+//   comments         // line and /* block */ comments count as whitespace
+//   trailing_commas  [1,2,] and {"a":1,} are accepted
+//   duplicate_keys   Keep, Reject, or LastWins (see DuplicateKeys)
+//   nan_inf          NaN, Infinity and -Infinity are numbers
+//   max_depth        deeper nesting fails (the tape stops at 1087 anyway)
+//
+// Derive from policy::Strict and override what differs:
+//
+//   struct Config : beast::policy::Strict {
+//     static constexpr bool comments = true;
+//     static constexpr auto duplicate_keys = beast::DuplicateKeys::Reject;
+//   };
+//   beast::Value root = beast::parse<Config>(doc, text);
+//
+// Every policy runs the single-pass grammar of parse_strict() (Phase 101),
+// which sees each comma and comment. The two-stage SIMD parser behind
+// parse() cannot: its Stage 1 index drops ',' and ':' (Phase 53), and a
+// quote inside a comment would flip its string mask. So there is no
+// policy for it: parse() stays the lenient entry point, and no set of
+// members reproduces what it accepts (it also lets a missing ':' or ','
+// through).
+// ============================================================================
+
+/// How parse<Policy>() treats a key repeated within one object. Keys are
+/// compared as written: "a" and "\u0061" are different keys.
+enum class DuplicateKeys : uint8_t {
+  Keep,    // every member stays; lookups find the first
+  Reject,  // the parse fails
+  LastWins // earlier members are erased, as by Value::erase()
+};
+
+/// The members parse<Policy>() reads.
+template <typename P>
+concept ParsePolicy = requires {
+  { P::comments } -> std::convertible_to<bool>;
+  { P::trailing_commas } -> std::convertible_to<bool>;
+  { P::duplicate_keys } -> std::convertible_to<DuplicateKeys>;
+  { P::nan_inf } -> std::convertible_to<bool>;
+  { P::max_depth } -> std::convertible_to<uint32_t>;
+};
+
+namespace policy {
+
+/// RFC 8259 exactly: parse_strict().
+struct Strict {
+  static constexpr bool comments = false;
+  static constexpr bool trailing_commas = false;
+  static constexpr DuplicateKeys duplicate_keys = DuplicateKeys::Keep;
+  static constexpr bool nan_inf = false;
+  static constexpr uint32_t max_depth = UINT32_MAX; // the tape's limit only
+};
+
+/// Hand-written configuration files: comments, trailing commas and
+/// NaN / Infinity on top of RFC 8259.
+struct Relaxed : Strict {
+  static constexpr bool comments = true;
+  static constexpr bool trailing_commas = true;
+  static constexpr bool nan_inf = true;
+};
+
+} // namespace policy
+
 // ============================================================================
 // beast::rfc8259 — RFC 8259 strict validator
 // ============================================================================
@@ -5444,28 +10041,260 @@ namespace detail_ {
   throw std::runtime_error(buf);
 }
 
-struct Validator {
+// ── Phase 102: block scans ─────────────────────────────────────
+// The scalar Validator still walks the input token by token, but string
+// content is skipped 64 bytes per step with AVX-512, 32 with AVX2 (picked
+// at run time under BEAST_JSON_RUNTIME_DISPATCH), 16 with NEON, else 8
+// (SWAR), and digit runs 8 at a time. Each scan returns
+// the first byte that ends its run (or end), so the checks after it and
+// every error offset are those of the byte loops they replace. Whitespace
+// stays a plain loop: the runs between tokens are mostly one or two
+// bytes, too short for a vector to pay off.
+
+// SWAR: 0x80 in each byte of w equal to c (exact, unlike the borrowing
+// haszero() trick, whose flags above the first match may be false).
+inline uint64_t swar_eq_(uint64_t w, uint8_t c) noexcept {
+  constexpr uint64_t M = 0x7F7F7F7F7F7F7F7FULL;
+  const uint64_t x = w ^ (0x0101010101010101ULL * c);
+  return ~(((x & M) + M) | x | M);
+}
+
+// Index of the first flagged byte (0x80 / 0xFF) of a 16-byte NEON mask.
+#if BEAST_HAS_NEON
+inline int neon_first_(uint8x16_t m) noexcept {
+  const uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+  return BEAST_CTZ(vget_lane_u64(vreinterpret_u64_u8(n), 0)) >> 2;
+}
+#endif
+
+// String content: the first '"', '\\' or control character (< 0x20).
+// string_stop_() below picks the widest of these the host runs; each
+// finishes its last partial vector with the SWAR loop.
+inline const char *string_stop_swar_(const char *p, const char *end) noexcept {
+  constexpr uint64_t K = 0x0101010101010101ULL, H = 0x8080808080808080ULL;
+  for (; p + 8 <= end; p += 8) {
+    const uint64_t w = json::lazy::load64(p);
+    // Bytes below 0x20: the borrow trick is exact for the lowest one.
+    const uint64_t m = swar_eq_(w, '"') | swar_eq_(w, '\\') |
+                       ((w - K * 0x20) & ~w & H);
+    if (m)
+      return p + (BEAST_CTZ(m) >> 3);
+  }
+  while (p < end && *p != '"' && *p != '\\' &&
+         static_cast<unsigned char>(*p) >= 0x20)
+    ++p;
+  return p;
+}
+
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX512 const char *string_stop_avx512_(const char *p,
+                                                    const char *end) noexcept {
+  const __m512i q = _mm512_set1_epi8('"'), bs = _mm512_set1_epi8('\\');
+  const __m512i sp = _mm512_set1_epi8(0x20);
+  for (; p + 64 <= end; p += 64) {
+    const __m512i v = _mm512_loadu_si512(p);
+    const uint64_t m = _mm512_cmpeq_epi8_mask(v, q) |
+                       _mm512_cmpeq_epi8_mask(v, bs) |
+                       _mm512_cmplt_epu8_mask(v, sp);
+    if (m)
+      return p + BEAST_CTZ(m);
+  }
+  return string_stop_swar_(p, end);
+}
+#endif
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX2 const char *string_stop_avx2_(const char *p,
+                                                const char *end) noexcept {
+  const __m256i q = _mm256_set1_epi8('"'), bs = _mm256_set1_epi8('\\');
+  const __m256i c1f = _mm256_set1_epi8(0x1F);
+  for (; p + 32 <= end; p += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    const __m256i m = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, q), _mm256_cmpeq_epi8(v, bs)),
+        _mm256_cmpeq_epi8(_mm256_min_epu8(v, c1f), v)); // v <= 0x1F
+    const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+    if (bits)
+      return p + BEAST_CTZ(bits);
+  }
+  return string_stop_swar_(p, end);
+}
+#endif
+
+#if BEAST_HAS_NEON
+inline const char *string_stop_neon_(const char *p, const char *end) noexcept {
+  const uint8x16_t q = vdupq_n_u8('"'), bs = vdupq_n_u8('\\');
+  const uint8x16_t sp = vdupq_n_u8(0x20);
+  for (; p + 16 <= end; p += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    const uint8x16_t m =
+        vorrq_u8(vorrq_u8(vceqq_u8(v, q), vceqq_u8(v, bs)), vcltq_u8(v, sp));
+    if (vmaxvq_u8(m))
+      return p + neon_first_(m);
+  }
+  return string_stop_swar_(p, end);
+}
+#endif
+
+#if BEAST_JSON_RUNTIME_DISPATCH
+using StringStopFn = const char *(*)(const char *, const char *) noexcept;
+
+inline StringStopFn string_stop_select_() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return &string_stop_avx512_;
+  if (__builtin_cpu_supports("avx2"))
+    return &string_stop_avx2_;
+  return &string_stop_swar_;
+}
+#endif
+
+inline const char *string_stop_(const char *p, const char *end) noexcept {
+#if BEAST_HAS_AVX512
+  return string_stop_avx512_(p, end);
+#elif BEAST_HAS_AVX2
+  return string_stop_avx2_(p, end);
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  static const StringStopFn fn = string_stop_select_();
+  return fn(p, end);
+#elif BEAST_HAS_NEON
+  return string_stop_neon_(p, end);
+#else
+  return string_stop_swar_(p, end);
+#endif
+}
+
+// Digits: the first byte outside '0'..'9'. Numbers are short, so 8 bytes
+// per step (two for a typical double) is as wide as it pays to go.
+inline const char *digits_end_(const char *p, const char *end) noexcept {
+  for (; p + 8 <= end; p += 8) {
+    const uint64_t s = json::lazy::load64(p) - 0x3030303030303030ULL;
+    const uint64_t nd =
+        (s | ((s & 0x7F7F7F7F7F7F7F7FULL) + 0x7676767676767676ULL)) &
+        0x8080808080808080ULL;
+    if (nd)
+      return p + (BEAST_CTZ(nd) >> 3);
+  }
+  while (p < end && static_cast<unsigned>(*p - '0') < 10u)
+    ++p;
+  return p;
+}
+
+// Phase 101: kBuild = true is parse_strict(): the same grammar, pushing
+// each token onto `out`'s tape as it is accepted, so strict parsing reads
+// the input once. Messages and offsets do not depend on kBuild.
+// Phase 104: Policy widens the grammar for parse<Policy>(); every check
+// it adds is an if constexpr, so policy::Strict compiles to the loop
+// above unchanged.
+template <bool kBuild, ParsePolicy Policy = policy::Strict> struct Validator {
   const char *p;
   const char *end;
   const char *begin;
+  core::Parser *out = nullptr; // kBuild only
+  uint32_t depth = 0;          // counted only under a Policy::max_depth
+
+  // Policy::duplicate_keys != Keep: the keys of the open objects, with
+  // each key's tape node (LastWins erases the earlier member). An object
+  // is searched linearly up to kLinearKeys keys, then through wide[level],
+  // an open-addressing table of keys[] indices + 1 that each nesting
+  // level reuses, so steady-state parsing allocates nothing.
+  static constexpr bool kTrackKeys =
+      Policy::duplicate_keys != DuplicateKeys::Keep;
+  static constexpr size_t kLinearKeys = 16;
+  struct Key {
+    std::string_view name;
+    uint32_t node;
+  };
+  struct KeyIndex {
+    std::vector<uint32_t> slots; // power of two, at most half full
+    bool built = false;
+  };
+  std::vector<Key> keys;
+  std::vector<KeyIndex> wide;
+  uint32_t obj_level = 0;
+
+  // The first and last 8 bytes and the length: keys are short, and two
+  // multiplies beat a byte loop.
+  static size_t key_hash(std::string_view k) noexcept {
+    uint64_t a = 0, b = 0;
+    if (k.size() >= 8) {
+      std::memcpy(&a, k.data(), 8);
+      std::memcpy(&b, k.data() + k.size() - 8, 8);
+    } else {
+      for (size_t i = 0; i < k.size(); ++i)
+        a |= uint64_t(static_cast<uint8_t>(k[i])) << (8 * i);
+    }
+    const uint64_t h =
+        (a * 0x9E3779B97F4A7C15ull) ^ ((b ^ k.size()) * 0xC2B2AE3D27D4EB4Full);
+    return static_cast<size_t>(h ^ (h >> 32));
+  }
+
+  // The slot holding `name`, or the empty slot where it would go.
+  uint32_t &key_slot(KeyIndex &ix, std::string_view name) noexcept {
+    const size_t mask = ix.slots.size() - 1;
+    for (size_t i = key_hash(name) & mask;; i = (i + 1) & mask) {
+      uint32_t &slot = ix.slots[i];
+      if (slot == 0 || keys[slot - 1].name == name)
+        return slot;
+    }
+  }
 
-  void ws() noexcept {
-    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
-      ++p;
+  // Indexes keys[first, keys.size()), sized for twice as many.
+  void key_rebuild(KeyIndex &ix, size_t first) {
+    size_t cap = 64;
+    while (cap < 4 * (keys.size() - first))
+      cap *= 2;
+    ix.slots.assign(cap, 0);
+    for (size_t i = first; i < keys.size(); ++i)
+      key_slot(ix, keys[i].name) = static_cast<uint32_t>(i + 1);
+    ix.built = true;
+  }
+
+  void ws() noexcept(!Policy::comments) {
+    for (;;) {
+      while (p < end &&
+             (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+        ++p;
+      if constexpr (Policy::comments) {
+        if (end - p >= 2 && *p == '/' && (p[1] == '/' || p[1] == '*')) {
+          if (p[1] == '/') {
+            const void *nl = std::memchr(p + 2, '\n', end - p - 2);
+            p = nl ? static_cast<const char *>(nl) + 1 : end;
+            continue;
+          }
+          const char *q = p + 2;
+          while (q + 1 < end && !(q[0] == '*' && q[1] == '/'))
+            ++q;
+          if (q + 1 >= end)
+            fail("unterminated comment", p, begin);
+          p = q + 2;
+          continue;
+        }
+      }
+      return;
+    }
   }
 
-  void expect_literal(const char *lit, size_t len) {
+  void expect_literal(const char *lit, size_t len,
+                      core::TapeNodeType t) {
     if (static_cast<size_t>(end - p) < len || std::memcmp(p, lit, len) != 0)
       fail("invalid literal", p, begin);
+    if constexpr (kBuild)
+      out->strict_value_(t, p, len);
     p += len;
   }
 
   void parse_string() {
     ++p; // skip '"'
-    while (p < end) {
+    [[maybe_unused]] const char *s = p;
+    while ((p = string_stop_(p, end)) < end) {
       unsigned char c = static_cast<unsigned char>(*p++);
-      if (c == '"')
+      if (c == '"') {
+        if constexpr (kBuild)
+          out->strict_value_(core::TapeNodeType::StringRaw, s,
+                             static_cast<size_t>(p - 1 - s));
         return; // end of string
+      }
       if (c == '\\') {
         if (p >= end)
           fail("unterminated escape sequence", p - 1, begin);
@@ -5492,6 +10321,8 @@ struct Validator {
   }
 
   void parse_number() {
+    [[maybe_unused]] const char *s = p;
+    bool flt = false; // Integer or NumberRaw, as parse() tells them apart
     // Optional minus
     if (*p == '-')
       ++p;
@@ -5507,43 +10338,114 @@ struct Validator {
         fail("leading zero in number", p - 1, begin);
     } else if (static_cast<unsigned char>(*p) >= '1' &&
                static_cast<unsigned char>(*p) <= '9') {
-      while (p < end && static_cast<unsigned char>(*p) >= '0' &&
-             static_cast<unsigned char>(*p) <= '9')
-        ++p;
+      p = digits_end_(p + 1, end);
     } else {
       fail("invalid number", p, begin);
     }
 
     // Optional fractional part
     if (p < end && *p == '.') {
+      flt = true;
       ++p;
       if (p >= end || static_cast<unsigned char>(*p) < '0' ||
           static_cast<unsigned char>(*p) > '9')
         fail("trailing decimal point or missing digits after '.'", p - 1,
              begin);
-      while (p < end && static_cast<unsigned char>(*p) >= '0' &&
-             static_cast<unsigned char>(*p) <= '9')
-        ++p;
+      p = digits_end_(p + 1, end);
     }
 
     // Optional exponent
     if (p < end && (*p == 'e' || *p == 'E')) {
+      flt = true;
       ++p;
       if (p < end && (*p == '+' || *p == '-'))
         ++p;
       if (p >= end || static_cast<unsigned char>(*p) < '0' ||
           static_cast<unsigned char>(*p) > '9')
         fail("missing digits in exponent", p - 1, begin);
-      while (p < end && static_cast<unsigned char>(*p) >= '0' &&
-             static_cast<unsigned char>(*p) <= '9')
-        ++p;
+      p = digits_end_(p + 1, end);
     }
+    if constexpr (kBuild)
+      out->strict_number_(s, p, flt);
+  }
+
+  // NaN, Infinity, -Infinity (Policy::nan_inf): NumberRaw, which
+  // as<double>() reads as parse_double() does.
+  void parse_nan_inf() {
+    const char *s = p;
+    if (*p == '-')
+      ++p;
+    if (p == s && end - p >= 3 && std::memcmp(p, "NaN", 3) == 0)
+      p += 3;
+    else if (end - p >= 8 && std::memcmp(p, "Infinity", 8) == 0)
+      p += 8;
+    else
+      fail("invalid literal", s, begin);
+    if constexpr (kBuild)
+      out->strict_number_(s, p, true);
+  }
+
+  // Phase 101: the tape's container nodes. Past Parser::kMaxDepth the
+  // error is parse()'s, as when parse_strict() validated then parsed.
+  void open(core::TapeNodeType t) {
+    if constexpr (Policy::max_depth != UINT32_MAX)
+      if (++depth > Policy::max_depth)
+        fail("nesting deeper than the policy's max_depth", p, begin);
+    if constexpr (kBuild)
+      if (!out->strict_open_(t, p))
+        throw std::runtime_error("Invalid JSON");
+  }
+
+  void close(core::TapeNodeType t) {
+    if constexpr (Policy::max_depth != UINT32_MAX)
+      --depth;
+    if constexpr (kBuild)
+      out->strict_close_(t, p);
+  }
+
+  // The key just parsed, starting at `s` (its opening quote), against the
+  // object's earlier keys, which start at keys[first].
+  void check_key(const char *s, size_t first, uint32_t level) {
+    const std::string_view name(s + 1, static_cast<size_t>(p - s - 2));
+    uint32_t node = 0;
+    if constexpr (kBuild)
+      node = out->strict_last_();
+    const size_t n = keys.size() - first;
+    Key *hit = nullptr;
+    uint32_t *slot = nullptr;
+    if (n <= kLinearKeys) {
+      for (size_t i = first; i < keys.size(); ++i)
+        if (keys[i].name == name) {
+          hit = &keys[i];
+          break;
+        }
+    } else {
+      KeyIndex &ix = wide[level];
+      if (!ix.built || 2 * n >= ix.slots.size())
+        key_rebuild(ix, first);
+      slot = &key_slot(ix, name);
+      if (*slot)
+        hit = &keys[*slot - 1];
+    }
+    if (hit) {
+      if constexpr (Policy::duplicate_keys == DuplicateKeys::Reject)
+        fail("duplicate key", s, begin);
+      if constexpr (kBuild)
+        out->strict_erase_(hit->node);
+      hit->node = node;
+      return;
+    }
+    keys.push_back({name, node});
+    if (slot)
+      *slot = static_cast<uint32_t>(keys.size());
   }
 
   void parse_array() {
+    open(core::TapeNodeType::ArrayStart);
     ++p; // skip '['
     ws();
     if (p < end && *p == ']') {
+      close(core::TapeNodeType::ArrayEnd);
       ++p;
       return;
     } // empty array
@@ -5552,26 +10454,48 @@ struct Validator {
     while (p < end && *p == ',') {
       ++p; // skip ','
       ws();
-      if (p < end && *p == ']')
-        fail("trailing comma in array", p - 1, begin);
+      if (p < end && *p == ']') {
+        if constexpr (Policy::trailing_commas)
+          break;
+        else
+          fail("trailing comma in array", p - 1, begin);
+      }
       parse_value();
       ws();
     }
     if (p >= end || *p != ']')
       fail("expected ']'", p, begin);
+    close(core::TapeNodeType::ArrayEnd);
     ++p;
   }
 
+  void parse_key([[maybe_unused]] size_t first,
+                 [[maybe_unused]] uint32_t level) {
+    [[maybe_unused]] const char *s = p;
+    parse_string();
+    if constexpr (kTrackKeys)
+      check_key(s, first, level);
+  }
+
   void parse_object() {
+    open(core::TapeNodeType::ObjectStart);
     ++p; // skip '{'
     ws();
     if (p < end && *p == '}') {
+      close(core::TapeNodeType::ObjectEnd);
       ++p;
       return;
     } // empty object
+    [[maybe_unused]] const size_t first = keys.size();
+    [[maybe_unused]] const uint32_t level = obj_level;
+    if constexpr (kTrackKeys) {
+      if (wide.size() <= level)
+        wide.resize(level + 1);
+      ++obj_level;
+    }
     if (p >= end || *p != '"')
       fail("expected string key", p, begin);
-    parse_string();
+    parse_key(first, level);
     ws();
     if (p >= end || *p != ':')
       fail("expected ':' after key", p, begin);
@@ -5581,11 +10505,15 @@ struct Validator {
     while (p < end && *p == ',') {
       ++p; // skip ','
       ws();
-      if (p < end && *p == '}')
-        fail("trailing comma in object", p - 1, begin);
+      if (p < end && *p == '}') {
+        if constexpr (Policy::trailing_commas)
+          break;
+        else
+          fail("trailing comma in object", p - 1, begin);
+      }
       if (p >= end || *p != '"')
         fail("expected string key", p, begin);
-      parse_string();
+      parse_key(first, level);
       ws();
       if (p >= end || *p != ':')
         fail("expected ':' after key", p, begin);
@@ -5595,6 +10523,12 @@ struct Validator {
     }
     if (p >= end || *p != '}')
       fail("expected '}'", p, begin);
+    if constexpr (kTrackKeys) {
+      keys.resize(first);
+      wide[level].built = false;
+      --obj_level;
+    }
+    close(core::TapeNodeType::ObjectEnd);
     ++p;
   }
 
@@ -5610,11 +10544,15 @@ struct Validator {
     else if (c == '[')
       parse_array();
     else if (c == 't')
-      expect_literal("true", 4);
+      expect_literal("true", 4, core::TapeNodeType::BooleanTrue);
     else if (c == 'f')
-      expect_literal("false", 5);
+      expect_literal("false", 5, core::TapeNodeType::BooleanFalse);
     else if (c == 'n')
-      expect_literal("null", 4);
+      expect_literal("null", 4, core::TapeNodeType::Null);
+    else if (Policy::nan_inf &&
+             (c == 'N' || c == 'I' ||
+              (c == '-' && end - p >= 2 && p[1] == 'I')))
+      parse_nan_inf();
     else if (c == '-' || (c >= '0' && c <= '9'))
       parse_number();
     else
@@ -5632,21 +10570,503 @@ struct Validator {
   }
 };
 
+// ── Phase 102: block validator ─────────────────────────────────
+// rfc8259::validate() first runs this one: the input is classified 64
+// bytes at a time (quotes, backslashes, control characters, whitespace,
+// structural characters), string interiors come from the quote mask as
+// in Stage 1, and a control character inside a string fails the whole
+// block at once. What is left for the grammar is one token per structural
+// character, string and number / literal, taken from the block's bits.
+// Whitespace is never visited. It only answers valid / not valid: on any
+// failure the scalar Validator runs to report the first violation with
+// its exact message and offset.
+
+// Bit i: byte i of a 64-byte block.
+struct BlockClass {
+  uint64_t quote, bs, ctl, ws, op, digit; // op: { } [ ] : ,
+};
+
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX512 BlockClass classify_avx512_(const char *p) noexcept {
+  const __m512i v = _mm512_loadu_si512(p);
+  // '[' and ']' differ from '{' and '}' only in bit 5.
+  const __m512i v20 = _mm512_or_si512(v, _mm512_set1_epi8(0x20));
+  return {_mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('"')),
+          _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\\')),
+          _mm512_cmplt_epu8_mask(v, _mm512_set1_epi8(0x20)),
+          _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(' ')) |
+              _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\n')) |
+              _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\t')) |
+              _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8('\r')),
+          _mm512_cmpeq_epi8_mask(v20, _mm512_set1_epi8('{')) |
+              _mm512_cmpeq_epi8_mask(v20, _mm512_set1_epi8('}')) |
+              _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(':')) |
+              _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(',')),
+          _mm512_cmplt_epu8_mask(_mm512_sub_epi8(v, _mm512_set1_epi8('0')),
+                                 _mm512_set1_epi8(10))};
+}
+#endif
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX2 uint64_t movemask_avx2_(__m256i lo, __m256i hi) noexcept {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(lo)) |
+         uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(hi))} << 32;
+}
+
+BEAST_TARGET_AVX2 BlockClass classify_avx2_(const char *p) noexcept {
+  __m256i v[2], cls[6][2];
+  for (int h = 0; h < 2; ++h) {
+    v[h] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32 * h));
+    const __m256i v20 = _mm256_or_si256(v[h], _mm256_set1_epi8(0x20));
+    cls[0][h] = _mm256_cmpeq_epi8(v[h], _mm256_set1_epi8('"'));
+    cls[1][h] = _mm256_cmpeq_epi8(v[h], _mm256_set1_epi8('\\'));
+    cls[2][h] = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(v[h], _mm256_set1_epi8(0x1F)), v[h]); // <= 0x1F
+    cls[3][h] = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v[h], _mm256_set1_epi8(' ')),
+                        _mm256_cmpeq_epi8(v[h], _mm256_set1_epi8('\n'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v[h], _mm256_set1_epi8('\t')),
+                        _mm256_cmpeq_epi8(v[h], _mm256_set1_epi8('\r'))));
+    cls[4][h] = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v20, _mm256_set1_epi8('{')),
+                        _mm256_cmpeq_epi8(v20, _mm256_set1_epi8('}'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v[h], _mm256_set1_epi8(':')),
+                        _mm256_cmpeq_epi8(v[h], _mm256_set1_epi8(','))));
+    const __m256i d = _mm256_sub_epi8(v[h], _mm256_set1_epi8('0'));
+    cls[5][h] = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+  }
+  return {movemask_avx2_(cls[0][0], cls[0][1]),
+          movemask_avx2_(cls[1][0], cls[1][1]),
+          movemask_avx2_(cls[2][0], cls[2][1]),
+          movemask_avx2_(cls[3][0], cls[3][1]),
+          movemask_avx2_(cls[4][0], cls[4][1]),
+          movemask_avx2_(cls[5][0], cls[5][1])};
+}
+#endif
+
+#if BEAST_HAS_NEON
+inline BlockClass classify_neon_(const char *p) noexcept {
+  BlockClass m{};
+  for (int i = 0; i < 4; ++i) {
+    const uint8x16_t v =
+        vld1q_u8(reinterpret_cast<const uint8_t *>(p) + 16 * i);
+    const uint8x16_t v20 = vorrq_u8(v, vdupq_n_u8(0x20));
+    const int s = 16 * i;
+    m.quote |= uint64_t{json::lazy::neon_movemask(vceqq_u8(v, vdupq_n_u8('"')))}
+               << s;
+    m.bs |= uint64_t{json::lazy::neon_movemask(vceqq_u8(v, vdupq_n_u8('\\')))}
+            << s;
+    m.ctl |= uint64_t{json::lazy::neon_movemask(vcltq_u8(v, vdupq_n_u8(0x20)))}
+             << s;
+    m.ws |= uint64_t{json::lazy::neon_movemask(vorrq_u8(
+                vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')),
+                         vceqq_u8(v, vdupq_n_u8('\n'))),
+                vorrq_u8(vceqq_u8(v, vdupq_n_u8('\t')),
+                         vceqq_u8(v, vdupq_n_u8('\r')))))}
+            << s;
+    m.op |= uint64_t{json::lazy::neon_movemask(vorrq_u8(
+                vorrq_u8(vceqq_u8(v20, vdupq_n_u8('{')),
+                         vceqq_u8(v20, vdupq_n_u8('}'))),
+                vorrq_u8(vceqq_u8(v, vdupq_n_u8(':')),
+                         vceqq_u8(v, vdupq_n_u8(',')))))}
+            << s;
+    m.digit |= uint64_t{json::lazy::neon_movemask(vcltq_u8(
+                   vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(10)))}
+               << s;
+  }
+  return m;
+}
+#endif
+
+// Bytes that may follow a number or literal: whitespace, structural
+// characters and '"' (which the grammar then rejects, with the others).
+inline constexpr auto kScalarDelim = []() consteval {
+  std::array<bool, 256> t{};
+  for (unsigned char c : {' ', '\t', '\n', '\r', '{', '}', '[', ']', ':', ',',
+                          '"'})
+    t[c] = true;
+  return t;
+}();
+
+// Validator::parse_number()'s grammar without the messages: the end of
+// the number at p, or nullptr.
+inline const char *number_end_(const char *p, const char *end) noexcept {
+  if (*p == '-' && ++p == end)
+    return nullptr;
+  if (*p == '0')
+    ++p; // a digit after it fails the caller's delimiter check
+  else if (static_cast<unsigned>(*p - '1') < 9u)
+    p = digits_end_(p + 1, end);
+  else
+    return nullptr;
+  if (p < end && *p == '.') {
+    if (++p == end || static_cast<unsigned>(*p - '0') >= 10u)
+      return nullptr;
+    p = digits_end_(p + 1, end);
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    if (++p < end && (*p == '+' || *p == '-'))
+      ++p;
+    if (p == end || static_cast<unsigned>(*p - '0') >= 10u)
+      return nullptr;
+    p = digits_end_(p + 1, end);
+  }
+  return p;
+}
+
+// Token classes and grammar states of the block validator. A state that
+// expects a value also says what follows it (kDoc: nothing, kArr*: ','
+// or ']', kObjValue: ',' or '}'), so the value's successor and the
+// state an open bracket returns to come from kAfter, not from a stack
+// of container kinds.
+enum : uint8_t {
+  kTokBad, kTokQuote, kTokComma, kTokColon, kTokOpenObj, kTokOpenArr,
+  kTokCloseObj, kTokCloseArr, kTokScalar, kTokCount
+};
+enum : uint8_t {
+  kStDoc,      // before the root value
+  kStArrFirst, // after '[': a value or ']'
+  kStArrNext,  // after ',' in an array
+  kStObjValue, // after ':'
+  kStObjFirst, // after '{': a key or '}'
+  kStObjKey,   // after ',' in an object
+  kStObjColon, // after a key
+  kStAfterArr, // after an array element
+  kStAfterObj, // after an object member
+  kStDone,     // after the root value: only whitespace
+  kStCount
+};
+// kStep results above the states: push kAfter[state] and enter the low
+// bits, pop into the saved state, or check the number / literal first.
+inline constexpr uint8_t kStepPush = 0x10, kStepPop = 0x20,
+                         kStepScalar = 0x40, kStepBad = 0xFF;
+
+inline constexpr auto kTokClass = []() consteval {
+  std::array<uint8_t, 256> t{};
+  t['"'] = kTokQuote;
+  t[','] = kTokComma;
+  t[':'] = kTokColon;
+  t['{'] = kTokOpenObj;
+  t['['] = kTokOpenArr;
+  t['}'] = kTokCloseObj;
+  t[']'] = kTokCloseArr;
+  for (unsigned char c : {'-', 't', 'f', 'n'})
+    t[c] = kTokScalar;
+  for (unsigned char c = '0'; c <= '9'; ++c)
+    t[c] = kTokScalar;
+  return t;
+}();
+
+inline constexpr uint8_t kAfter[kStCount] = {
+    kStDone, kStAfterArr, kStAfterArr, kStAfterObj};
+
+inline constexpr auto kStep = []() consteval {
+  std::array<std::array<uint8_t, kTokCount>, kStCount> t{};
+  for (auto &row : t)
+    row.fill(kStepBad);
+  for (uint8_t s = kStDoc; s <= kStObjValue; ++s) {
+    t[s][kTokQuote] = kAfter[s];
+    t[s][kTokScalar] = kStepScalar | kAfter[s];
+    t[s][kTokOpenObj] = kStepPush | kStObjFirst;
+    t[s][kTokOpenArr] = kStepPush | kStArrFirst;
+  }
+  t[kStArrFirst][kTokCloseArr] = kStepPop;
+  t[kStObjFirst][kTokQuote] = kStObjColon;
+  t[kStObjFirst][kTokCloseObj] = kStepPop;
+  t[kStObjKey][kTokQuote] = kStObjColon;
+  t[kStObjColon][kTokColon] = kStObjValue;
+  t[kStAfterArr][kTokComma] = kStArrNext;
+  t[kStAfterArr][kTokCloseArr] = kStepPop;
+  t[kStAfterObj][kTokComma] = kStObjKey;
+  t[kStAfterObj][kTokCloseObj] = kStepPop;
+  return t;
+}();
+
+struct BlockValidator {
+  // Deeper input is left to the scalar Validator.
+  static constexpr uint32_t kMaxDepth = 1024;
+
+  const char *end;
+  uint64_t prev_in_string = 0; // all-1: the block starts inside a string
+  bool prev_escaped = false;   // its first byte is backslash-escaped
+  uint64_t prev_scalar = 0;    // bit 0: ... and continues a number / literal
+  uint8_t state = kStDoc;
+  uint32_t depth = 0;
+  uint8_t saved[kMaxDepth]; // the state each open container returns to
+
+  // Bytes escaped by a backslash (the algorithm of the Stage 1 kernels).
+  BEAST_INLINE uint64_t escaped_bits(uint64_t bs) noexcept {
+    uint64_t escaped = 0;
+    if (prev_escaped) {
+      escaped = 1;
+      bs &= ~uint64_t{1};
+      prev_escaped = false;
+    }
+    while (bs) {
+      const int start = BEAST_CTZ(bs);
+      const uint64_t rest = ~bs & (~uint64_t{0} << start);
+      const int run_end = rest ? BEAST_CTZ(rest) : 64;
+      for (int j = start + 1; j < run_end; j += 2)
+        escaped |= uint64_t{1} << j;
+      if ((run_end - start) & 1) {
+        if (run_end < 64)
+          escaped |= uint64_t{1} << run_end;
+        else
+          prev_escaped = true;
+      }
+      if (run_end == 64)
+        break;
+      bs &= ~uint64_t{0} << run_end;
+    }
+    return escaped;
+  }
+
+  // `q` is an escaped byte: one of " \ / b f n r t, or u and 4 hex digits.
+  BEAST_INLINE bool escape_ok(const char *q) const noexcept {
+    switch (*q) {
+    case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r':
+    case 't':
+      return true;
+    case 'u':
+      if (end - q < 5)
+        return false;
+      for (int i = 1; i <= 4; ++i) {
+        const unsigned char h = static_cast<unsigned char>(q[i]);
+        if (static_cast<unsigned>(h - '0') >= 10u &&
+            static_cast<unsigned>((h | 0x20) - 'a') >= 6u)
+          return false;
+      }
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // The number or literal at bit i of the block at b: `run` bytes of
+  // neither whitespace, structure nor string, ending inside the block.
+  // Digit runs are measured on the block's digit bits.
+  BEAST_INLINE static bool scalar_run_ok(const char *b, int i, int run,
+                                         uint64_t digit) noexcept {
+    const char *t = b + i;
+    if (*t == 't' || *t == 'n')
+      return run == 4 && std::memcmp(t, *t == 't' ? "true" : "null", 4) == 0;
+    if (*t == 'f')
+      return run == 5 && std::memcmp(t, "false", 5) == 0;
+    int k = i + (*t == '-');
+    int n = BEAST_CTZ(~digit >> k); // nonzero: bit i + run is no digit
+    if (n == 0 || (b[k] == '0' && n > 1))
+      return false;
+    k += n;
+    if (b[k] == '.') {
+      n = BEAST_CTZ(~digit >> ++k);
+      if (n == 0)
+        return false;
+      k += n;
+    }
+    if ((b[k] | 0x20) == 'e') {
+      k += b[k + 1] == '+' || b[k + 1] == '-' ? 2 : 1;
+      n = BEAST_CTZ(~digit >> k);
+      if (n == 0)
+        return false;
+      k += n;
+    }
+    return k == i + run;
+  }
+
+  // The number or literal at t, up to a delimiter or the end.
+  BEAST_INLINE bool scalar_ok(const char *t) const noexcept {
+    const char *e;
+    if (*t == 't')
+      e = end - t >= 4 && std::memcmp(t, "true", 4) == 0 ? t + 4 : nullptr;
+    else if (*t == 'f')
+      e = end - t >= 5 && std::memcmp(t, "false", 5) == 0 ? t + 5 : nullptr;
+    else if (*t == 'n')
+      e = end - t >= 4 && std::memcmp(t, "null", 4) == 0 ? t + 4 : nullptr;
+    else
+      e = number_end_(t, end);
+    return e && (e == end || kScalarDelim[static_cast<unsigned char>(*e)]);
+  }
+
+  BEAST_INLINE bool token(const char *b, int i, uint64_t scalar,
+                          uint64_t digit) noexcept {
+    const char *t = b + i;
+    uint8_t next = kStep[state][kTokClass[static_cast<unsigned char>(*t)]];
+    if (next >= kStCount) {
+      if (next == kStepBad)
+        return false;
+      if (next & kStepPush) {
+        if (depth == kMaxDepth)
+          return false;
+        saved[depth++] = kAfter[state];
+      } else if (next & kStepPop) {
+        next = saved[--depth];
+      } else {
+        // Runs reaching the block's or the input's end take the slow way.
+        const uint64_t stop = ~scalar >> i;
+        const int run = stop ? BEAST_CTZ(stop) : 64;
+        if (run < 64 - i && t + run < end
+                ? !scalar_run_ok(b, i, run, digit)
+                : !scalar_ok(t))
+          return false;
+      }
+    }
+    state = next & 0x0F;
+    return true;
+  }
+
+  // One block at p; `valid` masks the bytes of a short last block.
+  BEAST_INLINE bool block(const char *p, const BlockClass &m,
+                          uint64_t valid) noexcept {
+    const uint64_t escaped = m.bs | prev_escaped ? escaped_bits(m.bs) : 0;
+    const uint64_t quotes = m.quote & ~escaped;
+    const uint64_t in_string = json::simd::prefix_xor(quotes) ^ prev_in_string;
+    if (m.ctl & in_string & valid)
+      return false; // unescaped control character
+    for (uint64_t e = escaped & valid; e; e &= e - 1)
+      if (!escape_ok(p + BEAST_CTZ(e)))
+        return false;
+    const uint64_t outside = ~(in_string | quotes) & valid;
+    const uint64_t scalar = outside & ~m.ws & ~m.op;
+    uint64_t tokens = (m.op & outside) | (quotes & in_string) |
+                      (scalar & ~(scalar << 1 | prev_scalar));
+    prev_scalar = scalar >> 63;
+    prev_in_string =
+        static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    for (; tokens; tokens &= tokens - 1)
+      if (!token(p, BEAST_CTZ(tokens), scalar, m.digit))
+        return false;
+    return true;
+  }
+
+  bool finish() const noexcept { return state == kStDone && !prev_in_string; }
+};
+
+// The per-ISA drivers: whole blocks, then the rest padded with spaces.
+#if BEAST_HAS_AVX512 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX512 bool blocks_accept_avx512_(const char *src,
+                                               size_t len) noexcept {
+  BlockValidator v;
+  v.end = src + len;
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    if (!v.block(src + i, classify_avx512_(src + i), ~uint64_t{0}))
+      return false;
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  return v.block(src + i, classify_avx512_(buf),
+                 (uint64_t{1} << (len - i)) - 1) &&
+         v.finish();
+}
+#endif
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+BEAST_TARGET_AVX2 bool blocks_accept_avx2_(const char *src,
+                                           size_t len) noexcept {
+  BlockValidator v;
+  v.end = src + len;
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    if (!v.block(src + i, classify_avx2_(src + i), ~uint64_t{0}))
+      return false;
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  return v.block(src + i, classify_avx2_(buf),
+                 (uint64_t{1} << (len - i)) - 1) &&
+         v.finish();
+}
+#endif
+
+#if BEAST_HAS_NEON
+inline bool blocks_accept_neon_(const char *src, size_t len) noexcept {
+  BlockValidator v;
+  v.end = src + len;
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    if (!v.block(src + i, classify_neon_(src + i), ~uint64_t{0}))
+      return false;
+  alignas(64) char buf[64];
+  std::memset(buf, ' ', 64);
+  std::memcpy(buf, src + i, len - i);
+  return v.block(src + i, classify_neon_(buf),
+                 (uint64_t{1} << (len - i)) - 1) &&
+         v.finish();
+}
+#endif
+
+#if BEAST_JSON_RUNTIME_DISPATCH
+using BlocksFn = bool (*)(const char *, size_t) noexcept;
+
+inline BlocksFn blocks_accept_select_() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return &blocks_accept_avx512_;
+  if (__builtin_cpu_supports("avx2"))
+    return &blocks_accept_avx2_;
+  return nullptr;
+}
+#endif
+
+// True: json is valid RFC 8259. False: invalid, or no vector unit to
+// check with — either way the scalar Validator decides.
+inline bool blocks_accept_(const char *src, size_t len) noexcept {
+#if BEAST_HAS_AVX512
+  return blocks_accept_avx512_(src, len);
+#elif BEAST_HAS_AVX2
+  return blocks_accept_avx2_(src, len);
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  static const BlocksFn fn = blocks_accept_select_();
+  return fn && fn(src, len);
+#elif BEAST_HAS_NEON
+  return blocks_accept_neon_(src, len);
+#else
+  (void)src;
+  (void)len;
+  return false;
+#endif
+}
+
 } // namespace detail_
 
 /// Validate \p json against RFC 8259.
 /// Throws std::runtime_error with offset information on the first violation.
-inline void validate(std::string_view json) { detail_::Validator{}.run(json); }
+inline void validate(std::string_view json) {
+  // Phase 102: valid input is accepted by the block validator alone.
+  if (!detail_::blocks_accept_(json.data(), json.size()))
+    detail_::Validator<false>{}.run(json);
+}
 
 } // namespace rfc8259
 
+/// Parse \p json into \p doc under a compile-time policy: comments,
+/// trailing commas, duplicate keys, NaN / Infinity and nesting depth (see
+/// beast::policy). Each policy instantiates its own grammar loop.
+/// parse<policy::Strict>() is parse_strict(); the lenient parser is
+/// parse(), which takes no policy.
+/// Throws std::runtime_error describing the violation and its byte offset.
+template <ParsePolicy Policy>
+inline Value parse(Document &doc, std::string_view json) {
+  beast::json::lazy::prepare_parse_(doc, json);
+  doc.tape.reserve(json.size() / 8 + 64);
+  core::Parser out(&doc);
+  rfc8259::detail_::Validator<true, Policy> v{};
+  v.out = &out;
+  v.run(json);
+  out.strict_finish_();
+  // After the grammar, so a document failing both reports the RFC error.
+  beast::json::lazy::check_utf8_(doc, json);
+  return beast::json::lazy::finish_parse_(doc);
+}
+
 /// Parse \p json into \p doc with strict RFC 8259 compliance.
 /// Rejects: trailing commas, leading zeros, invalid escapes,
 ///          unescaped control characters, trailing content, etc.
 /// Throws std::runtime_error describing the violation and its byte offset.
+/// One pass (Phase 101): the validator builds the tape as it accepts each
+/// token; the errors are exactly rfc8259::validate()'s.
 inline Value parse_strict(Document &doc, std::string_view json) {
-  rfc8259::validate(json);
-  return beast::json::lazy::parse_reuse(doc, json);
+  return parse<policy::Strict>(doc, json);
 }
 
 // ============================================================================
@@ -5731,6 +11151,11 @@ concept JsonDetailMap =
     } && (std::is_same_v<typename T::key_type, std::string> ||
           std::is_convertible_v<std::string, typename T::key_type>);
 
+// Reservable: vector, string-keyed unordered_map/set — pre-sized from the
+// tape's element count before filling
+template <typename T>
+concept JsonDetailReservable = requires(T &t, size_t n) { t.reserve(n); };
+
 // Fixed array: std::array<T,N> — tuple_size + value_type, no push_back
 template <typename T>
 concept JsonDetailFixedArr = requires {
@@ -5766,6 +11191,7 @@ template <typename T> void append_json(std::string &out, const T &in);
 
 template <typename Tup> void from_json_tuple_(const Value &v, Tup &out) {
   std::vector<Value> elems;
+  elems.reserve(v.size());
   for (const auto &e : v.elements())
     elems.push_back(e);
   std::apply(
@@ -5818,7 +11244,7 @@ template <typename T> void from_json(const Value &v, T &out) {
   } else if constexpr (JsonDetailArith<T>) {
     out = v.as<T>();
   } else if constexpr (std::is_same_v<T, std::string>) {
-    out = v.as<std::string>();
+    out = v.as_unescaped(); // Phase 99: "a\\nb" reads as a, newline, b
   } else if constexpr (JsonDetailOptional<T>) {
     if (!v.is_valid() || v.is_null()) {
       out = std::nullopt;
@@ -5829,6 +11255,8 @@ template <typename T> void from_json(const Value &v, T &out) {
     out = std::move(inner);
   } else if constexpr (JsonDetailSeq<T>) {
     out.clear();
+    if constexpr (JsonDetailReservable<T>)
+      out.reserve(v.size()); // Phase 83: O(1) count from the tape
     for (const auto &elem : v.elements()) {
       typename T::value_type item{};
       from_json(elem, item);
@@ -5836,6 +11264,8 @@ template <typename T> void from_json(const Value &v, T &out) {
     }
   } else if constexpr (JsonDetailSet<T>) {
     out.clear();
+    if constexpr (JsonDetailReservable<T>)
+      out.reserve(v.size());
     for (const auto &elem : v.elements()) {
       typename T::value_type item{};
       from_json(elem, item);
@@ -5843,6 +11273,8 @@ template <typename T> void from_json(const Value &v, T &out) {
     }
   } else if constexpr (JsonDetailMap<T>) {
     out.clear();
+    if constexpr (JsonDetailReservable<T>)
+      out.reserve(v.size());
     for (const auto &[k, val] : v.items()) {
       typename T::mapped_type item{};
       from_json(val, item);
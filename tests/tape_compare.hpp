@@ -0,0 +1,46 @@
+// Helpers shared by the tests that check one parse path against another:
+// node-for-node tape equality and a generated record document.
+#pragma once
+
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Same tape node for node, offsets included, and the same Phase 84 long
+// lengths. `what` tags every failure message; meta bits in `ignore_meta`
+// (e.g. TapeNode::kDecodedFlag) may differ between the two tapes.
+inline void expect_same_tapes(const beast::json::lazy::DocumentView &a,
+                              const beast::json::lazy::DocumentView &b,
+                              std::string_view what = {},
+                              uint32_t ignore_meta = 0) {
+  ASSERT_EQ(a.tape.size(), b.tape.size()) << what;
+  for (size_t i = 0; i < a.tape.size(); ++i) {
+    ASSERT_EQ(a.tape[i].meta & ~ignore_meta, b.tape[i].meta & ~ignore_meta)
+        << "node " << i << ": " << what;
+    ASSERT_EQ(a.tape[i].offset, b.tape[i].offset)
+        << "node " << i << ": " << what;
+  }
+  ASSERT_EQ(a.long_lens_, b.long_lens_) << what;
+}
+
+// n records separated by ",\n  ", with escaped quotes and backslashes,
+// brackets inside strings, nested containers and a 64-bit integer.
+inline std::string record_list(int n) {
+  std::string j;
+  for (int i = 0; i < n; ++i)
+    j += (i ? ",\n  " : "") + std::string(R"({"id":)") + std::to_string(i) +
+         R"(,"name":"item \"q\" \\{)" + std::to_string(i * 31) +
+         R"(}","nested":{"deep":[[1,{"x":"]"}],[]],"k":"v"},"price":)" +
+         std::to_string(i * 1.25) + R"(,"ok":)" + (i % 2 ? "true" : "false") +
+         R"(,"n":null,"neg":-12345678901})";
+  return j;
+}
+
+// {"meta":{"count":n,...},"items":[record_list(n)],"done":true}
+inline std::string records(int n) {
+  return "{\"meta\":{\"count\":" + std::to_string(n) +
+         ",\"tags\":[\"a\",\"[b]\"]},\"items\":[" + record_list(n) +
+         "],\"done\":true}";
+}
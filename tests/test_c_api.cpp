@@ -0,0 +1,25 @@
+// The C binding is compiled in, so the test can see the handle's Document.
+#include "../bindings/c/beast_json_c.cpp"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(CApi, IndexLoopOverLargeArray) {
+  std::string json = "[";
+  for (int i = 0; i < 20000; ++i)
+    json += (i ? "," : "") + std::to_string(i);
+  json += "]";
+
+  BJSONDocument *doc = bjson_doc_create();
+  ASSERT_NE(doc, nullptr);
+  BJSONValue *root = bjson_parse(doc, json.data(), json.size());
+  ASSERT_NE(root, nullptr);
+  const size_t n = bjson_size(root);
+  ASSERT_EQ(n, 20000u);
+  for (size_t i = 0; i < n; ++i)
+    ASSERT_EQ(bjson_as_int(bjson_get_idx(doc, root, i)),
+              static_cast<int64_t>(i));
+  // The loop went through the element table, not a walk per index.
+  EXPECT_EQ(doc->doc.elem_index_.size(), 1u);
+  EXPECT_FALSE(bjson_is_valid(bjson_get_idx(doc, root, n)));
+  bjson_doc_destroy(doc);
+}
@@ -0,0 +1,213 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+// Same entries and carry as the SIMD kernel, window by window.
+static void expect_scalar_kernel_matches(std::string_view json,
+                                         size_t window) {
+  const Stage1Fn simd = stage1_kernel();
+  if (!simd)
+    GTEST_SKIP() << "no Stage 1 kernel on this CPU";
+  Stage1Carry ca, cb;
+  for (size_t off = 0; off < json.size(); off += window) {
+    const size_t n = std::min(window, json.size() - off);
+    Stage1Index a, b;
+    ca = simd(json.data() + off, n, a, static_cast<tape_off_t>(off), ca);
+    cb = stage1_scan_scalar(json.data() + off, n, b,
+                            static_cast<tape_off_t>(off), cb);
+    ASSERT_EQ(a.count, b.count) << off;
+    for (uint32_t i = 0; i < a.count; ++i)
+      ASSERT_EQ(a.positions[i], b.positions[i]) << i;
+    if (n % 64 == 0) {
+      EXPECT_EQ(ca.in_string, cb.in_string);
+      EXPECT_EQ(ca.escaped, cb.escaped);
+      EXPECT_EQ(ca.prev_ws_like >> 63, cb.prev_ws_like >> 63);
+    }
+  }
+}
+
+TEST(Cursor, FieldsInDocumentOrder) {
+  const std::string j =
+      R"({"id":42,"user":{"name":"beast","followers":1024,"verified":true},)"
+      R"("text":"hi \"there\"","score":-2.5e-3,"none":null,"last":"end"})";
+  beast::Cursor cur;
+  auto root = cur.iterate(j);
+  ASSERT_TRUE(root.is_object());
+  EXPECT_EQ(root["id"].as<int>(), 42);
+  auto user = root["user"];
+  EXPECT_EQ(user["name"].as<std::string_view>(), "beast");
+  EXPECT_TRUE(user["verified"].as<bool>()); // skips "followers"
+  EXPECT_EQ(root["text"].as<std::string_view>(), R"(hi \"there\")");
+  EXPECT_DOUBLE_EQ(root["score"].as<double>(), -2.5e-3);
+  EXPECT_TRUE(root["none"].is_null());
+  EXPECT_EQ(root["last"].as<std::string>(), "end");
+}
+
+TEST(Cursor, ForwardOnly) {
+  const std::string j = R"({"a":1,"b":{"c":2,"d":3},"e":[4,5],"f":6})";
+  beast::Cursor cur;
+  auto root = cur.iterate(j);
+  auto b = root["b"];
+  EXPECT_EQ(b["d"].as<int>(), 3);
+  auto e = root["e"]; // leaves b
+  EXPECT_FALSE(b["d"]);
+  EXPECT_FALSE(b["c"]);
+  EXPECT_EQ(root["f"].as<int>(), 6); // skips e unread
+  for (auto x : e.elements())
+    ADD_FAILURE() << "spent array yielded " << x.as<int>();
+
+  auto root2 = cur.iterate(j);
+  EXPECT_EQ(root2["b"]["d"].as<int>(), 3);
+  EXPECT_FALSE(root2["a"]); // before the last key found: runs to the end
+  EXPECT_FALSE(root2["f"]);
+
+  auto root3 = cur.iterate(j);
+  auto a = root3["a"];
+  EXPECT_EQ(a.as<int>(), 1);
+  EXPECT_THROW(a.as<int>(), std::runtime_error); // consumed
+  EXPECT_THROW(root3["missing"].as<int>(), std::runtime_error);
+  EXPECT_THROW(beast::OnDemandValue{}.as<int>(), std::runtime_error);
+}
+
+TEST(Cursor, TypeMismatchDoesNotConsume) {
+  beast::Cursor cur;
+  auto root = cur.iterate(R"(["7", 8.5, true])");
+  auto it = root.elements().begin();
+  auto s = *it;
+  EXPECT_THROW(s.as<int>(), std::runtime_error);
+  EXPECT_EQ(s.as<std::string_view>(), "7");
+  ++it;
+  EXPECT_THROW((*it).as<int>(), std::runtime_error); // not an integer
+  ++it;
+  EXPECT_THROW((*it).as<double>(), std::runtime_error);
+  EXPECT_TRUE((*it).as<bool>());
+  ++it;
+  EXPECT_TRUE(it == root.elements().end());
+  EXPECT_FALSE(root["x"]); // not an object
+}
+
+TEST(Cursor, NarrowIntegersOutOfRange) {
+  beast::Cursor cur;
+  EXPECT_THROW(cur.iterate("4294967296").as<int>(), std::runtime_error);
+  EXPECT_THROW(cur.iterate("300").as<int8_t>(), std::runtime_error);
+  EXPECT_THROW(cur.iterate("-1").as<uint32_t>(), std::runtime_error);
+  EXPECT_EQ(cur.iterate("-2147483648").as<int>(), INT32_MIN);
+  EXPECT_EQ(cur.iterate("4294967296").as<uint64_t>(), 4294967296u);
+  auto root = cur.iterate("[70000, 7]");
+  auto it = root.elements().begin();
+  EXPECT_THROW((*it).as<uint16_t>(), std::runtime_error);
+  EXPECT_THROW((*it).as<int>(), std::runtime_error); // read, like "1x"
+  ++it;
+  EXPECT_EQ((*it).as<uint16_t>(), 7);
+}
+
+TEST(Cursor, MatchesParseOnRecords) {
+  // Past several Stage 1 windows, with brackets and quotes in strings.
+  const std::string j = records(500);
+  beast::Document doc;
+  auto ref = beast::parse(doc, j);
+  beast::Cursor cur;
+  for (int round = 0; round < 2; ++round) {
+    auto root = cur.iterate(j);
+    EXPECT_EQ(root["meta"]["count"].as<int>(), 500);
+    size_t i = 0;
+    for (auto item : root["items"].elements()) {
+      auto r = ref["items"][i];
+      EXPECT_EQ(item["id"].as<int64_t>(), r["id"].as<int64_t>());
+      if (i % 3 == 0) { // otherwise "name" is skipped
+        EXPECT_EQ(item["name"].as<std::string_view>(),
+                  r["name"].as<std::string_view>());
+      }
+      if (i % 5 == 0) {
+        auto deep = item["nested"]["deep"];
+        auto inner = deep.elements().begin();
+        size_t n = 0;
+        for (auto x : (*inner).elements())
+          n += x.is_number() ? 1 : 0; // the object is skipped
+        EXPECT_EQ(n, 1u);
+      }
+      EXPECT_EQ(item["price"].as<double>(), r["price"].as<double>());
+      EXPECT_EQ(item["neg"].as<int64_t>(), -12345678901);
+      ++i;
+    }
+    EXPECT_EQ(i, 500u);
+    EXPECT_TRUE(root["done"].as<bool>());
+  }
+}
+
+TEST(Cursor, LongStringsAcrossWindows) {
+  const std::string blob(40000, 'x');
+  const std::string j = "[\"" + blob + "\\\"\", {\"k\":\"" + blob +
+                        "\"}, \"tail\"]";
+  beast::Cursor cur;
+  auto root = cur.iterate(j);
+  std::vector<std::string_view> got;
+  for (auto v : root.elements())
+    if (v.is_string())
+      got.push_back(v.as<std::string_view>());
+  ASSERT_EQ(got.size(), 2u);
+  EXPECT_EQ(got[0].size(), blob.size() + 2);
+  EXPECT_EQ(got[1], "tail");
+}
+
+TEST(Cursor, ScalarRoots) {
+  beast::Cursor cur;
+  EXPECT_EQ(cur.iterate("  -17 ").as<int>(), -17);
+  EXPECT_EQ(cur.iterate("\"s\"").as<std::string_view>(), "s");
+  EXPECT_FALSE(cur.iterate("false").as<bool>());
+  EXPECT_TRUE(cur.iterate("null").is_null());
+  EXPECT_DOUBLE_EQ(cur.iterate("1e3").as<double>(), 1000.0);
+  EXPECT_THROW(cur.iterate(""), std::runtime_error);
+  EXPECT_THROW(cur.iterate(" \n "), std::runtime_error);
+  EXPECT_THROW(cur.iterate(",1"), std::runtime_error);
+}
+
+TEST(Cursor, MalformedOnThePath) {
+  beast::Cursor cur;
+  auto field = [&](const char *j, const char *key) {
+    return cur.iterate(j)[key];
+  };
+  EXPECT_THROW(field(R"({"a" 1,"b":2})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1 "b":2})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1,,"b":2})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1,})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({,"a":1})", "a"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1,2:3})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":[1,2})", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":"open)", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1)", "b"), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":tru})", "a").as<bool>(), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":-inf})", "a").as<double>(), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":1x})", "a").as<int>(), std::runtime_error);
+  EXPECT_THROW(field(R"({"a":})", "a").as<int>(), std::runtime_error);
+
+  auto sum = [&](const char *j) {
+    int s = 0;
+    for (auto v : cur.iterate(j).elements())
+      s += v.as<int>();
+    return s;
+  };
+  EXPECT_EQ(sum("[1, 2 ,3 ]"), 6);
+  EXPECT_EQ(sum("[]"), 0);
+  EXPECT_THROW(sum("[1,2,]"), std::runtime_error);
+  EXPECT_THROW(sum("[1 2]"), std::runtime_error);
+  EXPECT_THROW(sum("[1,2"), std::runtime_error);
+  EXPECT_THROW(sum("[1,2}"), std::runtime_error);
+  // Values skipped whole are only checked for balanced brackets.
+  EXPECT_EQ(cur.iterate(R"({"a":[1 2 {]},"b":5})")["b"].as<int>(), 5);
+}
+
+TEST(Cursor, ScalarKernelMatchesSimd) {
+  const std::string j = records(200);
+  for (size_t window : {64u, 128u, 4096u, 1u << 20})
+    expect_scalar_kernel_matches(j, window);
+  const std::string odd = "[\"a\\\\\",\"b\\\"c\", 1,\xC3\xA9 2, \\\"x\"" +
+                          std::string(130, '\\') + "\"]";
+  for (size_t window : {64u, 1u << 20})
+    expect_scalar_kernel_matches(odd, window);
+}
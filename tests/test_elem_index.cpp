@@ -0,0 +1,150 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace beast;
+
+// Builds [0,1,...,n-1]
+static std::string int_array(int n) {
+  std::string s = "[";
+  for (int i = 0; i < n; ++i) {
+    if (i)
+      s += ',';
+    s += std::to_string(i);
+  }
+  return s + "]";
+}
+
+// ── Lazy per-array element table (Phase 82) ───────────────────────────────────
+
+TEST(ElemIndex, NearIndicesStayLinear) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = int_array(100);
+  auto root = parse(doc, json);
+  for (size_t i = 0; i < 16; ++i)
+    EXPECT_EQ(root[i].as<int>(), static_cast<int>(i));
+  EXPECT_TRUE(doc.elem_index_.empty());
+}
+
+TEST(ElemIndex, FarIndexBuildsTable) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = int_array(1000);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[999].as<int>(), 999);
+  ASSERT_EQ(doc.elem_index_.size(), 1u);
+  for (size_t i = 0; i < 1000; ++i)
+    EXPECT_EQ(root[i].as<int>(), static_cast<int>(i));
+  EXPECT_FALSE(root[1000]);
+  EXPECT_EQ(root.size(), 1000u);
+}
+
+TEST(ElemIndex, SizeAfterEraseBuildsTable) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = R"({"small":[1,2],"big":)" + int_array(40) + "}";
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["big"].size(), 40u); // parse-time count: no table needed
+  EXPECT_TRUE(doc.elem_index_.empty());
+  root["small"].erase(size_t{0});
+  EXPECT_EQ(root["small"].size(), 1u);
+  EXPECT_TRUE(doc.elem_index_.empty());
+  root["big"].erase(size_t{0});
+  EXPECT_EQ(root["big"].size(), 39u); // counts by walking → builds table
+  EXPECT_EQ(doc.elem_index_.size(), 1u);
+  EXPECT_EQ(root["big"].size(), 39u);
+}
+
+TEST(ElemIndex, ShortArrayNotCached) {
+  Document doc;
+  doc.enable_elem_index();
+  auto root = parse(doc, "[1,2,3]");
+  EXPECT_FALSE(root[20]);
+  EXPECT_TRUE(doc.elem_index_.empty());
+}
+
+TEST(ElemIndex, NestedElements) {
+  Document doc;
+  doc.enable_elem_index();
+  std::string json = "[";
+  for (int i = 0; i < 50; ++i)
+    json += (i ? ",{\"v\":[" : "{\"v\":[") + std::to_string(i) + "]}";
+  json += "]";
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[49]["v"][0].as<int>(), 49);
+  EXPECT_EQ(root[17].dump(), R"({"v":[17]})");
+}
+
+TEST(ElemIndex, EraseInvalidatesTable) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = int_array(40);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[30].as<int>(), 30);
+  ASSERT_EQ(doc.elem_index_.size(), 1u);
+  root.erase(size_t{0});
+  EXPECT_EQ(root[30].as<int>(), 31);
+  EXPECT_EQ(root.size(), 39u);
+  root.erase(size_t{20}); // removes 21
+  EXPECT_EQ(root[20].as<int>(), 22);
+  EXPECT_EQ(root[37].as<int>(), 39);
+  EXPECT_FALSE(root[38]);
+}
+
+TEST(ElemIndex, PushBackCountedInSize) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = int_array(20);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[19].as<int>(), 19);
+  root.push_back(20);
+  EXPECT_EQ(root.size(), 21u);
+  EXPECT_EQ(root[19].as<int>(), 19);
+}
+
+TEST(ElemIndex, SafeGetMatchesSubscript) {
+  Document doc;
+  doc.enable_elem_index();
+  const std::string json = int_array(30);
+  auto root = parse(doc, json);
+  root.erase(size_t{0});
+  EXPECT_EQ(root.get(size_t{25}).value_or(-1), 26);
+  EXPECT_EQ(root.get(size_t{29}).value_or(-1), -1);
+}
+
+TEST(ElemIndex, InvalidatedByReparse) {
+  Document doc;
+  doc.enable_elem_index();
+  std::string first = int_array(50);
+  auto root = parse(doc, first);
+  EXPECT_EQ(root[40].as<int>(), 40);
+  EXPECT_EQ(doc.elem_index_.size(), 1u);
+  std::string second = R"([[7,8],9])";
+  root = parse(doc, second);
+  EXPECT_TRUE(doc.elem_index_.empty());
+  EXPECT_EQ(root[1].as<int>(), 9);
+}
+
+TEST(ElemIndex, Disable) {
+  Document doc;
+  doc.enable_elem_index();
+  doc.disable_elem_index();
+  const std::string json = int_array(100);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[99].as<int>(), 99);
+  EXPECT_EQ(root.size(), 100u);
+  EXPECT_TRUE(doc.elem_index_.empty());
+}
+
+TEST(ElemIndex, OffByDefault) {
+  // Const reads must not write the Document unless asked to.
+  Document doc;
+  const std::string json = int_array(100);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[99].as<int>(), 99);
+  root.erase(size_t{0});
+  EXPECT_EQ(root.size(), 99u);
+  EXPECT_EQ(root[97].as<int>(), 98);
+  EXPECT_TRUE(doc.elem_index_.empty());
+}
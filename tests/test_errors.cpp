@@ -1,9 +1,30 @@
 #include <beast_json/beast_json.hpp>
 #include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
 #include <string>
 
 using namespace beast;
 
+// Set to make the next allocation in this thread throw std::bad_alloc.
+// GCC pairs the inlined malloc/free below with new/delete and warns.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static thread_local bool fail_next_alloc = false;
+
+void *operator new(std::size_t n) {
+  if (fail_next_alloc) {
+    fail_next_alloc = false;
+    throw std::bad_alloc();
+  }
+  if (void *p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
 // Helper: attempt lazy parse, return true on success
 static bool lazy_ok(std::string_view j) {
   try {
@@ -53,3 +74,117 @@ TEST(ErrorHandling, UnbalancedDepth) {
   EXPECT_FALSE(lazy_ok("{\"a\":1"));
   EXPECT_FALSE(lazy_ok("{\"key\":\"value\""));
 }
+
+// ── Phase 103: exception-free API ──────────────────────────────────────────
+
+TEST(ErrorCodes, ParseSetsCode) {
+  Document doc;
+  Error ec = Error::TypeMismatch;
+  Value root = parse(doc, R"({"a":[1,2]})", ec);
+  EXPECT_EQ(ec, Error::None);
+  EXPECT_EQ(root["a"][1].as<int>(), 2);
+
+  for (const char *j : {"[", "{\"a\":1", "tru", "", "[1]]", "@"}) {
+    Value bad = parse(doc, j, ec);
+    EXPECT_EQ(ec, Error::InvalidJson) << j;
+    EXPECT_FALSE(bad.is_valid()) << j;
+    EXPECT_FALSE(lazy_ok(j)) << j; // the throwing parse() agrees
+  }
+  // The document stays reusable after a failure.
+  root = parse(doc, "[true]", ec);
+  EXPECT_EQ(ec, Error::None);
+  EXPECT_TRUE(root[0].as<bool>());
+
+  Document utf8;
+  utf8.enable_utf8_validation();
+  parse(utf8, "[\"\xC0\x80\"]", ec);
+  EXPECT_EQ(ec, Error::InvalidJson);
+  try {
+    parse(doc, "[1,");
+    FAIL() << "Expected runtime_error";
+  } catch (const std::runtime_error &e) {
+    EXPECT_STREQ(e.what(), error_message(Error::InvalidJson));
+  }
+}
+
+TEST(ErrorCodes, GetReportsWhy) {
+  Document doc;
+  Value root = parse(doc, R"({"i":42,"d":2.5,"s":"x","b":false,"big":1e999,)"
+                          R"("n":null,"huge":99999999999999999999})");
+  Result<int> i = root["i"].get<int>();
+  ASSERT_TRUE(i);
+  EXPECT_EQ(*i, 42);
+  EXPECT_EQ(root["d"].get<double>().value(), 2.5);
+  EXPECT_EQ(*root["s"].get<std::string_view>(), "x");
+  EXPECT_EQ(*root["s"].get<std::string>(), "x");
+  EXPECT_EQ(*root["b"].get<bool>(), false);
+
+  EXPECT_EQ(root["missing"].get<int>().error(), Error::MissingValue);
+  EXPECT_EQ(root["s"].get<int>().error(), Error::TypeMismatch);
+  EXPECT_EQ(root["n"].get<bool>().error(), Error::TypeMismatch);
+  EXPECT_EQ(root["i"].get<std::string>().error(), Error::TypeMismatch);
+  EXPECT_EQ(root["big"].get<double>().error(), Error::NumberError);
+  EXPECT_EQ(root["huge"].get<int64_t>().error(), Error::NumberError);
+  EXPECT_EQ(root["s"].get<int>().value_or(-1), -1);
+  EXPECT_THROW(root["s"].get<int>().value(), std::runtime_error);
+
+  // try_as<T>() and as<T>() agree with get<T>().
+  for (const char *k : {"i", "d", "s", "b", "big", "n", "huge", "missing"}) {
+    const Result<double> r = root[k].get<double>();
+    EXPECT_EQ(root[k].try_as<double>().has_value(), r.has_value()) << k;
+    if (r)
+      EXPECT_EQ(root[k].as<double>(), *r) << k;
+    else
+      EXPECT_THROW(root[k].as<double>(), std::runtime_error) << k;
+  }
+}
+
+TEST(ErrorCodes, NarrowIntegersOutOfRange) {
+  // An integer that does not fit T is an error, not a truncated value,
+  // whether read from the text or from a decoded number.
+  for (bool decode : {false, true}) {
+    Document doc;
+    if (decode)
+      doc.enable_number_decoding();
+    Value root = parse(doc, "[300,-129,127,-1,4294967296,-2147483648]");
+    EXPECT_EQ(root[0].get<int8_t>().error(), Error::NumberError) << decode;
+    EXPECT_EQ(root[1].get<int8_t>().error(), Error::NumberError);
+    EXPECT_EQ(*root[2].get<int8_t>(), 127);
+    EXPECT_EQ(root[3].get<uint32_t>().error(), Error::NumberError);
+    EXPECT_EQ(root[4].get<uint32_t>().error(), Error::NumberError);
+    EXPECT_EQ(*root[4].get<uint64_t>(), 4294967296u);
+    EXPECT_EQ(root[4].get<int>().error(), Error::NumberError);
+    EXPECT_EQ(*root[5].get<int>(), INT32_MIN);
+    EXPECT_FALSE(root[0].try_as<uint8_t>().has_value());
+    EXPECT_THROW(root[4].as<int>(), std::runtime_error);
+  }
+}
+
+TEST(ErrorCodes, GetSeesMutations) {
+  Document doc;
+  Value root = parse(doc, R"({"v":1})");
+  root["v"].set("text");
+  EXPECT_EQ(*root["v"].get<std::string_view>(), "text");
+  EXPECT_EQ(root["v"].get<int>().error(), Error::TypeMismatch);
+  root["v"].set(int64_t{7});
+  EXPECT_EQ(*root["v"].get<int>(), 7);
+  EXPECT_EQ(*root["v"].get<double>(), 7.0);
+  root["v"].set(true);
+  EXPECT_EQ(*root["v"].get<bool>(), true);
+}
+
+TEST(ErrorCodes, TryAsStringSurvivesAllocationFailure) {
+  // try_as<T>() never throws, std::string included: a failed copy is
+  // std::nullopt, where get<std::string>() lets std::bad_alloc through.
+  Document doc;
+  auto root = parse(doc, R"(["longer than the small-string buffer"])");
+  static_assert(noexcept(root[0].try_as<std::string>()));
+  fail_next_alloc = true;
+  EXPECT_FALSE(root[0].try_as<std::string>());
+  EXPECT_FALSE(fail_next_alloc);
+  EXPECT_EQ(root[0].try_as<std::string>().value_or(""),
+            "longer than the small-string buffer");
+  fail_next_alloc = true;
+  EXPECT_THROW(root[0].get<std::string>(), std::bad_alloc);
+  fail_next_alloc = false;
+}
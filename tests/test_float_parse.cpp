@@ -0,0 +1,161 @@
+#include <beast_json/beast_json.hpp>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace beast::json::lazy;
+
+static uint64_t bits_of(double d) {
+  uint64_t b;
+  std::memcpy(&b, &d, sizeof(b));
+  return b;
+}
+
+static double parse_all(std::string_view s) {
+  double v = -12345.0;
+  auto [ptr, ec] = parse_double(s.data(), s.data() + s.size(), v);
+  EXPECT_EQ(ec, std::errc{}) << s;
+  EXPECT_EQ(ptr, s.data() + s.size()) << s;
+  return v;
+}
+
+// Expected values are compiler literals: correctly rounded by the compiler.
+#define EXPECT_PARSES(lit)                                                     \
+  EXPECT_EQ(bits_of(parse_all(#lit)), bits_of(lit)) << #lit
+
+TEST(FloatParse, FastPathAndCommonForms) {
+  EXPECT_PARSES(0.0);
+  EXPECT_PARSES(1.5);
+  EXPECT_PARSES(-2.5e-3);
+  EXPECT_PARSES(1E+9);
+  EXPECT_PARSES(123456.789e3);
+  EXPECT_PARSES(-65.613616999999977);
+  EXPECT_PARSES(0.1);
+  EXPECT_PARSES(1e22);
+  EXPECT_PARSES(1e23);
+  EXPECT_PARSES(3e37); // 3 × 10^15 × 10^22, both exact
+  EXPECT_PARSES(9007199254740993e15);
+  EXPECT_PARSES(7.038531e-26);
+  EXPECT_EQ(bits_of(parse_all("-0")), bits_of(-0.0));
+  EXPECT_EQ(bits_of(parse_all("-0.0e10")), bits_of(-0.0));
+  EXPECT_EQ(parse_all("1."), 1.0);
+  EXPECT_EQ(parse_all(".5"), 0.5);
+  EXPECT_EQ(parse_all("-.5"), -0.5);
+}
+
+TEST(FloatParse, HardRoundingCases) {
+  EXPECT_PARSES(9007199254740993.0); // halfway: to even
+  EXPECT_PARSES(9007199254740993.0000000000000000000001);
+  EXPECT_PARSES(9007199254740995.0);
+  // 1 + 2^-53 exactly, and one digit either side of it.
+  EXPECT_PARSES(1.00000000000000011102230246251565404236316680908203125);
+  EXPECT_PARSES(1.00000000000000011102230246251565404236316680908203124);
+  EXPECT_PARSES(1.00000000000000011102230246251565404236316680908203126);
+  EXPECT_PARSES(2.2250738585072011e-308); // largest subnormal
+  EXPECT_PARSES(2.2250738585072012e-308); // smallest normal
+  EXPECT_PARSES(4.9406564584124654e-324);
+  EXPECT_PARSES(2.4703282292062328e-324); // rounds up to the smallest
+  EXPECT_PARSES(1.7976931348623157e308);
+  EXPECT_PARSES(0.1000000000000000055511151231257827021181583404541015625);
+  EXPECT_PARSES(123456789012345678901234567890.0);
+  EXPECT_PARSES(0.000000000000000000000000000000000000000000001e45);
+
+  // More digits than the big decimal keeps: the tail only breaks the tie.
+  std::string half = "1.00000000000000011102230246251565404236316680908203125";
+  EXPECT_EQ(parse_all(half + std::string(900, '0')), 1.0);
+  EXPECT_EQ(parse_all(half + std::string(900, '0') + "1"),
+            std::nextafter(1.0, 2.0));
+  EXPECT_EQ(parse_all("0." + std::string(400, '0') + "1e401"), 1.0);
+  EXPECT_EQ(parse_all(std::string(400, '9') + "e-400"), 1.0);
+}
+
+TEST(FloatParse, RangeErrorsLeaveValue) {
+  for (const char *s : {"1e309", "-1e400", "1.7976931348623159e308", "1e-400",
+                        "2.4703282292062327e-324", "-1e-99999999999"}) {
+    double v = 42.0;
+    auto [ptr, ec] = parse_double(s, s + std::strlen(s), v);
+    EXPECT_EQ(ec, std::errc::result_out_of_range) << s;
+    EXPECT_EQ(ptr, s + std::strlen(s)) << s;
+    EXPECT_EQ(v, 42.0) << s;
+  }
+  EXPECT_EQ(parse_all("0e99999999999"), 0.0);
+}
+
+TEST(FloatParse, GrammarAndStopPosition) {
+  struct Case {
+    const char *s;
+    size_t used; // 0: invalid_argument
+  };
+  for (const Case c : {Case{"1e", 1}, Case{"1e+", 1}, Case{"1ex", 1},
+                       Case{"2.5x", 3}, Case{"1.e5", 4}, Case{"12,3", 2},
+                       Case{"-", 0}, Case{".", 0}, Case{"e5", 0},
+                       Case{"+1", 0}, Case{"", 0}, Case{"-.e1", 0},
+                       Case{"inf", 3}, Case{"-Infinity", 9}, Case{"infx", 3},
+                       Case{"nan", 3}, Case{"NaN(x_1)", 8}, Case{"nan(", 3}}) {
+    const size_t n = std::strlen(c.s);
+    double v = 7.0;
+    auto [ptr, ec] = parse_double(c.s, c.s + n, v);
+    if (c.used == 0) {
+      EXPECT_EQ(ec, std::errc::invalid_argument) << c.s;
+      EXPECT_EQ(ptr, c.s) << c.s;
+      EXPECT_EQ(v, 7.0) << c.s;
+    } else {
+      EXPECT_EQ(ec, std::errc{}) << c.s;
+      EXPECT_EQ(ptr - c.s, static_cast<ptrdiff_t>(c.used)) << c.s;
+    }
+  }
+  double v = 0;
+  parse_double("-inf", "-inf" + 4, v);
+  EXPECT_TRUE(std::isinf(v) && v < 0);
+  parse_double("nan", "nan" + 3, v);
+  EXPECT_TRUE(std::isnan(v));
+}
+
+TEST(FloatParse, RandomDoublesRoundTrip) {
+  std::mt19937_64 rng(98);
+  char buf[64];
+  for (int i = 0; i < 200000; ++i) {
+    const uint64_t b = rng();
+    double d;
+    std::memcpy(&d, &b, sizeof(d));
+    if (!std::isfinite(d))
+      continue;
+    const int n = std::snprintf(buf, sizeof(buf), "%.17g", d);
+    ASSERT_EQ(bits_of(parse_all(std::string_view(buf, n))), b) << buf;
+#if __cpp_lib_to_chars >= 201611L && !defined(__APPLE__)
+    // Shorter, inexact forms: same rounding as the standard library.
+    const int m = std::snprintf(buf, sizeof(buf), "%.*e",
+                                static_cast<int>(rng() % 17), d);
+    double ref = 0;
+    std::from_chars(buf, buf + m, ref);
+    ASSERT_EQ(bits_of(parse_all(std::string_view(buf, m))), bits_of(ref))
+        << buf;
+#endif
+  }
+}
+
+TEST(FloatParse, ValueAndDecodingUseIt) {
+  const std::string j =
+      "[0.1,-2.2250738585072011e-308,1e23,9007199254740993,"
+      "1.00000000000000011102230246251565404236316680908203126,1e400]";
+  for (bool decode : {false, true}) {
+    beast::Document doc;
+    if (decode)
+      doc.enable_number_decoding();
+    auto root = beast::parse(doc, j);
+    EXPECT_EQ(root[0].as<double>(), 0.1);
+    EXPECT_EQ(root[1].as<double>(), -2.2250738585072011e-308);
+    EXPECT_EQ(root[2].as<double>(), 1e23);
+    EXPECT_EQ(root[3].as<double>(), 9007199254740992.0);
+    EXPECT_EQ(root[4].as<double>(), std::nextafter(1.0, 2.0));
+    EXPECT_THROW(root[5].as<double>(), std::runtime_error);
+  }
+  beast::Cursor cur;
+  auto first = cur.iterate(j).elements().begin();
+  EXPECT_EQ((*first).as<double>(), 0.1);
+}
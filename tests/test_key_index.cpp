@@ -0,0 +1,114 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace beast;
+
+// Builds {"k0":0,"k1":1,...,"k<n-1>":n-1}
+static std::string wide_object(int n) {
+  std::string s = "{";
+  for (int i = 0; i < n; ++i) {
+    if (i)
+      s += ',';
+    s += "\"k" + std::to_string(i) + "\":" + std::to_string(i);
+  }
+  return s + "}";
+}
+
+// ── Lazy per-object key index (Phase 81) ──────────────────────────────────────
+
+TEST(KeyIndex, DisabledByDefault) {
+  Document doc;
+  const std::string json = wide_object(100);
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["k99"].as<int>(), 99);
+  EXPECT_TRUE(doc.key_index_.empty());
+}
+
+TEST(KeyIndex, BuiltOnlyPastThreshold) {
+  Document doc;
+  doc.enable_key_index(16);
+  const std::string json = R"({"small":{"a":1,"b":2},"wide":)" +
+                           wide_object(64) + "}";
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["small"]["b"].as<int>(), 2);
+  EXPECT_TRUE(doc.key_index_.empty()); // 2 keys: linear scan only
+
+  auto wide = root["wide"];
+  EXPECT_EQ(wide["k63"].as<int>(), 63); // scans 64 keys → builds index
+  EXPECT_EQ(doc.key_index_.size(), 1u);
+  for (int i = 0; i < 64; ++i)
+    EXPECT_EQ(wide["k" + std::to_string(i)].as<int>(), i);
+  EXPECT_FALSE(wide["missing"]);
+  EXPECT_FALSE(wide.find("k64").has_value());
+}
+
+TEST(KeyIndex, MissBuildsIndex) {
+  Document doc;
+  doc.enable_key_index(8);
+  const std::string json = wide_object(32);
+  auto root = parse(doc, json);
+  EXPECT_FALSE(root.find("nope").has_value());
+  EXPECT_EQ(doc.key_index_.size(), 1u);
+  EXPECT_EQ(root.find("k31")->as<int>(), 31);
+}
+
+TEST(KeyIndex, DuplicateKeysResolveToFirst) {
+  Document doc;
+  doc.enable_key_index(1);
+  auto root = parse(doc, R"({"a":1,"b":2,"a":3})");
+  EXPECT_EQ(root["b"].as<int>(), 2); // builds the index
+  EXPECT_EQ(root["a"].as<int>(), 1);
+}
+
+TEST(KeyIndex, RespectsDeletedKeys) {
+  Document doc;
+  doc.enable_key_index(1);
+  auto root = parse(doc, R"({"a":1,"b":2,"a":3,"c":4})");
+  EXPECT_EQ(root["c"].as<int>(), 4); // builds the index
+  root.erase("b");
+  EXPECT_FALSE(root["b"]);
+  EXPECT_FALSE(root.find("b").has_value());
+  root.erase("a"); // first "a" only → duplicate becomes visible
+  EXPECT_EQ(root["a"].as<int>(), 3);
+  EXPECT_EQ(root["c"].as<int>(), 4);
+}
+
+TEST(KeyIndex, AdditionsUnaffected) {
+  Document doc;
+  doc.enable_key_index(1);
+  auto root = parse(doc, R"({"a":1,"b":2})");
+  EXPECT_EQ(root["a"].as<int>(), 1);
+  root.insert("z", 26);
+  EXPECT_EQ(root.size(), 3u);
+  EXPECT_EQ(root.dump(), R"({"a":1,"b":2,"z":26})");
+  EXPECT_EQ(root["b"].as<int>(), 2);
+}
+
+TEST(KeyIndex, InvalidatedByReparse) {
+  Document doc;
+  doc.enable_key_index(2);
+  std::string first = R"({"x":1,"y":2,"z":3})";
+  auto root = parse(doc, first);
+  EXPECT_EQ(root["z"].as<int>(), 3);
+  EXPECT_EQ(doc.key_index_.size(), 1u);
+
+  std::string second = R"({"z":30,"x":10})";
+  root = parse(doc, second);
+  EXPECT_EQ(doc.key_index_.size(), 0u);
+  EXPECT_EQ(root["z"].as<int>(), 30);
+  EXPECT_EQ(root["x"].as<int>(), 10);
+  EXPECT_FALSE(root["y"]);
+}
+
+TEST(KeyIndex, DisableFreesIndex) {
+  Document doc;
+  doc.enable_key_index(1);
+  auto root = parse(doc, R"({"a":{"b":1}})");
+  EXPECT_EQ(root["a"]["b"].as<int>(), 1);
+  EXPECT_EQ(doc.key_index_.size(), 2u);
+  doc.disable_key_index();
+  EXPECT_TRUE(doc.key_index_.empty());
+  EXPECT_EQ(root["a"]["b"].as<int>(), 1);
+  EXPECT_TRUE(doc.key_index_.empty());
+}
@@ -0,0 +1,176 @@
+#include <beast_json/beast_json.hpp>
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+static std::string numbers(int n) {
+  std::string j = R"({"edge":[0,-0,1,-1,9223372036854775807,)"
+                  R"(-9223372036854775808,9223372036854775808,)"
+                  R"(123456789012345678901234567890,-0.0,0.0,1.5,-2.5e-3,)"
+                  R"(1E+9,1e308,1e999,-1e-400,4.9e-324,)"
+                  R"(0.1000000000000000055511151231257827,)"
+                  R"(2.2250738585072011e-308,17976931348623157e292],)"
+                  "\"items\":[";
+  for (int i = 0; i < n; ++i)
+    j += (i ? "," : "") + std::string(R"({"id":)") + std::to_string(i * 7919) +
+         R"(,"x":)" + std::to_string(i * 0.37 - 50) + R"(,"y":-)" +
+         std::to_string(i) + "e-" + std::to_string(i % 30) + "}";
+  return j + "]}";
+}
+
+// as<T>() must return the same value or throw alike, decoded or not.
+template <typename T>
+static void expect_same_read(DocumentView &a, DocumentView &b, uint32_t i) {
+  const std::optional<T> va = Value(&a, i).try_as<T>();
+  const std::optional<T> vb = Value(&b, i).try_as<T>();
+  ASSERT_EQ(va.has_value(), vb.has_value()) << "node " << i;
+  if (!va)
+    return;
+  if constexpr (std::is_floating_point_v<T>)
+    ASSERT_EQ(std::memcmp(&*va, &*vb, sizeof(T)), 0)
+        << "node " << i << ": " << *va << " vs " << *vb;
+  else
+    ASSERT_EQ(*va, *vb) << "node " << i;
+}
+
+// `plain` parsed without decoding, `dec` with: same reads on every number,
+// and most numbers actually decoded.
+static void expect_same_numbers(DocumentView &plain, DocumentView &dec) {
+  expect_same_tapes(plain, dec, "decoded", TapeNode::kDecodedFlag);
+  if (::testing::Test::HasFatalFailure())
+    return;
+  size_t nums = 0, decoded = 0;
+  for (uint32_t i = 0; i < dec.tape.size(); ++i) {
+    const TapeNodeType t = dec.tape[i].type();
+    if (t != TapeNodeType::Integer && t != TapeNodeType::NumberRaw)
+      continue;
+    ++nums;
+    decoded += dec.tape[i].is_decoded();
+    expect_same_read<int64_t>(plain, dec, i);
+    expect_same_read<int>(plain, dec, i);
+    expect_same_read<double>(plain, dec, i);
+    expect_same_read<float>(plain, dec, i);
+  }
+  EXPECT_GT(nums, 0u);
+  EXPECT_GE(decoded + 8, nums); // the edge cases left on the text path
+}
+
+TEST(NumberDecode, ParseReuse) {
+  const std::string j = numbers(3000);
+  DocumentView plain, dec;
+  dec.enable_number_decoding();
+  parse_reuse(plain, j);
+  for (int round = 0; round < 2; ++round) { // reuse keeps numbers_
+    parse_reuse(dec, j);
+    expect_same_numbers(plain, dec);
+  }
+  EXPECT_EQ(Value(&dec, 0)["edge"][1].as<double>(), 0.0);
+  EXPECT_TRUE(std::signbit(Value(&dec, 0)["edge"][1].as<double>()));
+  EXPECT_EQ(Value(&dec, 0)["edge"][10].as<int>(), 1); // "1.5"
+  EXPECT_THROW(Value(&dec, 0)["edge"][6].as<int64_t>(), std::runtime_error);
+  EXPECT_THROW(Value(&dec, 0)["edge"][14].as<double>(), std::runtime_error);
+}
+
+TEST(NumberDecode, SinglePassAndPadded) {
+  const std::string j = numbers(500);
+  const PaddedString ps(j);
+  for (bool padded : {false, true}) {
+    DocumentView plain, dec;
+    dec.enable_number_decoding();
+    for (DocumentView *d : {&plain, &dec}) {
+      prepare_parse_(*d, ps.view());
+      d->tape.reserve(16); // grown by parse() as it goes
+      ASSERT_TRUE(padded ? Parser(d).parse<true>() : Parser(d).parse<false>());
+    }
+    expect_same_numbers(plain, dec);
+    DocumentView pp;
+    pp.enable_number_decoding();
+    parse_padded(pp, ps.view());
+    expect_same_numbers(plain, pp);
+  }
+}
+
+TEST(NumberDecode, ParseManyAndStream) {
+  std::string lines;
+  for (int i = 0; i < 400; ++i)
+    lines += std::to_string(i * -3) + "\n[" + std::to_string(i * 0.5) +
+             "]\n{\"n\":" + std::to_string(i) + "e2}\n";
+  std::string buf = lines;
+  buf.reserve(lines.size() + 64); // parse()'s SIMD skip may read past the end
+  DocumentView plain, dec, scalar;
+  dec.enable_number_decoding();
+  scalar.enable_number_decoding();
+  parse_many(plain, buf);
+  parse_many(dec, buf);
+  expect_same_numbers(plain, dec);
+  prepare_parse_(scalar, buf);
+  parse_many_scalar_(scalar);
+  expect_same_numbers(plain, scalar);
+
+  const std::string j = numbers(800);
+  DocumentView one, streamed;
+  parse_reuse(one, j);
+  streamed.enable_number_decoding();
+  StreamParser sp(streamed);
+  for (size_t i = 0; i < j.size(); i += 37) // numbers split across chunks
+    sp.feed(std::string_view(j).substr(i, 37));
+  sp.finish();
+  expect_same_numbers(one, streamed);
+}
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+TEST(NumberDecode, Parallel) {
+  std::string j = "[";
+  for (int i = 0; i < 2000; ++i)
+    j += (i ? "," : "") + std::to_string(i * 1000003) + ",[" +
+         std::to_string(i / 7.0) + "]";
+  j += "]";
+  DocumentView plain, dec;
+  parse_reuse(plain, j);
+  dec.enable_number_decoding();
+  for (unsigned threads : {2u, 4u, 7u}) {
+    parse_parallel(dec, j, threads, 64);
+    expect_same_numbers(plain, dec);
+  }
+}
+#endif
+
+TEST(NumberDecode, OptInAndMoves) {
+  const std::string j = "[1,2.5,-3]";
+  beast::Document doc;
+  auto root = beast::parse(doc, j);
+  EXPECT_FALSE(doc.tape[1].is_decoded());
+  doc.enable_number_decoding();
+  root = beast::parse(doc, j);
+  EXPECT_TRUE(doc.tape[1].is_decoded());
+  EXPECT_TRUE(doc.tape[2].is_decoded());
+  beast::Document moved(std::move(doc));
+  EXPECT_EQ(beast::Value(&moved, 0)[1].as<double>(), 2.5);
+  EXPECT_EQ(beast::Value(&moved, 0)[2].as<int>(), -3);
+
+  beast::Value(&moved, 0)[2].set(int64_t{42}); // the overlay wins
+  EXPECT_EQ(beast::Value(&moved, 0)[2].as<int>(), 42);
+
+  moved.disable_number_decoding(); // values of this parse stay readable
+  EXPECT_EQ(beast::Value(&moved, 0)[1].as<double>(), 2.5);
+  root = beast::parse(moved, j);
+  EXPECT_FALSE(moved.tape[1].is_decoded());
+  EXPECT_EQ(root[0].as<int>(), 1);
+}
+
+TEST(NumberDecode, StagedParseCanReportBadAlloc) {
+  // Decoding grows numbers_ from inside Stage 2; the staged entry points
+  // must let std::bad_alloc through rather than terminate.
+  static_assert(!noexcept(std::declval<Parser &>().parse_staged(
+      std::declval<const Stage1Index &>())));
+  uint32_t count = 0;
+  static_assert(!noexcept(std::declval<Parser &>().parse_staged_elements(
+      nullptr, 0, true, count)));
+  (void)count;
+}
@@ -0,0 +1,112 @@
+#include <beast_json/beast_json.hpp>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+static void expect_same_as_unpadded(std::string_view src) {
+  const PaddedString ps(src);
+  const std::string_view json = ps.view();
+
+  // parse_padded() against parse_reuse() (the same path, unpadded).
+  DocumentView a, b;
+  bool ok_a = true, ok_b = true;
+  try {
+    parse_reuse(a, json);
+  } catch (const std::runtime_error &) {
+    ok_a = false;
+  }
+  try {
+    parse_padded(b, json);
+  } catch (const std::runtime_error &) {
+    ok_b = false;
+  }
+  ASSERT_EQ(ok_a, ok_b) << json;
+  if (ok_a)
+    expect_same_tapes(a, b, json);
+
+  // The single-pass parser, whichever path parse_reuse() takes here.
+  DocumentView c, d;
+  prepare_parse_(c, json);
+  prepare_parse_(d, json);
+  c.tape.reserve(json.size() + 64);
+  d.tape.reserve(json.size() + 64);
+  const bool ok_c = Parser(&c).parse<false>();
+  const bool ok_d = Parser(&d).parse<true>();
+  ASSERT_EQ(ok_c, ok_d) << json;
+  if (ok_c)
+    expect_same_tapes(c, d, json);
+}
+
+static std::string sample() {
+  return R"({"id":1234567890123456789,"name":"padded \"input\" \\ test",)"
+         R"("vals":[0,-1,2.5,-3.25e-7,1E+9,true,false,null,"",[],{}],)"
+         R"("long_key_that_goes_past_thirty_two_bytes_at_least":)"
+         R"("a value that is longer than sixty-four bytes, to cross a block",)"
+         "\n  \"ws\" :\t[ 1 , 2 ]   }";
+}
+
+TEST(Padded, SameTapeAsUnpadded) {
+  for (const std::string &j :
+       {sample(), std::string("0"), std::string("-12.5e3  "),
+        std::string("\"s\""), std::string("true"), std::string("[null]"),
+        std::string(200, ' ') + "[1]" + std::string(200, ' '),
+        "[\"" + std::string(500, 'x') + "\\n\"]",
+        "[" + std::string(100, '7') + "]"})
+    expect_same_as_unpadded(j);
+}
+
+TEST(Padded, EveryTruncation) {
+  // Each prefix ends mid-token somewhere: strings, keys, numbers, literals
+  // and whitespace runs cut at the end of the input.
+  const std::string j = sample();
+  for (size_t n = 0; n <= j.size(); ++n)
+    expect_same_as_unpadded(std::string_view(j).substr(0, n));
+}
+
+TEST(Padded, TokensAtTheVeryEnd) {
+  for (const char *j :
+       {"nul", "tru", "fals", "1", "-", "1.", "1e", "1e+", "\"", "\"abc",
+        "\"abc\\", "[1,", "{\"k\"", "{\"k\":", "{\"k\":1", "[true", "[nulls]",
+        "truex", "  ", ""})
+    expect_same_as_unpadded(j);
+}
+
+TEST(Padded, LargeDocument) {
+  std::string j = "[";
+  for (int i = 0; i < 20000; ++i)
+    j += (i ? "," : "") + std::string(R"({"k":")") + std::to_string(i * 7) +
+         R"(","v":)" + std::to_string(i * 0.001) + "}";
+  j += "]";
+  expect_same_as_unpadded(j);
+
+  beast::Document doc;
+  const beast::PaddedString ps(j);
+  auto root = beast::parse_padded(doc, ps);
+  EXPECT_EQ(root.size(), 20000u);
+  EXPECT_EQ(root[19999]["k"].as<std::string_view>(), "139993");
+}
+
+TEST(Padded, PaddedStringBuffer) {
+  beast::PaddedString empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.view(), "");
+
+  // Filled in place, e.g. by read().
+  const char msg[] = R"({"ok":true})";
+  beast::PaddedString ps(sizeof(msg) - 1);
+  std::memcpy(ps.data(), msg, ps.size());
+  for (size_t i = 0; i < beast::json::lazy::kPadding; ++i)
+    ASSERT_EQ(ps.data()[ps.size() + i], '\0');
+
+  beast::PaddedString moved(std::move(ps));
+  beast::Document doc;
+  EXPECT_TRUE(beast::parse_padded(doc, moved)["ok"].as<bool>());
+  const std::string_view v = moved;
+  EXPECT_EQ(v, msg);
+  EXPECT_THROW(beast::parse_padded(doc, empty), std::runtime_error);
+}
@@ -0,0 +1,205 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+
+// Parallel index must equal one sequential scan, for every chunk size.
+static void expect_same_index(std::string_view json) {
+  const Stage1Fn scan = stage1_kernel();
+  if (!scan)
+    GTEST_SKIP() << "no Stage 1 kernel on this CPU";
+  Stage1Index seq;
+  scan(json.data(), json.size(), seq, 0, Stage1Carry{});
+  for (unsigned threads : {2u, 3u, 4u, 8u}) {
+    for (size_t min_chunk : {64, 128, 192, 1024}) {
+      Stage1Index par;
+      ASSERT_TRUE(stage1_scan_parallel(json, par, threads, min_chunk));
+      ASSERT_EQ(par.count, seq.count) << threads << "x" << min_chunk;
+      for (uint32_t i = 0; i < seq.count; ++i)
+        ASSERT_EQ(par.positions[i], seq.positions[i])
+            << "entry " << i << ", " << threads << "x" << min_chunk;
+    }
+  }
+}
+
+static void expect_same_tape(std::string_view json) {
+  DocumentView a, b;
+  parse_reuse(a, json);
+  for (unsigned threads : {2u, 4u, 7u}) {
+    parse_parallel(b, json, threads, 64);
+    expect_same_tapes(a, b, std::to_string(threads) + " threads");
+  }
+}
+
+// Both paths must reject the same malformed inputs.
+static void expect_both_reject(std::string_view json) {
+  DocumentView a, b;
+  EXPECT_THROW(parse_reuse(a, json), std::runtime_error) << json;
+  for (unsigned threads : {2u, 4u, 7u})
+    EXPECT_THROW(parse_parallel(b, json, threads, 64), std::runtime_error)
+        << threads << ": " << json;
+}
+
+// ── Chunk-boundary carry (Phase 89) ───────────────────────────────────────────
+
+TEST(ParallelStage1, StringsAndEscapesAcrossChunks) {
+  // Slide long strings, backslash runs and bare values across the 64-byte
+  // chunk edges so every carry bit is exercised on both sides.
+  for (size_t pad = 0; pad < 70; ++pad) {
+    std::string j = "[" + std::string(pad, ' ');
+    for (int i = 0; i < 12; ++i) {
+      j += "\"" + std::string(static_cast<size_t>(i * 13 % 70), 'x');
+      j += std::string(static_cast<size_t>(i % 4), '\\');
+      j += i % 4 % 2 ? "\\\"," : "\",";
+      j += std::to_string(i * 1234567) + ", true ,{\"k\":[null]},";
+    }
+    j += "-12.5e3]";
+    expect_same_index(j);
+    expect_same_tape(j);
+  }
+}
+
+TEST(ParallelStage1, RandomDocuments) {
+  std::mt19937 rng(777);
+  const char *atoms[] = {"123456", "-0.5", "true", "false", "null",
+                         "\"\"",   "\"{[,:]} \"", "\"q\\\"q\"",
+                         "\"\\\\\"", "\"\\\\\\\\\\\"\""};
+  for (int iter = 0; iter < 40; ++iter) {
+    std::string j = "[";
+    const int n = 50 + static_cast<int>(rng() % 200);
+    for (int i = 0; i < n; ++i) {
+      if (i)
+        j += rng() % 4 ? "," : " ,\n\t";
+      j += rng() % 3 ? atoms[rng() % 10]
+                     : R"({"a b":)" + std::string(atoms[rng() % 10]) + "}";
+    }
+    j += "]";
+    expect_same_index(j);
+    expect_same_tape(j);
+  }
+}
+
+// ── Root-array Stage 2 split and stitch (Phase 90) ────────────────────────────
+
+TEST(ParallelStage2, RootArrayOfObjects) {
+  expect_same_tape("[" + record_list(300) + "]");
+  expect_same_tape("  [\n" + record_list(300) + "\n]\n\t");
+}
+
+TEST(ParallelStage2, MixedElementKinds) {
+  // Strings, scalars and nested arrays as root elements: cuts land on every
+  // kind of element start.
+  std::string j = "[";
+  for (int i = 0; i < 400; ++i) {
+    if (i)
+      j += ",";
+    switch (i % 5) {
+    case 0: j += "\"s" + std::to_string(i) + "\""; break;
+    case 1: j += std::to_string(i); break;
+    case 2: j += "[[" + std::to_string(i) + "],[]]"; break;
+    case 3: j += i % 2 ? "true" : "null"; break;
+    default: j += R"({"k":{"k":[{}]}})"; break;
+    }
+  }
+  expect_same_tape(j + "]");
+}
+
+TEST(ParallelStage2, LongStringsRebased) {
+  // Phase 84 long lengths land in later partial tapes; their tape indices
+  // must be rebased into the stitched tape.
+  std::string j = "[";
+  for (int i = 0; i < 6; ++i)
+    j += (i ? ",[" : "[") + record_list(20) + "],\"" +
+         std::string(70000 + static_cast<size_t>(i), 'z') + "\"";
+  j += "]";
+  expect_same_tape(j);
+  DocumentView a, b;
+  auto root = parse_parallel(b, j, 4, 64);
+  EXPECT_EQ(root[11].as<std::string_view>().size(), 70005u);
+  EXPECT_EQ(root.size(), 12u);
+  EXPECT_EQ(root.dump(), parse_reuse(a, j).dump());
+}
+
+TEST(ParallelStage2, SaturatedRootCount) {
+  std::string j = "[";
+  for (int i = 0; i < 70000; ++i)
+    j += i ? ",1" : "1";
+  j += "]";
+  expect_same_tape(j);
+  DocumentView doc;
+  EXPECT_EQ(parse_parallel(doc, j, 4, 64).size(), 70000u);
+}
+
+TEST(ParallelStage2, OtherRootsFallBack) {
+  expect_same_tape(R"({"all":[)" + record_list(200) + "]}");
+  expect_same_tape(R"("just a string that is long enough to be split in two")");
+}
+
+TEST(ParallelStage2, MalformedMatchesSequential) {
+  const std::string body = record_list(100);
+  expect_both_reject("[" + body + "]]");
+  expect_both_reject("[" + body + "] x");
+  expect_both_reject("[" + body);
+  expect_both_reject("[" + body + ", tru]");
+  expect_both_reject("[" + body + ",\"open]");
+  // Root closes early and reopens: whatever parse_reuse() decides, the
+  // parallel path must agree.
+  const std::string odd = "[" + body + "][" + body + "]";
+  DocumentView a, b;
+  bool seq_ok = true, par_ok = true;
+  try {
+    parse_reuse(a, odd);
+  } catch (const std::runtime_error &) {
+    seq_ok = false;
+  }
+  try {
+    parse_parallel(b, odd, 4, 64);
+  } catch (const std::runtime_error &) {
+    par_ok = false;
+  }
+  EXPECT_EQ(seq_ok, par_ok);
+  if (seq_ok && par_ok) {
+    EXPECT_EQ(a.tape.size(), b.tape.size());
+  }
+}
+
+TEST(ParallelStage1, SmallInputsStaySequential) {
+  DocumentView doc;
+  auto root = parse_parallel(doc, R"({"a":[1,2,3]})", 8);
+  EXPECT_EQ(root["a"][2].as<int>(), 3);
+  EXPECT_EQ(root.dump(), R"({"a":[1,2,3]})");
+}
+
+TEST(ParallelStage1, InvalidRejected) {
+  std::string j = "[";
+  for (int i = 0; i < 200; ++i)
+    j += "{\"k\":" + std::to_string(i) + "},";
+  j += "1]]";
+  DocumentView doc;
+  EXPECT_THROW(parse_parallel(doc, j, 4, 64), std::runtime_error);
+}
+
+TEST(ParallelStage1, FacadeDefaultChunkSize) {
+  // ~3 MB: large enough to split at the default 1 MB minimum chunk.
+  std::string j = "[";
+  for (int i = 0; i < 60000; ++i)
+    j += (i ? "," : "") + std::string(R"({"id":)") + std::to_string(i) +
+         R"(,"name":"item \"quoted\" )" + std::to_string(i) + R"("})";
+  j += "]";
+  j.reserve(j.size() + 64); // parse()'s SIMD skip may read past the end
+  beast::Document a, b;
+  auto ra = beast::parse(a, j);
+  auto rb = beast::parse_parallel(b, j, 4);
+  EXPECT_EQ(rb.size(), 60000u);
+  EXPECT_EQ(rb[59999]["id"].as<int>(), 59999);
+  EXPECT_EQ(a.tape.size(), b.tape.size());
+  EXPECT_EQ(ra.dump(), rb.dump());
+}
+
+#endif // BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
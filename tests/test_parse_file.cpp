@@ -0,0 +1,111 @@
+#include <beast_json/beast_json.hpp>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace beast::json::lazy;
+
+static std::string write_temp(const std::string &name,
+                              const std::string &bytes) {
+  const std::string path = testing::TempDir() + "beast_" + name;
+  std::FILE *f = std::fopen(path.c_str(), "wb");
+  EXPECT_NE(f, nullptr);
+  std::fwrite(bytes.data(), 1, bytes.size(), f);
+  std::fclose(f);
+  return path;
+}
+
+// `n` bytes exactly: an array of numbers padded with spaces.
+static std::string array_of_size(size_t n) {
+  std::string j = "[";
+  for (int i = 0; j.size() + 16 < n; ++i)
+    j += (i ? "," : "") + std::to_string(i);
+  j += "]";
+  j.resize(n, ' ');
+  return j;
+}
+
+TEST(ParseFile, MatchesParse) {
+  const std::string j =
+      R"({"name":"file \"x\"","vals":[1,2.5,-3e2,true,null],"o":{"k":"v"}})";
+  const std::string path = write_temp("small.json", j);
+  beast::Document doc, ref;
+  auto root = beast::parse_file(doc, path);
+  EXPECT_EQ(root.dump(), beast::parse(ref, j).dump());
+  EXPECT_EQ(root["vals"][1].as<double>(), 2.5);
+  EXPECT_EQ(doc.source.size(), j.size());
+  std::remove(path.c_str());
+}
+
+TEST(ParseFile, SizesAroundPageEdges) {
+  // Files ending exactly on, or just short of, a page boundary have no
+  // slack behind them in the mapping; the padding page must cover the
+  // scanners' over-read.
+  for (size_t n : {4096u - 63, 4096u - 1, 4096u, 4096u + 1, 3 * 4096u,
+                   65536u, 65536u + 64, 200000u}) {
+    const std::string j = array_of_size(n);
+    const std::string path = write_temp("edge.json", j);
+    for (bool populate : {false, true}) {
+      beast::Document doc, ref;
+      auto root = beast::parse_file(doc, path, populate);
+      EXPECT_EQ(root.dump(), beast::parse(ref, j).dump()) << n;
+      EXPECT_EQ(doc.source.size(), n);
+      const char *tail = doc.source.data() + n;
+      for (size_t i = 0; i < kPadding; ++i)
+        ASSERT_EQ(tail[i], '\0') << n; // readable zeros past EOF
+    }
+    std::remove(path.c_str());
+  }
+}
+
+TEST(ParseFile, ValuesOutliveMoves) {
+  const std::string path = write_temp("move.json", R"({"a":[10,20,30]})");
+  beast::Document doc;
+  beast::parse_file(doc, path);
+  std::remove(path.c_str()); // the mapping keeps the data
+  beast::Document moved(std::move(doc));
+  beast::Value root(&moved, 0);
+  EXPECT_EQ(root["a"][2].as<int>(), 30);
+  beast::Document assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(beast::Value(&assigned, 0).dump(), R"({"a":[10,20,30]})");
+}
+
+TEST(ParseFile, ReuseReplacesMapping) {
+  const std::string p1 = write_temp("r1.json", "[1,2,3]");
+  const std::string p2 = write_temp("r2.json", array_of_size(70000));
+  beast::Document doc;
+  for (int round = 0; round < 4; ++round) {
+    auto root = beast::parse_file(doc, round % 2 ? p2 : p1);
+    EXPECT_EQ(root[2].as<int>(), 2 + (round % 2 ? 0 : 1));
+  }
+  // A string parse afterwards works as usual.
+  EXPECT_EQ(beast::parse(doc, "[7]")[0].as<int>(), 7);
+  std::remove(p1.c_str());
+  std::remove(p2.c_str());
+}
+
+TEST(ParseFile, Errors) {
+  beast::Document doc;
+  EXPECT_THROW(beast::parse_file(doc, testing::TempDir() + "beast_missing"),
+               std::runtime_error);
+  const std::string empty = write_temp("empty.json", "");
+  EXPECT_THROW(beast::parse_file(doc, empty), std::runtime_error);
+  const std::string bad = write_temp("bad.json", "{\"a\":[1,2}");
+  EXPECT_THROW(beast::parse_file(doc, bad), std::runtime_error);
+  std::remove(empty.c_str());
+  std::remove(bad.c_str());
+}
+
+TEST(ParseFile, MappedFileDirect) {
+  const std::string path = write_temp("direct.json", "[true]");
+  MappedFile f(path.c_str());
+#if BEAST_JSON_HAS_MMAP
+  EXPECT_TRUE(f.mapped());
+#endif
+  EXPECT_EQ(f.view(), "[true]");
+  MappedFile g(std::move(f));
+  EXPECT_EQ(g.view(), "[true]");
+  EXPECT_TRUE(f.view().empty());
+  std::remove(path.c_str());
+}
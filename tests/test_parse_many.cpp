@@ -0,0 +1,129 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+// The single-pass fallback must build the same tape as the Stage 1 path.
+static void expect_same_as_scalar(std::string_view src) {
+  std::string buf(src);
+  buf.reserve(src.size() + 64); // parse()'s SIMD skip may read past the end
+  const std::string_view json(buf);
+  DocumentView a, b;
+  parse_many(a, json);
+  prepare_parse_(b, json);
+  parse_many_scalar_(b);
+  expect_same_tapes(a, b, json);
+}
+
+// Every document of the stream equals a standalone parse of its line.
+static void expect_lines(std::string_view json,
+                         const std::vector<std::string> &lines) {
+  DocumentView doc;
+  auto root = parse_many(doc, json);
+  ASSERT_TRUE(root.is_array());
+  ASSERT_EQ(root.size(), lines.size());
+  size_t i = 0;
+  for (auto d : root.elements()) {
+    DocumentView one;
+    EXPECT_EQ(d.dump(), parse_reuse(one, lines[i]).dump()) << i;
+    ++i;
+  }
+}
+
+TEST(ParseMany, JsonLines) {
+  const std::vector<std::string> lines = {
+      R"({"level":"info","msg":"start","ts":1})",
+      R"({"level":"warn","msg":"disk \"sda\" 91%","ts":2})",
+      R"([1,2,{"a":null}])", R"("bare string")", "42", "true", "null"};
+  std::string s;
+  for (const auto &l : lines)
+    s += l + "\n";
+  expect_lines(s, lines);
+  expect_same_as_scalar(s);
+
+  DocumentView doc;
+  auto root = parse_many(doc, s);
+  EXPECT_EQ(root[1]["ts"].as<int>(), 2);
+  EXPECT_EQ(root[4].as<int>(), 42);
+}
+
+TEST(ParseMany, SeparatorsAndEmptyStreams) {
+  // CRLF, blank lines, no trailing newline, or only spaces between values.
+  expect_lines("{\"a\":1}\r\n\r\n{\"a\":2}", {R"({"a":1})", R"({"a":2})"});
+  expect_lines(R"({"a":1}{"a":2} [3]"x")",
+               {R"({"a":1})", R"({"a":2})", "[3]", R"("x")"});
+  expect_lines("", {});
+  expect_lines(" \n\t\n", {});
+  expect_same_as_scalar("1 2 3");
+  expect_same_as_scalar("\n\n");
+
+  DocumentView doc;
+  auto root = parse_many(doc, "\n");
+  EXPECT_TRUE(root.empty());
+  EXPECT_EQ(root.dump(), "[]");
+}
+
+TEST(ParseMany, DumpIsArrayOfDocuments) {
+  DocumentView doc;
+  auto root = parse_many(doc, "{\"id\":1}\n{\"id\":2,\"t\":[true]}\n");
+  EXPECT_EQ(root.dump(), R"([{"id":1},{"id":2,"t":[true]}])");
+  EXPECT_EQ(root[1].dump(), R"({"id":2,"t":[true]})");
+  EXPECT_EQ(root[0]["id"].as<int>(), 1);
+}
+
+TEST(ParseMany, ManyRecordsAcrossBlocks) {
+  // Well past one Stage 1 block, with long strings straddling block edges
+  // and more than 0xFFFF documents (saturated root count).
+  std::string s;
+  std::vector<std::string> lines;
+  for (int i = 0; i < 70000; ++i) {
+    std::string l = R"({"id":)" + std::to_string(i) + R"(,"tag":"t\"q",)" +
+                    R"("v":[)" + std::to_string(i * 0.5) + "]}";
+    if (i % 9000 == 0)
+      l = R"({"blob":")" + std::string(70000 + static_cast<size_t>(i), 'z') +
+          R"("})";
+    s += l + "\n";
+    lines.push_back(std::move(l));
+  }
+  DocumentView doc;
+  auto root = parse_many(doc, s);
+  ASSERT_EQ(root.size(), lines.size());
+  EXPECT_EQ(root[69999]["id"].as<int>(), 69999);
+  EXPECT_EQ(root[63000]["blob"].as<std::string_view>().size(), 133000u);
+  size_t i = 0;
+  for (auto d : root.elements()) {
+    if (i % 997 == 0) {
+      DocumentView one;
+      ASSERT_EQ(d.dump(), parse_reuse(one, lines[i]).dump()) << i;
+    }
+    ++i;
+  }
+  EXPECT_EQ(i, lines.size());
+  expect_same_as_scalar(s);
+}
+
+TEST(ParseMany, MalformedDocumentRejected) {
+  DocumentView doc;
+  for (const char *s :
+       {"{\"a\":1}\n{\"a\":\n", "{\"a\":1}\n]\n{\"a\":2}", "[1]\n[2\n",
+        "{\"a\":1}\n\"open\n", "{\"a\":1}\nnul\n", "[1]]"})
+    EXPECT_THROW(parse_many(doc, s), std::runtime_error) << s;
+  // The document is reusable after a rejected stream.
+  EXPECT_EQ(parse_many(doc, "[1]\n[2]").size(), 2u);
+}
+
+TEST(ParseMany, FacadeReuse) {
+  beast::Document doc;
+  for (int round = 0; round < 3; ++round) {
+    std::string s;
+    for (int i = 0; i <= round * 10; ++i)
+      s += R"({"n":)" + std::to_string(i) + "}\n";
+    auto root = beast::parse_many(doc, s);
+    ASSERT_EQ(root.size(), static_cast<size_t>(round * 10 + 1));
+    EXPECT_EQ(root[round * 10]["n"].as<int>(), round * 10);
+  }
+}
@@ -0,0 +1,176 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+
+using namespace beast;
+
+struct Comments : policy::Strict {
+  static constexpr bool comments = true;
+};
+struct TrailingCommas : policy::Strict {
+  static constexpr bool trailing_commas = true;
+};
+struct RejectDuplicates : policy::Strict {
+  static constexpr DuplicateKeys duplicate_keys = DuplicateKeys::Reject;
+};
+struct LastWins : policy::Strict {
+  static constexpr DuplicateKeys duplicate_keys = DuplicateKeys::LastWins;
+};
+struct NanInf : policy::Strict {
+  static constexpr bool nan_inf = true;
+};
+struct Shallow : policy::Strict {
+  static constexpr uint32_t max_depth = 3;
+};
+
+template <typename P> static bool ok(std::string_view json) {
+  try {
+    Document doc;
+    parse<P>(doc, json);
+    return true;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+TEST(Policies, StrictIsParseStrict) {
+  for (const char *j : {"[1,2]", "{\"a\":[true,null]}", "\"s\"", "[1,]",
+                        "{\"a\" 1}", "[01]", "// c\n1", "NaN"}) {
+    bool strict = true;
+    try {
+      Document doc;
+      parse_strict(doc, j);
+    } catch (const std::runtime_error &) {
+      strict = false;
+    }
+    EXPECT_EQ(ok<policy::Strict>(j), strict) << j;
+  }
+}
+
+// Policies configure the strict grammar only; a policy with parse()'s
+// trailing-comma setting still rejects what only the two-stage parser
+// lets through.
+struct LikeParse : policy::Strict {
+  static constexpr bool trailing_commas = true;
+};
+TEST(Policies, NoLenientPolicy) {
+  EXPECT_TRUE(ok<LikeParse>("[1,2,]"));
+  EXPECT_FALSE(ok<LikeParse>("{\"a\" 1}"));
+  Document doc;
+  EXPECT_NO_THROW(parse(doc, "{\"a\" 1}"));
+  static_assert(!ParsePolicy<int>);
+}
+
+TEST(Policies, Comments) {
+  Document doc;
+  auto root = parse<Comments>(doc, "// head\n{\"a\": /* one */ 1, // tail\n"
+                                   "\"b\":[2/**/,3]} /* end */");
+  EXPECT_EQ(root["a"].as<int64_t>(), 1);
+  EXPECT_EQ(root["b"][1].as<int64_t>(), 3);
+  EXPECT_EQ(root.dump(), R"({"a":1,"b":[2,3]})");
+  EXPECT_TRUE(ok<Comments>("1 // no newline"));
+  EXPECT_TRUE(ok<Comments>("[\"// not a comment\"]"));
+  EXPECT_FALSE(ok<Comments>("[1 /* open"));
+  EXPECT_FALSE(ok<Comments>("[1 / 2]"));
+  EXPECT_FALSE(ok<Comments>("[1,]")); // comments only
+}
+
+TEST(Policies, TrailingCommas) {
+  Document doc;
+  auto root = parse<TrailingCommas>(doc, "{\"a\":[1,2,],\"b\":{},}");
+  EXPECT_EQ(root["a"].size(), 2u);
+  EXPECT_EQ(root.dump(), R"({"a":[1,2],"b":{}})");
+  EXPECT_FALSE(ok<TrailingCommas>("[,]"));
+  EXPECT_FALSE(ok<TrailingCommas>("[1,,]"));
+  EXPECT_FALSE(ok<TrailingCommas>("{,}"));
+  EXPECT_FALSE(ok<TrailingCommas>("{\"a\" 1}")); // still strict otherwise
+}
+
+TEST(Policies, DuplicateKeys) {
+  EXPECT_TRUE(ok<policy::Strict>(R"({"a":1,"a":2})"));
+  EXPECT_FALSE(ok<RejectDuplicates>(R"({"a":1,"a":2})"));
+  EXPECT_FALSE(ok<RejectDuplicates>(R"({"a":{"b":1,"b":2}})"));
+  // The same key in different objects, and after an inner object closes.
+  EXPECT_TRUE(ok<RejectDuplicates>(R"({"a":{"a":1},"b":[{"a":2},{"a":3}]})"));
+  EXPECT_TRUE(ok<RejectDuplicates>(R"({"x":{"y":1},"y":2})"));
+  EXPECT_TRUE(ok<RejectDuplicates>(R"({"a":1,"\u0061":2})")); // raw bytes
+
+  try {
+    Document doc;
+    parse<RejectDuplicates>(doc, R"({"a":1, "a":2})");
+    FAIL();
+  } catch (const std::runtime_error &e) {
+    EXPECT_STREQ(e.what(), "RFC 8259 violation at offset 8: duplicate key");
+  }
+
+  Document doc;
+  auto root = parse<LastWins>(doc, R"({"a":1,"b":2,"a":{"a":3},"a":4})");
+  EXPECT_EQ(root["a"].as<int64_t>(), 4);
+  EXPECT_EQ(root.size(), 2u);
+  EXPECT_EQ(root.dump(), R"({"b":2,"a":4})");
+  root = parse<LastWins>(doc, R"({"a":1})"); // the overlay is per parse
+  EXPECT_EQ(root["a"].as<int64_t>(), 1);
+}
+
+TEST(Policies, DuplicateKeysInWideObjects) {
+  // Past the linear scan the keys are hashed, per nesting level.
+  std::string j = "{";
+  for (int i = 0; i < 100; ++i)
+    j += "\"k" + std::to_string(i) + "\":{\"k" + std::to_string(i) + "\":" +
+         std::to_string(i) + "},";
+  EXPECT_TRUE(ok<RejectDuplicates>(j + "\"end\":0}"));
+  EXPECT_FALSE(ok<RejectDuplicates>(j + "\"k57\":0}"));
+  EXPECT_FALSE(ok<RejectDuplicates>(j + "\"k3\":0}"));
+
+  Document doc;
+  const std::string last = j + "\"k57\":-1}"; // the document views it
+  auto root = parse<LastWins>(doc, last);
+  EXPECT_EQ(root.size(), 100u);
+  EXPECT_EQ(root["k57"].as<int64_t>(), -1);
+  EXPECT_EQ(root["k58"]["k58"].as<int64_t>(), 58);
+}
+
+TEST(Policies, NanInf) {
+  Document doc;
+  auto root = parse<NanInf>(doc, "[NaN, Infinity, -Infinity, -1.5]");
+  EXPECT_TRUE(std::isnan(root[0].as<double>()));
+  EXPECT_EQ(root[1].as<double>(), INFINITY);
+  EXPECT_EQ(root[2].as<double>(), -INFINITY);
+  EXPECT_EQ(root[3].as<double>(), -1.5);
+  EXPECT_EQ(root.dump(), "[NaN,Infinity,-Infinity,-1.5]");
+  for (const char *j : {"-NaN", "nan", "Inf", "Infinit", "[NaNx]", "+1"})
+    EXPECT_FALSE(ok<NanInf>(j)) << j;
+  EXPECT_FALSE(ok<policy::Strict>("NaN"));
+  EXPECT_FALSE(ok<policy::Strict>("-Infinity"));
+}
+
+TEST(Policies, MaxDepth) {
+  EXPECT_FALSE(ok<Shallow>("[[{\"a\":[]}]]"));
+  EXPECT_TRUE(ok<Shallow>("[[{\"a\":1}]]"));
+  EXPECT_TRUE(ok<Shallow>("[[1],[2],{\"a\":[3]}]"));
+  EXPECT_FALSE(ok<Shallow>("[[[[1]]]]"));
+  try {
+    Document doc;
+    parse<Shallow>(doc, "[[[[1]]]]");
+    FAIL();
+  } catch (const std::runtime_error &e) {
+    EXPECT_STREQ(e.what(), "RFC 8259 violation at offset 3: nesting deeper "
+                           "than the policy's max_depth");
+  }
+}
+
+TEST(Policies, Relaxed) {
+  Document doc;
+  auto root = parse<policy::Relaxed>(doc, R"(// config
+{
+  "retries": 3,          // per request
+  "timeout": Infinity,
+  "hosts": ["a", "b",],  /* more later */
+})");
+  EXPECT_EQ(root["retries"].as<int64_t>(), 3);
+  EXPECT_EQ(root["timeout"].as<double>(), INFINITY);
+  EXPECT_EQ(root["hosts"].size(), 2u);
+  EXPECT_FALSE(ok<policy::Relaxed>("[01]"));
+  EXPECT_FALSE(ok<policy::Relaxed>("{'a':1}"));
+}
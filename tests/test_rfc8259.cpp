@@ -12,9 +12,13 @@
 
 #include <beast_json/beast_json.hpp>
 #include <gtest/gtest.h>
+#include <random>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 
+#include "tape_compare.hpp"
+
 using namespace beast;
 
 // ── Helpers ───────────────────────────────────────────────────────────────────
@@ -382,3 +386,216 @@ TEST(RFC8259_API, ErrorMessageContainsOffset) {
         << "Error message should contain byte offset: " << msg;
   }
 }
+
+// ── Phase 101: single-pass parse_strict() ────────────────────────────────────
+
+TEST(RFC8259_SinglePass, TapeMatchesParse) {
+  std::string big(70000, 'x'); // past the 16 length bits (long_lens_)
+  std::string many = "[";
+  for (int i = 0; i < 70000; ++i)
+    many += i ? ",0" : "0"; // past the saturated element count
+  many += "]";
+  for (const std::string& j :
+       {std::string(R"({"a":[1,-2,3.5,-0.0e+1,1E9],"b":{"c":null,)"
+                    R"("d":[true,false,{}],"e":[]},"s":"q\"\u00e9\\"})"),
+        std::string(" \t\n[ { \"k\" : \"v\" } , [ [ ] ] , 0 ]\r\n"),
+        std::string("\"top\""), std::string("-12"), std::string("null"),
+        "[\"" + big + "\",{\"" + big + "\":1}]", many}) {
+    Document lenient, strict;
+    parse(lenient, j);
+    parse_strict(strict, j);
+    expect_same_tapes(lenient, strict, j);
+    EXPECT_EQ(parse_strict(strict, j).dump(), parse(lenient, j).dump());
+  }
+}
+
+TEST(RFC8259_SinglePass, SameErrorsAsValidate) {
+  for (std::string_view j :
+       {"[1,]", "{\"a\":1,}", "01", "-01", "1.", "1.e5", "1e", "1e+", "-",
+        "[-]", "\"a\x01\"", "\"\\x\"", "\"\\u12G4\"", "\"\\u12", "\"abc",
+        "\"\\", "[1 2]", "{\"a\" 1}", "{1:2}", "{\"a\":1", "[1,2", "tru",
+        "nul", "[", "", "   ", "1 2", "[1]]", "{\"a\":[1,{\"b\":}]}",
+        "[\"ok\",\"bad\x1f\"]", "NaN", "+1", ".5", "[1,,2]"}) {
+    std::string expected, got;
+    try {
+      rfc8259::validate(j);
+    } catch (const std::runtime_error& e) {
+      expected = e.what();
+    }
+    ASSERT_FALSE(expected.empty()) << j;
+    try {
+      Document doc;
+      parse_strict(doc, j);
+    } catch (const std::runtime_error& e) {
+      got = e.what();
+    }
+    EXPECT_EQ(got, expected) << j;
+  }
+}
+
+TEST(RFC8259_SinglePass, DepthLimitAndReuse) {
+  Document doc;
+  const std::string ok = std::string(1000, '[') + std::string(1000, ']');
+  EXPECT_NO_THROW(parse_strict(doc, ok));
+  const std::string deep = std::string(5000, '[') + std::string(5000, ']');
+  EXPECT_THROW(parse(doc, deep), std::runtime_error);
+  EXPECT_THROW(parse_strict(doc, deep), std::runtime_error);
+
+  // A failed parse leaves the document reusable.
+  EXPECT_THROW(parse_strict(doc, "[1,2,]"), std::runtime_error);
+  Value root = parse_strict(doc, R"({"x":[7,8]})");
+  EXPECT_EQ(root["x"][1].as<int>(), 8);
+  EXPECT_EQ(root["x"].size(), 2u);
+}
+
+TEST(RFC8259_SinglePass, HonoursDocumentOptIns) {
+  const std::string j = R"([12,-3.25,"s",1e2])";
+  Document plain, dec;
+  dec.enable_number_decoding();
+  parse(plain, j);
+  Value root = parse_strict(dec, j);
+  expect_same_tapes(plain, dec, j, json::lazy::TapeNode::kDecodedFlag);
+  EXPECT_TRUE(dec.tape[1].is_decoded());
+  EXPECT_EQ(root[0].as<int64_t>(), 12);
+  EXPECT_EQ(root[1].as<double>(), -3.25);
+
+  Document utf8;
+  utf8.enable_utf8_validation();
+  EXPECT_NO_THROW(parse_strict(utf8, "\"caf\xC3\xA9\""));
+  EXPECT_THROW(parse_strict(utf8, "\"\xC0\x80\""), std::runtime_error);
+  try {
+    parse_strict(utf8, "[\"\xC0\x80\",]"); // both: the RFC error is reported
+    FAIL() << "Expected runtime_error";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string(e.what()).find("trailing comma"), std::string::npos)
+        << e.what();
+  }
+}
+
+// ── Phase 102: block validator ───────────────────────────────────────────────
+
+static bool scalar_ok(const std::string& j) {
+  try {
+    rfc8259::detail_::Validator<false>{}.run(j);
+    return true;
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+}
+
+TEST(RFC8259_Blocks, HelpersMatchByteLoops) {
+  // Every stop byte at every offset, from every alignment.
+  std::string buf(200, 'a');
+  for (size_t from = 0; from < 16; ++from) {
+    for (size_t at = from; at < 150; ++at) {
+      for (char stop : {'"', '\\', '\x01', '\x1f', '\0'}) {
+        buf[at] = stop;
+        const char* b = buf.data();
+        EXPECT_EQ(rfc8259::detail_::string_stop_(b + from, b + buf.size()),
+                  b + at);
+        EXPECT_EQ(rfc8259::detail_::string_stop_(b + from, b + at), b + at);
+        buf[at] = 'a';
+      }
+    }
+  }
+  std::string num(200, '7');
+  for (size_t from = 0; from < 16; ++from) {
+    for (size_t at = from; at < 150; ++at) {
+      for (char stop : {'.', 'e', '/', ':', ' ', '\xb0'}) {
+        num[at] = stop;
+        const char* b = num.data();
+        EXPECT_EQ(rfc8259::detail_::digits_end_(b + from, b + num.size()),
+                  b + at);
+        num[at] = '7';
+      }
+    }
+  }
+}
+
+TEST(RFC8259_Blocks, BoundaryErrors) {
+  // A bad byte on either side of the 16/32/64-byte edges is reported at
+  // its own offset; escapes and numbers split across blocks are accepted.
+  for (size_t pad = 0; pad < 140; ++pad) {
+    const std::string a(pad, 'a');
+    const struct {
+      const char* bad;
+      size_t offset; // of the reported byte, from the string's first
+    } kBad[] = {{"\x01", 0}, {"\\q", 1}, {"\\u12G4", 4}, {"\\u12", 4}};
+    for (const auto& [bad, offset] : kBad) {
+      const std::string at = "offset " + std::to_string(pad + 2 + offset);
+      try {
+        rfc8259::validate("[\"" + a + bad + "\"]");
+        ADD_FAILURE() << pad << " " << bad;
+      } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find(at), std::string::npos)
+            << pad << " " << e.what();
+      }
+    }
+    for (const char* good : {"\\u00e9", "\\\\", "\\\"", "\\/\\n"})
+      EXPECT_NO_THROW(rfc8259::validate("[\"" + a + good + "\"]")) << pad;
+
+    const std::string sp(pad, ' ');
+    EXPECT_NO_THROW(rfc8259::validate(sp + "-0.5e+10"));
+    EXPECT_NO_THROW(rfc8259::validate("[" + sp + "123456789,true]"));
+    EXPECT_NO_THROW(rfc8259::validate(sp + "false"));
+    EXPECT_THROW(rfc8259::validate("[" + sp + "0123]"), std::runtime_error);
+    EXPECT_THROW(rfc8259::validate("[" + sp + "1.]"), std::runtime_error);
+    EXPECT_THROW(rfc8259::validate(sp + "12e"), std::runtime_error);
+    EXPECT_THROW(rfc8259::validate(sp + "nul"), std::runtime_error);
+    EXPECT_THROW(rfc8259::validate("[\"" + a + "\\"), std::runtime_error);
+    EXPECT_THROW(rfc8259::validate("[\"" + a), std::runtime_error);
+  }
+}
+
+TEST(RFC8259_Blocks, AgreesWithScalarValidator) {
+  if (!rfc8259::detail_::blocks_accept_("[]", 2))
+    GTEST_SKIP() << "no vector unit: validate() is the scalar validator";
+  std::string base = R"({"id":123,"neg":-0.5e-3,"ok":[true,false,null],)";
+  for (int i = 0; i < 12; ++i)
+    base += "\"key" + std::to_string(i) + "\" : [\"text \\\"with\\\" " +
+            std::string(i * 7, 'x') + " \\u00e9\\n\", {\"n\":" +
+            std::to_string(i * 1234567) + ".25, \"e\": []}],\n  ";
+  base += R"("end":{}})";
+  ASSERT_TRUE(scalar_ok(base));
+  ASSERT_TRUE(rfc8259::detail_::blocks_accept_(base.data(), base.size()));
+
+  static const char kBytes[] = "\"\\,:[]{}0-.eEux \x01\x1f\xc3";
+  std::mt19937 rng(8259);
+  for (int round = 0; round < 20000; ++round) {
+    std::string j = base;
+    for (int edits = 1 + rng() % 3; edits > 0; --edits) {
+      const size_t at = rng() % j.size();
+      const char c = kBytes[rng() % (sizeof(kBytes) - 1)];
+      switch (rng() % 3) {
+      case 0: j[at] = c; break;
+      case 1: j.insert(j.begin() + at, c); break;
+      default: j.erase(at, 1); break;
+      }
+    }
+    if (rng() % 8 == 0)
+      j.resize(rng() % j.size()); // truncated, often mid-token
+    ASSERT_EQ(rfc8259::detail_::blocks_accept_(j.data(), j.size()),
+              scalar_ok(j))
+        << j;
+  }
+}
+
+TEST(RFC8259_Blocks, StringStopMatchesSwar) {
+  // The vector string scans (dispatched or built in) stop where the SWAR
+  // loop does, for a stop byte at every position around the vector edges.
+  namespace d = rfc8259::detail_;
+  for (size_t len : {0, 1, 7, 8, 31, 32, 33, 63, 64, 65, 130}) {
+    for (size_t at = 0; at <= len; ++at) {
+      for (char stop : {'"', '\\', '\x00', '\x1f'}) {
+        std::string s(len, 'a');
+        s += "\xc3\xa9 tail";
+        if (at < len)
+          s[at] = stop;
+        const char *b = s.data(), *e = b + len;
+        ASSERT_EQ(d::string_stop_(b, e) - b, d::string_stop_swar_(b, e) - b)
+            << len << "/" << at;
+        ASSERT_EQ(d::string_stop_(b, e) - b, static_cast<ptrdiff_t>(at));
+      }
+    }
+  }
+}
@@ -0,0 +1,280 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+#if BEAST_HAS_AVX2 || BEAST_HAS_NEON || BEAST_JSON_RUNTIME_DISPATCH
+
+// Every Stage 1 kernel this binary can run on this CPU.
+static std::vector<Stage1Fn> kernels() {
+#if BEAST_HAS_NEON
+  return {&stage1_scan_neon};
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  std::vector<Stage1Fn> v;
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    v.push_back(&stage1_scan_avx512);
+  if (__builtin_cpu_supports("avx2"))
+    v.push_back(&stage1_scan_avx2);
+  return v;
+#else
+  return {stage1_kernel()};
+#endif
+}
+
+// Byte-at-a-time model of the Stage 1 contract: brackets outside strings,
+// every unescaped quote, and the first byte of each bare value.
+static std::vector<size_t> reference(std::string_view json) {
+  std::vector<size_t> out;
+  bool in_str = false, esc = false, prev_ws_like = true;
+  for (size_t i = 0; i < json.size(); ++i) {
+    const char c = json[i];
+    if (in_str) {
+      if (esc) {
+        esc = false;
+      } else if (c == '\\') {
+        esc = true;
+      } else if (c == '"') {
+        out.push_back(i);
+        in_str = false;
+        prev_ws_like = true;
+        continue;
+      }
+      prev_ws_like = false;
+      continue;
+    }
+    const bool bracket = c == '{' || c == '}' || c == '[' || c == ']';
+    const bool sep = c == ':' || c == ',';
+    const bool ws = static_cast<signed char>(c) <= 0x20;
+    if (c == '"') {
+      out.push_back(i);
+      in_str = true;
+      continue;
+    }
+    if (bracket)
+      out.push_back(i);
+    else if (!sep && !ws && prev_ws_like)
+      out.push_back(i);
+    prev_ws_like = bracket || sep || ws;
+  }
+  return out;
+}
+
+static void expect_same_index(std::string_view json) {
+  const auto ref = reference(json);
+  for (Stage1Fn scan : kernels()) {
+    Stage1Index idx;
+    scan(json.data(), json.size(), idx, 0, Stage1Carry{});
+    ASSERT_EQ(idx.count, ref.size()) << json;
+    for (size_t i = 0; i < ref.size(); ++i)
+      ASSERT_EQ(idx.positions[i], ref[i]) << "entry " << i << " of " << json;
+  }
+}
+
+// Tape from parse_staged() over the SIMD index must equal parse()'s.
+static void expect_same_tape(std::string_view src) {
+  // parse()'s SIMD whitespace skip may load up to 64 bytes past the end.
+  std::string buf(src);
+  buf.reserve(src.size() + 64);
+  const std::string_view json(buf);
+  for (Stage1Fn scan : kernels()) {
+    DocumentView a, b;
+    a.source = b.source = json;
+    a.tape.reserve(json.size() + 64);
+    b.tape.reserve(json.size() + 64);
+    scan(json.data(), json.size(), a.idx, 0, Stage1Carry{});
+    const bool ok_staged = Parser(&a).parse_staged(a.idx);
+    const bool ok_scalar = Parser(&b).parse();
+    ASSERT_EQ(ok_staged, ok_scalar) << json;
+    if (!ok_scalar)
+      return;
+    expect_same_tapes(a, b, json);
+  }
+}
+
+// Phase 91: parse_windowed() at block sizes that put every kind of token
+// on a block edge must accept / reject like parse() and build its tape.
+static void expect_same_windowed(std::string_view src) {
+  std::string buf(src);
+  buf.reserve(src.size() + 64);
+  const std::string_view json(buf);
+  DocumentView ref;
+  ref.source = json;
+  ref.tape.reserve(json.size() + 64);
+  const bool ok_scalar = Parser(&ref).parse();
+  for (Stage1Fn scan : kernels()) {
+    for (size_t window : {64, 128, 192, 4096}) {
+      DocumentView doc;
+      doc.source = json;
+      const bool ok = Parser(&doc).parse_windowed(scan, doc.idx, window);
+      ASSERT_EQ(ok, ok_scalar) << window << ": " << json;
+      if (!ok)
+        continue;
+      expect_same_tapes(ref, doc, std::to_string(window) + ": " + buf);
+    }
+  }
+}
+
+// ── Stage 1 structural index vs byte-at-a-time reference ──────────────────────
+
+TEST(Stage1, BasicTokens) {
+  for (const char *j :
+       {R"({"a":1,"b":[true,false,null],"c":"x"})", "[]", "{}", "0", "\"s\"",
+        R"(  [ 1 , -2.5e3 , "q" ]  )", R"({"k":{"n":[[[]]]}})"})
+    expect_same_index(j);
+}
+
+TEST(Stage1, EscapesAndBackslashRuns) {
+  for (const char *j :
+       {R"(["a\"b","\\","\\\"","x\\\\\"y",""])", R"({"\"":"\\\\"})",
+        R"(["{[,:]}"])"})
+    expect_same_index(j);
+}
+
+TEST(Stage1, EveryBlockBoundaryAndTail) {
+  // Slide a backslash run and a quote across the 32/64-byte boundaries.
+  for (size_t pad = 0; pad < 130; ++pad) {
+    for (int run = 1; run <= 4; ++run) {
+      std::string j = "[\"" + std::string(pad, 'x') +
+                      std::string(static_cast<size_t>(run), '\\') +
+                      (run % 2 ? "\"" : "") + "\",1,{\"k\":[2]}]";
+      expect_same_index(j);
+      expect_same_tape(j);
+      expect_same_windowed(j);
+    }
+  }
+}
+
+TEST(Stage1, RandomDocuments) {
+  std::mt19937 rng(12345);
+  const char *atoms[] = {"1",    "-0.5",    "true",      "false",  "null",
+                         "\"\"", "\"a b\"", "\"q\\\"q\"", "\"\\\\\"", "1e9"};
+  for (int iter = 0; iter < 300; ++iter) {
+    std::string j = "[";
+    const int n = static_cast<int>(rng() % 40);
+    int depth = 1;
+    bool need_sep = false;
+    for (int i = 0; i < n; ++i) {
+      if (need_sep)
+        j += rng() % 3 ? "," : " ,\n ";
+      const unsigned r = rng() % 6;
+      if (r == 0 && depth < 8) {
+        j += "[";
+        ++depth;
+        need_sep = false;
+        continue;
+      }
+      if (r == 1 && depth > 1) {
+        j += "]";
+        --depth;
+        need_sep = true;
+        continue;
+      }
+      if (r == 2) {
+        j += R"({"k":)" + std::string(atoms[rng() % 10]) + "}";
+      } else {
+        j += atoms[rng() % 10];
+      }
+      need_sep = true;
+    }
+    j += std::string(static_cast<size_t>(depth), ']');
+    expect_same_index(j);
+    expect_same_tape(j);
+    expect_same_windowed(j);
+  }
+}
+
+TEST(Stage1, GrowsPastEstimate) {
+  // ~1 entry per byte: forces Stage1Index::grow() between blocks.
+  std::string j = "[";
+  for (int i = 0; i < 50000; ++i)
+    j += i ? ",[]" : "[]";
+  j += "]";
+  expect_same_index(j);
+  expect_same_tape(j);
+}
+
+// ── Windowed Stage 1 + 2 (Phase 91) ───────────────────────────────────────────
+
+TEST(Stage1Windowed, TokensAcrossBlockEdges) {
+  // Slide strings, escapes, numbers and literals across the block edges.
+  for (size_t pad = 0; pad < 70; ++pad) {
+    std::string j = "{" + std::string(pad, ' ') + "\"k\":[";
+    for (int i = 0; i < 8; ++i)
+      j += "\"" + std::string(static_cast<size_t>(i * 17 % 61), 'x') +
+           "\\\"\\\\\",-123456.75e-3,true,false,null,[{}],";
+    j += "\"end\"]}";
+    expect_same_windowed(j);
+  }
+}
+
+TEST(Stage1Windowed, StringSpansManyBlocks) {
+  // The opening quote is held back through blocks with no entries at all.
+  std::string body;
+  for (int i = 0; i < 400; ++i)
+    body += i % 7 ? "abc" : "\\\"{[,:]}";
+  expect_same_windowed("[\"" + body + "\",1]");
+  expect_same_windowed("{\"" + body + "\":\"" + body + "\"}");
+  // Phase 84 long length: the string outgrows the 16 length bits.
+  const std::string j = "[\"" + std::string(70000, 'z') + "\",\"tail\"]";
+  DocumentView doc;
+  auto root = parse_reuse(doc, j);
+  EXPECT_EQ(root[0].as<std::string_view>().size(), 70000u);
+  EXPECT_EQ(root[1].as<std::string_view>(), "tail");
+}
+
+TEST(Stage1Windowed, MalformedRejected) {
+  const std::string big(300, 'x');
+  for (const std::string &j :
+       {std::string(), std::string(200, ' '), "[\"" + big, "[\"" + big + "\"",
+        "[\"" + big + "\"] x", "[\"" + big + "\"]]", "[1," + big + "]",
+        "[\"" + big + "\",tru]", "[\"" + big + "\"] \"x\""})
+    expect_same_windowed(j);
+}
+
+TEST(Stage1Windowed, LargeDocumentThroughParseReuse) {
+  // Several kStage1Window blocks (past the old 2 MB two-phase cutoff).
+  std::string j = "[";
+  for (int i = 0; i < 50000; ++i)
+    j += (i ? "," : "") + std::string(R"({"id":)") + std::to_string(i) +
+         R"(,"v":[)" + std::to_string(i * 0.25) + R"(,"a\"b"],"n":null})";
+  j += "]";
+  ASSERT_GT(j.size(), 2u * 1024 * 1024);
+  j.reserve(j.size() + 64);
+  DocumentView a, b;
+  b.source = j;
+  b.tape.reserve(j.size() / 4);
+  ASSERT_TRUE(Parser(&b).parse());
+  auto root = parse_reuse(a, j);
+  EXPECT_EQ(root.size(), 50000u);
+  EXPECT_EQ(root[49999]["id"].as<int>(), 49999);
+  ASSERT_EQ(a.tape.size(), b.tape.size());
+  for (size_t i = 0; i < a.tape.size(); ++i)
+    ASSERT_EQ(a.tape[i].offset, b.tape[i].offset) << "node " << i;
+}
+
+// ── Kernel selection (Phase 88) ───────────────────────────────────────────────
+
+TEST(Stage1, KernelMatchesCpu) {
+  const std::string isa = stage1_isa();
+#if BEAST_HAS_AVX512
+  EXPECT_EQ(isa, "AVX-512");
+#elif BEAST_HAS_AVX2
+  EXPECT_EQ(isa, "AVX2");
+#elif BEAST_JSON_RUNTIME_DISPATCH
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    EXPECT_EQ(isa, "AVX-512");
+  else if (__builtin_cpu_supports("avx2"))
+    EXPECT_EQ(isa, "AVX2");
+  else
+    EXPECT_EQ(isa, "none");
+#else
+  EXPECT_EQ(isa, "none");
+#endif
+}
+
+#endif // BEAST_HAS_AVX2 || BEAST_HAS_NEON || BEAST_JSON_RUNTIME_DISPATCH
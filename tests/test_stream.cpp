@@ -0,0 +1,176 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+#include "tape_compare.hpp"
+
+using namespace beast::json::lazy;
+
+// Fed in `chunk`-byte pieces, the tape must equal a one-shot parse.
+static void expect_same_tape(std::string_view json, size_t chunk) {
+  DocumentView a, b;
+  parse_reuse(a, json);
+  StreamParser sp(b);
+  for (size_t i = 0; i < json.size(); i += chunk)
+    sp.feed(json.substr(i, chunk));
+  auto root = sp.finish();
+  expect_same_tapes(a, b, std::to_string(chunk) + "-byte chunks");
+  EXPECT_EQ(root.dump(), Value(&a, 0).dump());
+}
+
+static void expect_rejected(std::string_view json, size_t chunk) {
+  DocumentView doc;
+  StreamParser sp(doc);
+  EXPECT_THROW(
+      {
+        for (size_t i = 0; i < json.size(); i += chunk)
+          sp.feed(json.substr(i, chunk));
+        sp.finish();
+      },
+      std::runtime_error)
+      << chunk << ": " << json;
+}
+
+TEST(StreamParser, EveryChunkSize) {
+  const std::string j = records(40);
+  for (size_t chunk : {1, 2, 3, 7, 31, 63, 64, 65, 100, 128, 1000, 100000})
+    expect_same_tape(j, chunk);
+}
+
+TEST(StreamParser, TokensSplitAcrossChunks) {
+  // Numbers and literals cut mid-token must not be parsed early.
+  DocumentView doc;
+  StreamParser sp(doc);
+  const std::string head = "[" + std::string(62, ' ') + "12";
+  sp.feed(head); // 64 bytes: the block ends inside "12..."
+  sp.feed("34.5e");
+  sp.feed("1, tr");
+  sp.feed("ue, nu");
+  sp.feed("ll]");
+  auto root = sp.finish();
+  ASSERT_EQ(root.size(), 3u);
+  EXPECT_DOUBLE_EQ(root[0].as<double>(), 1234.5e1);
+  EXPECT_TRUE(root[1].as<bool>());
+  EXPECT_TRUE(root[2].is_null());
+}
+
+TEST(StreamParser, ScalarRootsAndTrailingWhitespace) {
+  for (const char *j : {"42", "  -7.25e-3 \n", "\"s\"", "true", "null \t"})
+    for (size_t chunk : {1, 2, 64})
+      expect_same_tape(j, chunk);
+}
+
+TEST(StreamParser, LongStringSpansManyChunks) {
+  const std::string j = "{\"blob\":\"" + std::string(200000, 'x') +
+                        "\\\"\",\"after\":[1,2]}";
+  for (size_t chunk : {64, 1000, 4096})
+    expect_same_tape(j, chunk);
+}
+
+TEST(StreamParser, RandomChunking) {
+  std::mt19937 rng(4242);
+  const std::string j = records(300);
+  for (int iter = 0; iter < 20; ++iter) {
+    DocumentView a, b;
+    parse_reuse(a, j);
+    StreamParser sp(b);
+    for (size_t i = 0; i < j.size();) {
+      const size_t n = 1 + rng() % 300;
+      sp.feed(std::string_view(j).substr(i, n));
+      i += n;
+    }
+    EXPECT_EQ(sp.finish().dump(), Value(&a, 0).dump());
+    EXPECT_EQ(a.tape.size(), b.tape.size());
+  }
+}
+
+TEST(StreamParser, InPlaceBufferMayMove) {
+  // The caller's buffer reallocates as it grows; only offsets are kept.
+  const std::string j = records(200);
+  std::string received;
+  DocumentView doc;
+  StreamParser sp(doc);
+  for (size_t i = 0; i < j.size(); i += 97) {
+    received.append(j, i, 97);
+    received.shrink_to_fit();
+    sp.advance(received);
+  }
+  EXPECT_EQ(sp.size(), j.size());
+  auto root = sp.finish();
+  EXPECT_EQ(root["items"].size(), 200u);
+  EXPECT_EQ(root["items"][199]["id"].as<int>(), 199);
+  EXPECT_EQ(root.dump(), beast::parse(doc, received).dump());
+}
+
+TEST(StreamParser, MalformedRejected) {
+  const std::string ok = records(10);
+  for (size_t chunk : {1, 64, 1000}) {
+    expect_rejected(ok.substr(0, ok.size() - 1), chunk); // truncated
+    expect_rejected(ok + "]", chunk);
+    expect_rejected(ok + " x", chunk);
+    expect_rejected("[1, tru]", chunk);
+    expect_rejected("[\"open", chunk);
+    expect_rejected("", chunk);
+    expect_rejected("   ", chunk);
+  }
+  // Stays failed until reset(). (Without a Stage 1 kernel the error only
+  // surfaces in finish().)
+  DocumentView doc;
+  StreamParser sp(doc);
+  EXPECT_THROW(
+      {
+        sp.feed("]" + std::string(200, ' '));
+        sp.finish();
+      },
+      std::runtime_error);
+  EXPECT_THROW(sp.feed("1"), std::runtime_error);
+  sp.reset();
+  sp.feed("[1,");
+  sp.feed("2]");
+  EXPECT_EQ(sp.finish().dump(), "[1,2]");
+}
+
+TEST(StreamParser, ReuseAcrossDocuments) {
+  beast::Document doc;
+  beast::StreamParser sp(doc);
+  for (int round = 0; round < 3; ++round) {
+    sp.reset();
+    const std::string j = records(5 + round * 50);
+    for (size_t i = 0; i < j.size(); i += 1460) // one TCP segment each
+      sp.feed(std::string_view(j).substr(i, 1460));
+    auto root = sp.finish();
+    EXPECT_EQ(root["items"].size(), static_cast<size_t>(5 + round * 50));
+    EXPECT_TRUE(root["done"].as<bool>());
+  }
+}
+
+TEST(StreamParser, OptionsReadPerDocument) {
+  // Options set after construction apply to the first document; options
+  // changed mid-document wait for the next one.
+  if (!stage1_kernel())
+    GTEST_SKIP() << "without a Stage 1 kernel, finish() reads the options";
+  beast::Document doc;
+  beast::StreamParser sp(doc);
+  doc.enable_number_decoding();
+  sp.feed("[1,");
+  doc.disable_number_decoding();
+  doc.enable_utf8_validation();
+  sp.feed("\"\xC0\x80\",2]");
+  auto root = sp.finish();
+  EXPECT_TRUE(doc.tape[1].is_decoded());
+  EXPECT_TRUE(doc.tape[3].is_decoded());
+  EXPECT_EQ(root[2].as<int>(), 2);
+
+  sp.reset(); // now decoding is off and UTF-8 is validated
+  sp.feed("[1,2]");
+  root = sp.finish();
+  EXPECT_FALSE(doc.tape[1].is_decoded());
+  sp.reset();
+  EXPECT_THROW(
+      {
+        sp.feed("[\"\xC0\x80\"]");
+        sp.finish();
+      },
+      std::runtime_error);
+}
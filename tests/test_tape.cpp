@@ -0,0 +1,341 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace beast;
+using beast::json::lazy::TapeNodeType;
+
+// Phase 85: the default build's ABI tag (see BEAST_JSON_TAPE64).
+static_assert(std::is_same_v<Document, json::lazy::tape32::DocumentView>);
+
+static bool lazy_ok(std::string_view j) {
+  try {
+    Document doc;
+    parse(doc, j);
+    return true;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+static bool is_open(TapeNodeType t) {
+  return t == TapeNodeType::ObjectStart || t == TapeNodeType::ArrayStart;
+}
+
+// ── Subtree end-links (Phase 80) ──────────────────────────────────────────────
+
+#if BEAST_JSON_TAPE_LINKS
+TEST(TapeLinks, OpenNodePointsAtMatchingClose) {
+  Document doc;
+  parse(doc, R"({"a":[1,{"b":[]},[[2]]],"c":{},"d":[{"e":null}]})");
+  const auto &tape = doc.tape;
+  for (size_t i = 0; i < tape.size(); ++i) {
+    if (!is_open(tape[i].type()))
+      continue;
+    // Reference: depth-counting walk
+    size_t j = i + 1;
+    int depth = 1;
+    for (; j < tape.size(); ++j) {
+      if (is_open(tape[j].type()))
+        ++depth;
+      else if (tape[j].type() == TapeNodeType::ObjectEnd ||
+               tape[j].type() == TapeNodeType::ArrayEnd)
+        if (--depth == 0)
+          break;
+    }
+    EXPECT_EQ(tape[i].offset, j) << "open node at tape index " << i;
+  }
+}
+
+TEST(TapeLinks, ReusedDocumentRelinks) {
+  Document doc;
+  parse(doc, R"([[1,2,3],[4]])");
+  parse(doc, R"({"x":[[]],"y":1})");
+  EXPECT_EQ(doc.tape[0].offset, doc.tape.size() - 1);
+  EXPECT_EQ(doc.tape[2].offset, 5u); // "x" value: [ [ ] ]
+  EXPECT_EQ(doc.tape[3].offset, 4u);
+}
+#endif
+
+TEST(TapeLinks, LookupPastLargeSiblings) {
+  std::string json = "{";
+  for (int k = 0; k < 50; ++k) {
+    json += "\"k" + std::to_string(k) + "\":[";
+    for (int i = 0; i < 200; ++i)
+      json += (i ? ",{\"v\":[" : "{\"v\":[") + std::to_string(i) + "]}";
+    json += "],";
+  }
+  json += "\"last\":\"found\"}";
+
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["last"].as<std::string>(), "found");
+  EXPECT_EQ(root["k49"][199]["v"][0].as<int>(), 199);
+  EXPECT_EQ(root.size(), 51u);
+  ASSERT_TRUE(root.find("last").has_value());
+  EXPECT_FALSE(root.find("missing").has_value());
+  EXPECT_EQ(root["k3"].size(), 200u);
+  EXPECT_EQ(root["k7"][5].dump(), R"({"v":[5]})");
+}
+
+TEST(TapeLinks, EmptyContainers) {
+  Document doc;
+  auto root = parse(doc, R"({"a":{},"b":[],"c":[[],{}],"d":true})");
+  EXPECT_TRUE(root["a"].empty());
+  EXPECT_TRUE(root["b"].empty());
+  EXPECT_EQ(root["c"].size(), 2u);
+  EXPECT_TRUE(root["d"].as<bool>());
+  EXPECT_EQ(root["c"].dump(), "[[],{}]");
+}
+
+TEST(TapeLinks, IteratorsSkipSubtrees) {
+  Document doc;
+  auto root = parse(doc, R"({"a":[[1],[2]],"b":{"x":{"y":1}},"c":3})");
+  std::string keys;
+  for (auto [k, v] : root.items())
+    keys += std::string(k);
+  EXPECT_EQ(keys, "abc");
+  int n = 0;
+  for (auto e : root["a"].elements()) {
+    (void)e;
+    ++n;
+  }
+  EXPECT_EQ(n, 2);
+}
+
+TEST(TapeLinks, MutationsStillApply) {
+  Document doc;
+  auto root = parse(doc, R"({"a":[1,[2,3]],"b":{"c":4},"d":5})");
+  root.erase("a");
+  root["d"].set(6);
+  EXPECT_EQ(root.dump(), R"({"b":{"c":4},"d":6})");
+}
+
+// ── Nesting depth bound ───────────────────────────────────────────────────────
+
+TEST(TapeDepth, MaxDepthAccepted) {
+  const int depth = 1087;
+  EXPECT_TRUE(lazy_ok(std::string(depth, '[') + std::string(depth, ']')));
+}
+
+TEST(TapeDepth, BeyondMaxDepthRejected) {
+  const int depth = 1088;
+  EXPECT_FALSE(lazy_ok(std::string(depth, '[') + std::string(depth, ']')));
+  std::string obj;
+  for (int i = 0; i < depth; ++i)
+    obj += "{\"k\":";
+  obj += "1" + std::string(depth, '}');
+  EXPECT_FALSE(lazy_ok(obj));
+}
+
+// ── Container element counts (Phase 83) ───────────────────────────────────────
+
+TEST(TapeCounts, RecordedOnOpenNode) {
+  Document doc;
+  parse(doc, R"({"a":[1,[2,3],{}],"b":{"x":1,"y":[]},"c":null})");
+  const auto &tape = doc.tape;
+  EXPECT_EQ(tape[0].length(), 3u); // root: a, b, c
+  EXPECT_EQ(tape[2].length(), 3u); // "a": 1, [2,3], {}
+  EXPECT_EQ(tape[4].length(), 2u); // [2,3]
+  EXPECT_EQ(tape[7].length(), 0u); // {}
+}
+
+TEST(TapeCounts, SizeAndEmpty) {
+  Document doc;
+  auto root = parse(doc, R"({"a":[1,[2,3],{}],"b":{"x":1,"y":[]},"c":[]})");
+  EXPECT_EQ(root.size(), 3u);
+  EXPECT_EQ(root["a"].size(), 3u);
+  EXPECT_EQ(root["a"][1].size(), 2u);
+  EXPECT_TRUE(root["a"][2].empty());
+  EXPECT_EQ(root["b"].size(), 2u);
+  EXPECT_TRUE(root["b"]["y"].empty());
+  EXPECT_TRUE(root["c"].empty());
+  EXPECT_EQ(root["a"][0].size(), 0u); // scalar
+}
+
+TEST(TapeCounts, TrailingCommaNotCounted) {
+  Document doc;
+  auto root = parse(doc, R"({"a":[1,2,],"b":{"k":1,},})");
+  EXPECT_EQ(root.size(), 2u);
+  EXPECT_EQ(root["a"].size(), 2u);
+  EXPECT_EQ(root["b"].size(), 1u);
+}
+
+TEST(TapeCounts, OverlaysAdjustSize) {
+  Document doc;
+  auto root = parse(doc, R"({"a":[1,2,3],"b":1,"c":2})");
+  root["a"].push_back(4);
+  EXPECT_EQ(root["a"].size(), 4u);
+  root["a"].erase(size_t{0});
+  EXPECT_EQ(root["a"].size(), 3u);
+  root.erase("b");
+  root.insert("d", 5);
+  EXPECT_EQ(root.size(), 3u);
+}
+
+TEST(TapeCounts, SaturatedCountFallsBackToWalk) {
+  const int n = 70000;
+  std::string json = "[";
+  for (int i = 0; i < n; ++i)
+    json += i ? ",0" : "0";
+  json += "]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(doc.tape[0].length(), json::lazy::TapeNode::kCountSaturated);
+  EXPECT_EQ(root.size(), static_cast<size_t>(n));
+  EXPECT_FALSE(root.empty());
+}
+
+TEST(TapeCounts, FromJsonReservesExactly) {
+  auto v = beast::read<std::vector<int>>("[1,2,3,4,5,6,7]");
+  EXPECT_EQ(v.size(), 7u);
+  EXPECT_EQ(v.capacity(), 7u);
+}
+
+// ── Long strings / numbers (Phase 84) ─────────────────────────────────────────
+
+TEST(TapeLongLength, StringValueRoundTrip) {
+  const std::string blob(200000, 'x');
+  const std::string json = R"({"blob":")" + blob + R"(","n":1})";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["blob"].as<std::string_view>().size(), blob.size());
+  EXPECT_EQ(root["blob"].as<std::string>(), blob);
+  EXPECT_EQ(root["n"].as<int>(), 1);
+  EXPECT_EQ(root.dump(), json);
+  std::string out;
+  root.dump(out);
+  EXPECT_EQ(out, json);
+  EXPECT_EQ(root["blob"].dump(), "\"" + blob + "\"");
+}
+
+TEST(TapeLongLength, BoundaryLengths) {
+  for (size_t len : {size_t{65534}, size_t{65535}, size_t{65536}}) {
+    const std::string s(len, 'a');
+    const std::string json = "[\"" + s + "\",\"" + s + "b\"]";
+    Document doc;
+    auto root = parse(doc, json);
+    EXPECT_EQ(root[0].as<std::string_view>().size(), len);
+    EXPECT_EQ(root[1].as<std::string_view>().size(), len + 1);
+    EXPECT_EQ(root.dump(), json);
+  }
+}
+
+TEST(TapeLongLength, LongKeys) {
+  const std::string key(70000, 'k');
+  const std::string json = "{\"" + key + "\":1,\"short\":2}";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root[key].as<int>(), 1);
+  EXPECT_EQ(root["short"].as<int>(), 2);
+  for (auto [k, v] : root.items()) {
+    EXPECT_TRUE(k == key || k == "short");
+    (void)v;
+  }
+  EXPECT_NE(root.dump(2).find(key), std::string::npos);
+}
+
+TEST(TapeLongLength, LongNumber) {
+  const std::string digits = "1." + std::string(70000, '5');
+  const std::string json = "[" + digits + ",2]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_NEAR(root[0].as<double>(), 1.5555, 1e-3);
+  EXPECT_EQ(root[1].as<int>(), 2);
+  EXPECT_EQ(root.dump(), json);
+}
+
+TEST(TapeLongLength, OverlaysAndReuse) {
+  const std::string blob(100000, 'z');
+  const std::string json = R"({"a":")" + blob + R"(","b":[1,2]})";
+  Document doc;
+  auto root = parse(doc, json);
+  root["b"].push_back(3);
+  EXPECT_EQ(root.dump(), R"({"a":")" + blob + R"(","b":[1,2,3]})");
+  root = parse(doc, R"({"a":"short"})");
+  EXPECT_TRUE(doc.long_lens_.empty());
+  EXPECT_EQ(root["a"].as<std::string>(), "short");
+}
+
+TEST(TapeLongLength, FlagsKeepSeparatorOnly) {
+  const std::string blob(70000, 'q');
+  const std::string json =
+      "[1,\"" + blob + "\"," + std::string(70000, '7') + "]";
+  Document doc;
+  parse(doc, json);
+  ASSERT_TRUE(doc.tape[2].is_long());
+  ASSERT_TRUE(doc.tape[3].is_long());
+  EXPECT_EQ(doc.tape[1].flags(), 0u); // first element: no separator
+  EXPECT_EQ(doc.tape[2].flags(), 1u); // comma, long bit not included
+  EXPECT_EQ(doc.tape[3].flags(), 1u);
+
+  // Staged Stage 2 (parse_many) builds the same long nodes.
+  Document many;
+  auto root = beast::parse_many(many, json);
+  ASSERT_EQ(root.size(), 1u);
+  EXPECT_EQ(root[0][1].as<std::string_view>(), blob);
+}
+
+// ── Right-sized, growable arena (Phase 86) ────────────────────────────────────
+
+TEST(TapeArenaGrowth, DenseInputGrowsPastEstimate) {
+  // One node per byte: far beyond the initial size / 8 estimate.
+  const int depth = 1000;
+  std::string json;
+  for (int rep = 0; rep < 40; ++rep)
+    json += (rep ? "," : "[") + std::string(depth, '[') +
+            std::string(depth, ']');
+  json += "]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(doc.tape.size(), json.size() - 39); // commas are not nodes
+  EXPECT_EQ(root.size(), 40u);
+  EXPECT_EQ(root.dump(), json);
+}
+
+TEST(TapeArenaGrowth, NumberArrayManyBlocks) {
+  // > 2 MB of one-digit elements, ~1 node per 2 bytes: the tape grows
+  // across many Stage 1 blocks (or through parse() without a kernel).
+  const int n = 1200000;
+  std::string json = "[";
+  for (int i = 0; i < n; ++i)
+    json += i ? ",7" : "7";
+  json += "]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root.size(), static_cast<size_t>(n));
+  EXPECT_EQ(root[n - 1].as<int>(), 7);
+  EXPECT_EQ(root.dump(), json);
+}
+
+TEST(TapeArenaGrowth, DenseObjectsGrowMidIteration) {
+  // ~1 node per 2-3 bytes through the fused key / close fast paths.
+  std::string json = "[";
+  for (int i = 0; i < 300000; ++i)
+    json += (i ? "," : "") + std::string(R"({"a":1,"b":[2,{}],"c":"x"})");
+  json += "]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root.size(), 300000u);
+  EXPECT_EQ(root[299999]["c"].as<std::string>(), "x");
+  EXPECT_EQ(root.dump(), json);
+}
+
+TEST(TapeArenaGrowth, CapacityTracksNodeCount) {
+  std::string json = R"({"text":")" + std::string(1 << 20, 'x') + R"("})";
+  Document doc;
+  parse(doc, json);
+  EXPECT_EQ(doc.tape.size(), 4u);
+  EXPECT_LT(doc.tape.capacity(), json.size() / 4);
+}
+
+TEST(TapeArenaGrowth, ReuseAfterGrowth) {
+  Document doc;
+  std::string dense = "[" + std::string(3000, '[') + std::string(3000, ']');
+  dense += ",1]";
+  // Depth exceeds kMaxDepth: rejected, but the arena may have grown.
+  EXPECT_THROW(parse(doc, dense), std::runtime_error);
+  auto root = parse(doc, R"([[1,2],{"a":[3]}])");
+  EXPECT_EQ(root[1]["a"][0].as<int>(), 3);
+  EXPECT_EQ(root.dump(), R"([[1,2],{"a":[3]}])");
+}
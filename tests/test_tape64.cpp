@@ -0,0 +1,75 @@
+// Built with 64-bit tape offsets (Phase 85); every other test target uses
+// the default 8-byte TapeNode.
+#define BEAST_JSON_TAPE64 1
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace beast;
+using beast::json::lazy::TapeNodeType;
+
+static_assert(sizeof(json::lazy::TapeNode) == 16);
+static_assert(sizeof(json::lazy::tape_off_t) == 8);
+static_assert(std::is_same_v<decltype(json::lazy::Stage1Index::count),
+                             json::lazy::tape_off_t>);
+// The mode is part of every mangled name, so mixed builds fail to link.
+static_assert(std::is_same_v<Document, json::lazy::tape64::DocumentView>);
+
+// ── 64-bit offset tape (Phase 85) ─────────────────────────────────────────────
+
+TEST(Tape64, RoundTrip) {
+  const std::string json =
+      R"({"a":[1,-2.5e3,true,false,null],"b":{"c":"d\"e","f":[]},"g":{}})";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root.dump(), json);
+  EXPECT_EQ(root["a"][1].as<double>(), -2500.0);
+  EXPECT_EQ(root["b"]["c"].as<std::string>(), "d\\\"e");
+  EXPECT_EQ(root["a"].size(), 5u);
+  EXPECT_TRUE(root["g"].empty());
+  EXPECT_NE(root.dump(2).find("\"f\": []"), std::string::npos);
+}
+
+TEST(Tape64, OffsetsAndLinks) {
+  Document doc;
+  parse(doc, R"(  {"x":[[]],"y":"z"})");
+  const auto &tape = doc.tape;
+  EXPECT_EQ(tape[1].type(), TapeNodeType::StringRaw);
+  EXPECT_EQ(tape[1].offset, 4u); // "x" content starts after the quote
+#if BEAST_JSON_TAPE_LINKS
+  EXPECT_EQ(tape[0].offset, tape.size() - 1);
+  EXPECT_EQ(tape[2].offset, 5u);
+#endif
+}
+
+TEST(Tape64, StagedAndScalarPathsAgree) {
+  // Large enough to exercise the Stage 1 index on SIMD builds; the 64-bit
+  // positions array must yield the same tape as the scalar parser.
+  std::string json = "[";
+  for (int i = 0; i < 5000; ++i)
+    json += (i ? "," : "") + std::string(R"({"id":)") + std::to_string(i) +
+            R"(,"s":"v)" + std::to_string(i) + R"("})";
+  json += "]";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root.size(), 5000u);
+  EXPECT_EQ(root[4999]["id"].as<int>(), 4999);
+  EXPECT_EQ(root[123]["s"].as<std::string>(), "v123");
+  EXPECT_EQ(root.dump(), json);
+}
+
+TEST(Tape64, LongStringsAndMutation) {
+  const std::string blob(100000, 'q');
+  const std::string json = R"({"a":")" + blob + R"(","b":[1]})";
+  Document doc;
+  auto root = parse(doc, json);
+  EXPECT_EQ(root["a"].as<std::string_view>().size(), blob.size());
+  root["b"].push_back(2);
+  EXPECT_EQ(root.dump(), R"({"a":")" + blob + R"(","b":[1,2]})");
+}
+
+TEST(Tape64, InvalidRejected) {
+  Document doc;
+  EXPECT_THROW(parse(doc, R"({"a":1]")"), std::runtime_error);
+  EXPECT_THROW(parse(doc, "[1,2"), std::runtime_error);
+}
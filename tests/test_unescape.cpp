@@ -0,0 +1,206 @@
+#include <beast_json/beast_json.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace beast::json::lazy;
+
+// Byte-at-a-time reference decoder for well-formed escapes.
+static std::string reference_unescape(std::string_view s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); ++i) {
+    if (s[i] != '\\') {
+      out += s[i];
+      continue;
+    }
+    const char c = s[++i];
+    if (c != 'u') {
+      const std::string_view from = "\"\\/bfnrt", to = "\"\\/\b\f\n\r\t";
+      out += to[from.find(c)];
+      continue;
+    }
+    uint32_t cp = std::stoul(std::string(s.substr(i + 1, 4)), nullptr, 16);
+    i += 4;
+    if (cp >= 0xD800 && cp <= 0xDBFF) {
+      const uint32_t lo =
+          std::stoul(std::string(s.substr(i + 3, 4)), nullptr, 16);
+      cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+      i += 6;
+    }
+    if (cp < 0x80) {
+      out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      out += static_cast<char>(0xC0 | (cp >> 6));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      out += static_cast<char>(0xE0 | (cp >> 12));
+      out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      out += static_cast<char>(0xF0 | (cp >> 18));
+      out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+  }
+  return out;
+}
+
+TEST(Unescape, EveryEscape) {
+  const std::string j =
+      R"(["q\"b\\s\/b\bf\fn\nr\rt\t",)"
+      R"("\u0041\u00e9\u20AC\uD83D\uDE00\u0000end","plain","",)"
+      R"("caf\u00e9 \u65e5\u672c"])";
+  beast::Document doc;
+  auto root = beast::parse(doc, j);
+  EXPECT_EQ(root[0].as_unescaped(), "q\"b\\s/b\bf\fn\nr\rt\t");
+  EXPECT_EQ(root[0].as<std::string_view>(), R"(q\"b\\s\/b\bf\fn\nr\rt\t)");
+  EXPECT_EQ(root[1].as_unescaped(),
+            std::string("A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", 10) +
+                std::string(1, '\0') + "end");
+  EXPECT_EQ(root[2].as_unescaped(), "plain");
+  EXPECT_EQ(root[3].as_unescaped(), "");
+  EXPECT_EQ(root[4].as_unescaped(), "caf\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC");
+}
+
+TEST(Unescape, RandomRunsMatchReference) {
+  // Escapes at every offset around the 8/16/32-byte vector edges.
+  static const char *const kEsc[] = {"\\n",     "\\\"",    "\\\\",
+                                     "\\u00e9", "\\u4e2D", "\\ud834\\udd1e",
+                                     "\\/",     "\\t"};
+  std::mt19937 rng(99);
+  std::string j = "[";
+  std::vector<std::string> raws;
+  for (int i = 0; i < 3000; ++i) {
+    std::string raw;
+    const int len = static_cast<int>(rng() % 120);
+    for (int k = 0; k < len; ++k) {
+      if (rng() % 23 == 0)
+        raw += kEsc[rng() % 8];
+      else
+        raw += static_cast<char>('a' + rng() % 26);
+    }
+    j += (i ? ",\"" : "\"") + raw + "\"";
+    raws.push_back(raw);
+  }
+  j += "]";
+  beast::Document doc;
+  auto root = beast::parse(doc, j);
+  for (size_t i = 0; i < raws.size(); ++i) {
+    ASSERT_EQ(root[i].as_unescaped(), reference_unescape(raws[i])) << raws[i];
+    ASSERT_EQ(root[i].as<std::string_view>(), raws[i]);
+  }
+
+  // The kernel alone writes no more than the input length.
+  for (const std::string &raw : raws) {
+    std::vector<char> out(raw.size() + 1, '#');
+    char *end = unescape_string(raw.data(), raw.data() + raw.size(),
+                                out.data());
+    ASSERT_NE(end, nullptr);
+    ASSERT_EQ(std::string(out.data(), end), reference_unescape(raw));
+    ASSERT_EQ(out[raw.size()], '#');
+  }
+}
+
+TEST(Unescape, ZeroCopyAndReadOnly) {
+  const std::string j = R"({"a":"no escapes here","b":"tab\there"})";
+  beast::Document doc;
+  auto root = beast::parse(doc, j);
+  const uint32_t meta_a = doc.tape[2].meta;
+  std::string_view a = root["a"].as_unescaped();
+  EXPECT_EQ(a.data(), root["a"].as<std::string_view>().data()); // the source
+  EXPECT_EQ(root["a"].as_unescaped().data(), a.data());
+  // Escape-free strings leave the document as parsed: safe to share.
+  EXPECT_EQ(doc.tape[2].meta, meta_a);
+  EXPECT_TRUE(doc.unescaped_.empty());
+  std::string_view b = root["b"].as_unescaped();
+  EXPECT_EQ(b, "tab\there");
+  EXPECT_EQ(root["b"].as_unescaped().data(), b.data()); // cached, not redone
+  EXPECT_EQ(doc.unescaped_.size(), 1u);
+
+  // The unpadded parse path reads the same way.
+  DocumentView d;
+  std::string buf = j;
+  buf.reserve(j.size() + 64);
+  prepare_parse_(d, buf);
+  d.tape.reserve(16);
+  ASSERT_TRUE(Parser(&d).parse<false>());
+  EXPECT_EQ(Value(&d, 2).as_unescaped(), "no escapes here");
+  EXPECT_EQ(Value(&d, 4).as_unescaped(), "tab\there");
+}
+
+TEST(Unescape, CacheAcrossParsesAndMoves) {
+  beast::Document doc;
+  auto root = beast::parse(doc, R"(["x\ny","\u0041"])");
+  EXPECT_EQ(root[0].as_unescaped(), "x\ny");
+  root = beast::parse(doc, R"(["p\tq","\u0042"])"); // same tape indices
+  EXPECT_TRUE(doc.unescaped_.empty());
+  EXPECT_EQ(root[0].as_unescaped(), "p\tq");
+  EXPECT_EQ(root[1].as_unescaped(), "B");
+
+  // Larger than the first arena chunk, many times over.
+  std::string big = "[\"";
+  for (int i = 0; i < 5000; ++i)
+    big += "ab\\n";
+  big += "\"]";
+  root = beast::parse(doc, big);
+  EXPECT_EQ(root[0].as_unescaped().size(), 15000u);
+
+  beast::Document moved(std::move(doc));
+  std::string_view v = beast::Value(&moved, 0)[0].as_unescaped();
+  EXPECT_EQ(v.size(), 15000u);
+  EXPECT_EQ(v.substr(0, 6), "ab\nab\n");
+}
+
+TEST(Unescape, MalformedAndWrongType) {
+  beast::Document doc;
+  for (const char *j :
+       {R"(["\x"])", R"(["\u12"])", R"(["\u12G4"])", R"(["\uD800"])",
+        R"(["\uDC00\uD800"])", R"(["\uD800\u0041"])", R"(["\uD800\n"])"}) {
+    auto root = beast::parse(doc, j);
+    EXPECT_THROW(root[0].as_unescaped(), std::runtime_error) << j;
+  }
+  auto root = beast::parse(doc, R"({"n":1,"s":"x"})");
+  EXPECT_THROW(root["n"].as_unescaped(), std::runtime_error);
+  EXPECT_THROW(root["missing"].as_unescaped(), std::runtime_error);
+}
+
+TEST(Unescape, Mutations) {
+  beast::Document doc;
+  auto root = beast::parse(doc, R"({"s":"old\nvalue"})");
+  EXPECT_EQ(root["s"].as_unescaped(), "old\nvalue");
+  root["s"].set("new\\tvalue"); // set() takes JSON string content
+  EXPECT_EQ(root["s"].as_unescaped(), "new\tvalue");
+  root["s"].set("plain");
+  EXPECT_EQ(root["s"].as_unescaped(), "plain");
+  root["s"].set(int64_t{5});
+  EXPECT_THROW(root["s"].as_unescaped(), std::runtime_error);
+  root["s"].unset();
+  EXPECT_EQ(root["s"].as_unescaped(), "old\nvalue");
+}
+
+struct Note {
+  std::string title;
+  std::vector<std::string> lines;
+  std::map<std::string, std::string> meta;
+};
+BEAST_JSON_FIELDS(Note, title, lines, meta)
+
+TEST(Unescape, ReflectionReadsDecodedStrings) {
+  const Note n = beast::read<Note>(
+      R"({"title":"say \"hi\"","lines":["a\tb","\u00e9"],)"
+      R"("meta":{"path":"C:\\tmp"}})");
+  EXPECT_EQ(n.title, "say \"hi\"");
+  ASSERT_EQ(n.lines.size(), 2u);
+  EXPECT_EQ(n.lines[0], "a\tb");
+  EXPECT_EQ(n.lines[1], "\xC3\xA9");
+  EXPECT_EQ(n.meta.at("path"), "C:\\tmp");
+
+  // write() escapes, read() now unescapes: strings round-trip.
+  const Note back = beast::read<Note>(beast::write(n));
+  EXPECT_EQ(back.title, n.title);
+  EXPECT_EQ(back.lines, n.lines);
+  EXPECT_EQ(back.meta, n.meta);
+}
@@ -1,12 +1,14 @@
 #include <beast_json/beast_json.hpp>
 #include <gtest/gtest.h>
+#include <random>
 #include <string>
 
 using namespace beast;
 
-// NOTE: Neither rtsm::Parser nor lazy::Parser validates UTF-8 byte sequences.
-// scan_string_swar / scan_string_end only scan for '"' and '\'.
-// All byte sequences in strings are accepted (no RFC 3629 validation).
+// NOTE: By default neither rtsm::Parser nor lazy::Parser validates UTF-8
+// byte sequences. scan_string_swar / scan_string_end only scan for '"' and
+// '\'. All byte sequences in strings are accepted (no RFC 3629 validation)
+// unless Document::enable_utf8_validation() is on (Phase 100, below).
 
 static bool check_parse(std::string_view json) {
   try {
@@ -39,3 +41,185 @@ TEST(Utf8Validation, Mixed) { EXPECT_TRUE(check_parse("{\"key\": \"Hello \xF0\x9
 TEST(Utf8Validation, MissingCloseBrace)   { EXPECT_FALSE(check_parse("{\"key\": \"value\"")); }
 TEST(Utf8Validation, MissingCloseBracket) { EXPECT_FALSE(check_parse("[1, 2, 3")); }
 TEST(Utf8Validation, EmptyInput)          { EXPECT_FALSE(check_parse("")); }
+
+// ── Phase 100: opt-in validation (enable_utf8_validation()) ──
+
+static bool check_validated(std::string_view json) {
+  try {
+    Document doc;
+    doc.enable_utf8_validation();
+    parse(doc, json);
+    return true;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+// Byte-at-a-time RFC 3629 reference.
+static bool reference_utf8(std::string_view s) {
+  for (size_t i = 0; i < s.size();) {
+    const unsigned char c = static_cast<unsigned char>(s[i]);
+    size_t k;
+    uint32_t cp;
+    if (c < 0x80) {
+      ++i;
+      continue;
+    } else if ((c & 0xE0) == 0xC0) {
+      k = 1, cp = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+      k = 2, cp = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+      k = 3, cp = c & 0x07;
+    } else {
+      return false;
+    }
+    if (s.size() - i <= k)
+      return false;
+    for (size_t j = 1; j <= k; ++j) {
+      const unsigned char d = static_cast<unsigned char>(s[i + j]);
+      if ((d & 0xC0) != 0x80)
+        return false;
+      cp = (cp << 6) | (d & 0x3F);
+    }
+    static const uint32_t kMin[] = {0, 0x80, 0x800, 0x10000};
+    if (cp < kMin[k] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+      return false;
+    i += k + 1;
+  }
+  return true;
+}
+
+TEST(Utf8Validation, OptInRejectsMalformed) {
+  for (const char *bad :
+       {"\x80", "\xC0\xAF", "\xC1\xBF", "\xE0\x80\xAF", "\xE0\x9F\xBF",
+        "\xE2\x82", "\xE2\x02\xAC", "\xED\xA0\x80", "\xED\xBF\xBF",
+        "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF",
+        "\xC2\xA2\xA2", "\xF0\x9F\x8C"}) {
+    const std::string j = std::string("{\"key\": \"") + bad + "\"}";
+    EXPECT_TRUE(check_parse(j)) << j; // the default accepts it
+    EXPECT_FALSE(check_validated(j)) << j;
+    EXPECT_FALSE(validate_utf8(bad)) << j;
+  }
+  for (const char *good : {"\xC2\xA2", "\xE2\x82\xAC", "\xED\x9F\xBF",
+                           "\xEE\x80\x80", "\xF0\x9D\x84\x9E",
+                           "\xF4\x8F\xBF\xBF", "Hello \xF0\x9F\x8C\x8D"}) {
+    const std::string j = std::string("{\"key\": \"") + good + "\"}";
+    EXPECT_TRUE(check_validated(j)) << j;
+    EXPECT_TRUE(validate_utf8(good)) << j;
+  }
+  // Still a parse error when the bytes are fine but the JSON is not.
+  EXPECT_FALSE(check_validated("{\"key\": \"\xC2\xA2\""));
+}
+
+TEST(Utf8Validation, RandomSequencesMatchReference) {
+  // Mostly valid text with random bytes mixed in, over every length up
+  // to a few 64-byte blocks, so each error lands on every block offset.
+  static const char *const kPieces[] = {
+      "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF",
+      "\xF4\x8F\xBF\xBF", "\xEF\xBF\xBD"};
+  std::mt19937 rng(100);
+  for (int iter = 0; iter < 20000; ++iter) {
+    std::string s;
+    const size_t len = rng() % 200;
+    while (s.size() < len) {
+      if (rng() % 40 == 0)
+        s += static_cast<char>(0x80 + rng() % 0x80);
+      else
+        s += kPieces[rng() % 7];
+    }
+    ASSERT_EQ(validate_utf8(s), reference_utf8(s)) << iter;
+  }
+}
+
+TEST(Utf8Validation, EveryParsePathAndBlockEdge) {
+  // An error at each offset around a 64-byte block edge and the Stage 1
+  // window edge, and sequences cut off by the end of input.
+  const size_t window = beast::json::lazy::kStage1Window;
+  for (size_t edge : {size_t{64}, size_t{128}, window, window + 64}) {
+    for (size_t at = edge - 4; at <= edge + 2; ++at) {
+      std::string j = "[\"" + std::string(at - 2, 'x') + "\xE2\x82\xAC";
+      const std::string good = j + "\"]";
+      std::string bad = j;
+      bad[at] = '\x41'; // first byte after the lead no longer continues it
+      bad += "\"]";
+      EXPECT_TRUE(check_validated(good)) << at;
+      EXPECT_FALSE(check_validated(bad)) << at;
+
+      beast::Document doc;
+      doc.enable_utf8_validation();
+      EXPECT_NO_THROW(beast::parse_many(doc, good + "\n" + good));
+      EXPECT_THROW(beast::parse_many(doc, good + "\n" + bad),
+                   std::runtime_error);
+      PaddedString padded(bad);
+      EXPECT_THROW(beast::parse_padded(doc, padded), std::runtime_error);
+      EXPECT_THROW(beast::json::lazy::parse_parallel(doc, bad, 2, 64),
+                   std::runtime_error);
+      StreamParser sp(doc);
+      EXPECT_THROW(
+          {
+            sp.feed(bad.substr(0, at));
+            sp.feed(bad.substr(at));
+            sp.finish();
+          },
+          std::runtime_error);
+    }
+  }
+  for (size_t len : {size_t{61}, size_t{62}, size_t{63}, size_t{64},
+                     size_t{127}, size_t{128}}) {
+    // A lead byte as the last byte of input, after a complete document
+    // whose length makes it the last byte of a block or of the tail.
+    std::string j = "\"" + std::string(len - 3, 'y') + "\" \xC3";
+    EXPECT_FALSE(check_validated(j)) << len;
+    j.back() = ' ';
+    EXPECT_TRUE(check_validated(j)) << len;
+  }
+  Document doc;
+  doc.enable_utf8_validation();
+  doc.disable_utf8_validation();
+  EXPECT_NO_THROW(parse(doc, "\"\xFF\""));
+}
+
+#if BEAST_HAS_AVX2 || BEAST_JSON_RUNTIME_DISPATCH
+TEST(Utf8Validation, KernelsMatchReferenceAcrossWindows) {
+  namespace lz = beast::json::lazy;
+  std::vector<std::pair<lz::Stage1Fn, lz::Stage1Fn>> kernels;
+#if BEAST_JSON_RUNTIME_DISPATCH
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    kernels.push_back({&lz::stage1_scan_avx512, &lz::stage1_scan_avx512_utf8});
+  if (__builtin_cpu_supports("avx2"))
+    kernels.push_back({&lz::stage1_scan_avx2, &lz::stage1_scan_avx2_utf8});
+#else
+  kernels.push_back({lz::stage1_kernel(), lz::stage1_kernel(true)});
+#endif
+  static const char *const kPieces[] = {"\"a\",", "\xC3\xA9", "\xE2\x82\xAC",
+                                        "\xF0\x9F\x98\x80", "[1]"};
+  std::mt19937 rng(1000);
+  for (const auto &[plain, checked] : kernels) {
+    for (int iter = 0; iter < 3000; ++iter) {
+      std::string s;
+      const size_t len = rng() % 400;
+      while (s.size() < len) {
+        if (rng() % 60 == 0)
+          s += static_cast<char>(0x80 + rng() % 0x80);
+        else
+          s += kPieces[rng() % 5];
+      }
+      // Windows of 64 / 128 bytes, then the tail, as parse_windowed() runs.
+      const size_t window = 64 << (rng() % 2);
+      lz::Stage1Index a, b;
+      lz::Stage1Carry ca, cb;
+      for (size_t at = 0; at < s.size(); at += window) {
+        const size_t n = std::min(window, s.size() - at);
+        ca = plain(s.data() + at, n, a, static_cast<lz::tape_off_t>(at), ca);
+        cb = checked(s.data() + at, n, b, static_cast<lz::tape_off_t>(at), cb);
+        ASSERT_EQ(a.count, b.count);
+        ASSERT_TRUE(std::equal(a.positions, a.positions + a.count,
+                               b.positions));
+      }
+      const bool ok = !cb.utf8_error && !lz::utf8_open_(cb.utf8_prev);
+      ASSERT_EQ(ok, reference_utf8(s)) << iter;
+      ASSERT_FALSE(ca.utf8_error);
+    }
+  }
+}
+#endif